@@ -4,6 +4,7 @@
 // localematcher.cpp
 // created: 2019may08 Markus W. Scherer
 
+#include <mutex>
 #include <optional>
 
 #include "unicode/utypes.h"
@@ -25,6 +26,9 @@
 
 #define UND_LSR LSR("und", "", "", LSR::EXPLICIT_LSR)
 
+// With fewer supported LSRs, looping over all of them is as fast as grouping them by language.
+constexpr int32_t MIN_LSRS_FOR_LANGUAGE_INDEX = 16;
+
 /**
  * Indicator for the lifetime of desired-locale objects passed into the LocaleMatcher.
  *
@@ -326,6 +330,73 @@ UBool compareLSRs(const UHashTok t1, const UHashTok t2) {
 
 }  // namespace
 
+/**
+ * A small map from desired-locale list strings to getBestMatchForListString() results.
+ * Servers tend to see the same few Accept-Language headers over and over,
+ * and this skips parsing them, maximizing their locales and matching them.
+ * The map is cleared when it is full.
+ */
+class LocaleMatcherListCache : public UMemory {
+public:
+    static constexpr int32_t CAPACITY = 64;
+    static constexpr int32_t MAX_LENGTH = 255;
+
+    LocaleMatcherListCache(UErrorCode &errorCode) {
+        map = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+        if (U_SUCCESS(errorCode)) {
+            uhash_setKeyDeleter(map, uprv_free);
+        }
+    }
+    ~LocaleMatcherListCache() {
+        uhash_close(map);
+    }
+
+    /**
+     * @param suppIndex set to the supported locale index,
+     *        or to nullopt if the list matched only the default locale
+     * @return true if the list is in the cache
+     */
+    bool get(StringPiece list, std::optional<int32_t> &suppIndex) {
+        char key[MAX_LENGTH + 1];
+        if (!toKey(list, key)) { return false; }
+        std::lock_guard<std::mutex> lock(mutex);
+        UBool found = false;
+        int32_t value = uhash_getiAndFound(map, key, &found);
+        if (found) {
+            suppIndex = value >= 0 ? std::optional<int32_t>(value) : std::nullopt;
+        }
+        return found;
+    }
+
+    void put(StringPiece list, std::optional<int32_t> suppIndex) {
+        char key[MAX_LENGTH + 1];
+        if (!toKey(list, key)) { return; }
+        char *ownedKey = static_cast<char *>(uprv_malloc(list.length() + 1));
+        if (ownedKey == nullptr) { return; }
+        uprv_memcpy(ownedKey, key, list.length() + 1);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (uhash_count(map) >= CAPACITY) {
+            uhash_removeAll(map);
+        }
+        UErrorCode errorCode = U_ZERO_ERROR;
+        uhash_putiAllowZero(map, ownedKey, suppIndex.value_or(-1), &errorCode);
+    }
+
+private:
+    static bool toKey(StringPiece list, char *key) {
+        if (list.length() > MAX_LENGTH || uprv_memchr(list.data(), 0, list.length()) != nullptr) {
+            return false;
+        }
+        uprv_memcpy(key, list.data(), list.length());
+        key[list.length()] = 0;
+        return true;
+    }
+
+    // Not a UMutex: Those must be static, and this object is owned by a LocaleMatcher.
+    std::mutex mutex;
+    UHashtable *map = nullptr;  // char * list -> supported index, or -1
+};
+
 int32_t LocaleMatcher::putIfAbsent(const LSR &lsr, int32_t i, int32_t suppLength,
                                    UErrorCode &errorCode) {
     if (U_FAILURE(errorCode)) { return suppLength; }
@@ -349,8 +420,12 @@ LocaleMatcher::LocaleMatcher(const Builder &builder, UErrorCode &errorCode) :
         supportedLocales(nullptr), lsrs(nullptr), supportedLocalesLength(0),
         supportedLsrToIndex(nullptr),
         supportedLSRs(nullptr), supportedIndexes(nullptr), supportedLSRsLength(0),
-        ownedDefaultLocale(nullptr), defaultLocale(nullptr) {
+        supportedLanguageIndex(nullptr),
+        ownedDefaultLocale(nullptr), defaultLocale(nullptr), listCache(nullptr) {
     if (U_FAILURE(errorCode)) { return; }
+    LocalPointer<LocaleMatcherListCache> cache(new LocaleMatcherListCache(errorCode), errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    listCache = cache.orphan();
     const Locale *def = builder.defaultLocale_;
     LSR builderDefaultLSR;
     const LSR *defLSR = nullptr;
@@ -457,6 +532,13 @@ LocaleMatcher::LocaleMatcher(const Builder &builder, UErrorCode &errorCode) :
         // If supportedLSRsLength < supportedLocalesLength then
         // we waste as many array slots as there are duplicate supported LSRs,
         // but the amount of wasted space is small as long as there are few duplicates.
+        if (supportedLSRsLength >= MIN_LSRS_FOR_LANGUAGE_INDEX) {
+            LocalPointer<SupportedLanguageIndex> index(
+                new SupportedLanguageIndex(supportedLSRs, supportedLSRsLength, errorCode),
+                errorCode);
+            if (U_FAILURE(errorCode)) { return; }
+            supportedLanguageIndex = index.orphan();
+        }
     }
 
     defaultLocale = def;
@@ -498,7 +580,9 @@ LocaleMatcher::LocaleMatcher(LocaleMatcher &&src) noexcept :
         supportedLSRs(src.supportedLSRs),
         supportedIndexes(src.supportedIndexes),
         supportedLSRsLength(src.supportedLSRsLength),
-        ownedDefaultLocale(src.ownedDefaultLocale), defaultLocale(src.defaultLocale) {
+        supportedLanguageIndex(src.supportedLanguageIndex),
+        ownedDefaultLocale(src.ownedDefaultLocale), defaultLocale(src.defaultLocale),
+        listCache(src.listCache) {
     src.supportedLocales = nullptr;
     src.lsrs = nullptr;
     src.supportedLocalesLength = 0;
@@ -506,8 +590,10 @@ LocaleMatcher::LocaleMatcher(LocaleMatcher &&src) noexcept :
     src.supportedLSRs = nullptr;
     src.supportedIndexes = nullptr;
     src.supportedLSRsLength = 0;
+    src.supportedLanguageIndex = nullptr;
     src.ownedDefaultLocale = nullptr;
     src.defaultLocale = nullptr;
+    src.listCache = nullptr;
 }
 
 LocaleMatcher::~LocaleMatcher() {
@@ -519,7 +605,9 @@ LocaleMatcher::~LocaleMatcher() {
     uhash_close(supportedLsrToIndex);
     uprv_free(supportedLSRs);
     uprv_free(supportedIndexes);
+    delete supportedLanguageIndex;
     delete ownedDefaultLocale;
+    delete listCache;
 }
 
 LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) noexcept {
@@ -536,8 +624,10 @@ LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) noexcept {
     supportedLSRs = src.supportedLSRs;
     supportedIndexes = src.supportedIndexes;
     supportedLSRsLength = src.supportedLSRsLength;
+    supportedLanguageIndex = src.supportedLanguageIndex;
     ownedDefaultLocale = src.ownedDefaultLocale;
     defaultLocale = src.defaultLocale;
+    listCache = src.listCache;
 
     src.supportedLocales = nullptr;
     src.lsrs = nullptr;
@@ -546,8 +636,10 @@ LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) noexcept {
     src.supportedLSRs = nullptr;
     src.supportedIndexes = nullptr;
     src.supportedLSRsLength = 0;
+    src.supportedLanguageIndex = nullptr;
     src.ownedDefaultLocale = nullptr;
     src.defaultLocale = nullptr;
+    src.listCache = nullptr;
     return *this;
 }
 
@@ -629,9 +721,25 @@ const Locale *LocaleMatcher::getBestMatch(Locale::Iterator &desiredLocales,
 const Locale *LocaleMatcher::getBestMatchForListString(
         StringPiece desiredLocaleList, UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) { return nullptr; }
+    if (listCache != nullptr) {
+        std::optional<int32_t> suppIndex;
+        if (listCache->get(desiredLocaleList, suppIndex)) {
+            return suppIndex.has_value() ? supportedLocales[*suppIndex] : defaultLocale;
+        }
+    }
     LocalePriorityList list(desiredLocaleList, errorCode);
     LocalePriorityList::Iterator iter = list.iterator();
-    return getBestMatch(iter, errorCode);
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    if (!iter.hasNext()) {
+        return defaultLocale;
+    }
+    LocaleLsrIterator lsrIter(likelySubtags, iter, ULOCMATCH_TEMPORARY_LOCALES);
+    std::optional<int32_t> suppIndex = getBestSuppIndex(lsrIter.next(errorCode), &lsrIter, errorCode);
+    if (U_FAILURE(errorCode)) { return defaultLocale; }
+    if (listCache != nullptr) {
+        listCache->put(desiredLocaleList, suppIndex);
+    }
+    return suppIndex.has_value() ? supportedLocales[*suppIndex] : defaultLocale;
 }
 
 LocaleMatcher::Result LocaleMatcher::getBestMatchResult(
@@ -684,7 +792,7 @@ std::optional<int32_t> LocaleMatcher::getBestSuppIndex(LSR desiredLSR,
             }
         }
         int32_t bestIndexAndDistance = localeDistance.getBestIndexAndDistance(
-                desiredLSR, supportedLSRs, supportedLSRsLength,
+                desiredLSR, supportedLSRs, supportedLSRsLength, supportedLanguageIndex,
                 bestShiftedDistance, favorSubtag, direction);
         if (bestIndexAndDistance >= 0) {
             bestShiftedDistance = LocaleDistance::getShiftedDistance(bestIndexAndDistance);
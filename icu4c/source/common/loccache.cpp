@@ -0,0 +1,234 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// loccache.cpp
+
+#include "unicode/utypes.h"
+#include "unicode/stringpiece.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "loccache.h"
+#include "mutex.h"
+#include "uassert.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int32_t kShardCapacity = LocaleIDCache::CAPACITY / LocaleIDCache::SHARD_COUNT;
+constexpr int32_t kBucketCount = 2 * kShardCapacity;  // power of 2
+
+// Entries are linked by index+1 within their shard,
+// so that 0 (the zero-initialized state) means none.
+struct Entry {
+    int32_t hash;
+    uint8_t kind;
+    uint8_t keyLength;
+    uint8_t valueLength;
+    // Neighbors in the recency list.
+    uint16_t newer;
+    uint16_t older;
+    // Next entry in the same hash bucket.
+    uint16_t nextInBucket;
+    char key[LocaleIDCache::MAX_LENGTH];
+    char value[LocaleIDCache::MAX_LENGTH];
+};
+
+static_assert(kShardCapacity < 0xffff, "entry links are uint16_t");
+static_assert(LocaleIDCache::MAX_LENGTH <= 0xff, "entry lengths are uint8_t");
+static_assert((LocaleIDCache::SHARD_COUNT & (LocaleIDCache::SHARD_COUNT - 1)) == 0,
+              "SHARD_COUNT is a power of 2");
+
+// The cache is split by key hash into shards with one mutex each,
+// so that threads looking up different IDs rarely wait for each other.
+// Each shard is an LRU cache of its own.
+// All of the shard state is plain data that starts out zero, i.e. empty,
+// so that it needs neither an allocation nor a static constructor.
+// It is only accessed while holding the shard's mutex.
+struct Shard {
+    Entry entries[kShardCapacity];
+    uint16_t buckets[kBucketCount];
+    uint16_t newest;
+    uint16_t oldest;
+    int32_t size;
+    LocaleIDCache::Metrics metrics[LocaleIDCache::KIND_COUNT];
+
+    uint16_t &bucketFor(int32_t hash) {
+        return buckets[hash & (kBucketCount - 1)];
+    }
+
+    uint16_t find(LocaleIDCache::Kind kind, int32_t hash, StringPiece key) {
+        for (uint16_t i = bucketFor(hash); i != 0; i = entries[i - 1].nextInBucket) {
+            const Entry &e = entries[i - 1];
+            if (e.hash == hash && e.kind == kind && e.keyLength == key.length() &&
+                    (key.empty() || uprv_memcmp(e.key, key.data(), key.length()) == 0)) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void unlinkRecency(uint16_t i) {
+        Entry &e = entries[i - 1];
+        if (e.newer != 0) {
+            entries[e.newer - 1].older = e.older;
+        } else {
+            newest = e.older;
+        }
+        if (e.older != 0) {
+            entries[e.older - 1].newer = e.newer;
+        } else {
+            oldest = e.newer;
+        }
+        e.newer = e.older = 0;
+    }
+
+    void linkNewest(uint16_t i) {
+        Entry &e = entries[i - 1];
+        e.newer = 0;
+        e.older = newest;
+        if (newest != 0) {
+            entries[newest - 1].newer = i;
+        } else {
+            oldest = i;
+        }
+        newest = i;
+    }
+
+    void unlinkBucket(uint16_t i) {
+        Entry &e = entries[i - 1];
+        uint16_t *link = &bucketFor(e.hash);
+        while (*link != i) {
+            U_ASSERT(*link != 0);
+            link = &entries[*link - 1].nextInBucket;
+        }
+        *link = e.nextInBucket;
+        e.nextInBucket = 0;
+    }
+};
+
+// UMutex instances must be static, so they are kept apart from the shards.
+UMutex gShardMutexes[LocaleIDCache::SHARD_COUNT];
+Shard gShards[LocaleIDCache::SHARD_COUNT];
+
+icu::UInitOnce gCleanupInitOnce {};
+
+UBool U_CALLCONV cleanupLocaleIDCache() {
+    LocaleIDCache::clear();
+    gCleanupInitOnce.reset();
+    return true;
+}
+
+void U_CALLCONV registerCleanup() {
+    ucln_common_registerCleanup(UCLN_COMMON_LOCALE_ID_CACHE, cleanupLocaleIDCache);
+}
+
+int32_t hashKey(LocaleIDCache::Kind kind, StringPiece key) {
+    return ustr_hashCharsN(key.data(), key.length()) * 37 + kind;
+}
+
+// Uses the high bits of a multiplicative hash,
+// while the buckets within a shard use the low bits of the key hash.
+int32_t shardIndex(int32_t hash) {
+    constexpr int32_t shardBits = 4;
+    static_assert((1 << shardBits) == LocaleIDCache::SHARD_COUNT, "shardBits");
+    return static_cast<int32_t>((static_cast<uint32_t>(hash) * 0x9e3779b1u) >> (32 - shardBits));
+}
+
+}  // namespace
+
+bool LocaleIDCache::get(Kind kind, StringPiece key, CharString &value, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || key.length() > MAX_LENGTH) {
+        return false;
+    }
+    umtx_initOnce(gCleanupInitOnce, &registerCleanup);
+    int32_t hash = hashKey(kind, key);
+    int32_t s = shardIndex(hash);
+    Shard &shard = gShards[s];
+    Mutex lock(&gShardMutexes[s]);
+    uint16_t i = shard.find(kind, hash, key);
+    if (i == 0) {
+        ++shard.metrics[kind].misses;
+        return false;
+    }
+    ++shard.metrics[kind].hits;
+    if (shard.newest != i) {
+        shard.unlinkRecency(i);
+        shard.linkNewest(i);
+    }
+    const Entry &e = shard.entries[i - 1];
+    value.append(e.value, e.valueLength, errorCode);
+    return U_SUCCESS(errorCode);
+}
+
+void LocaleIDCache::put(Kind kind, StringPiece key, StringPiece value) {
+    if (key.length() > MAX_LENGTH || value.length() > MAX_LENGTH) {
+        return;
+    }
+    umtx_initOnce(gCleanupInitOnce, &registerCleanup);
+    int32_t hash = hashKey(kind, key);
+    int32_t s = shardIndex(hash);
+    Shard &shard = gShards[s];
+    Mutex lock(&gShardMutexes[s]);
+    uint16_t i = shard.find(kind, hash, key);
+    if (i != 0) {
+        // Another thread computed the same value meanwhile.
+        shard.unlinkRecency(i);
+    } else {
+        if (shard.size < kShardCapacity) {
+            i = static_cast<uint16_t>(++shard.size);
+        } else {
+            i = shard.oldest;
+            Entry &oldest = shard.entries[i - 1];
+            shard.unlinkRecency(i);
+            shard.unlinkBucket(i);
+            --shard.metrics[oldest.kind].size;
+            ++shard.metrics[oldest.kind].evictions;
+        }
+        Entry &e = shard.entries[i - 1];
+        e.hash = hash;
+        e.kind = static_cast<uint8_t>(kind);
+        e.keyLength = static_cast<uint8_t>(key.length());
+        if (!key.empty()) {
+            uprv_memcpy(e.key, key.data(), key.length());
+        }
+        e.nextInBucket = shard.bucketFor(hash);
+        shard.bucketFor(hash) = i;
+        ++shard.metrics[kind].size;
+    }
+    Entry &e = shard.entries[i - 1];
+    e.valueLength = static_cast<uint8_t>(value.length());
+    if (!value.empty()) {
+        uprv_memcpy(e.value, value.data(), value.length());
+    }
+    shard.linkNewest(i);
+}
+
+LocaleIDCache::Metrics LocaleIDCache::getMetrics(Kind kind) {
+    Metrics sum = {};
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        Mutex lock(&gShardMutexes[s]);
+        const Metrics &m = gShards[s].metrics[kind];
+        sum.hits += m.hits;
+        sum.misses += m.misses;
+        sum.evictions += m.evictions;
+        sum.size += m.size;
+    }
+    return sum;
+}
+
+void LocaleIDCache::clear() {
+    for (int32_t s = 0; s < SHARD_COUNT; ++s) {
+        Mutex lock(&gShardMutexes[s]);
+        uprv_memset(&gShards[s], 0, sizeof(Shard));
+    }
+}
+
+int32_t LocaleIDCache::getShard(Kind kind, StringPiece key) {
+    return shardIndex(hashKey(kind, key));
+}
+
+U_NAMESPACE_END
@@ -0,0 +1,88 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// loccache.h
+
+#ifndef __LOCCACHE_H__
+#define __LOCCACHE_H__
+
+#include "unicode/utypes.h"
+#include "unicode/stringpiece.h"
+#include "charstr.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * A bounded, thread-safe LRU cache of locale ID resolution results,
+ * so that the same tags coming in over and over (for example from Accept-Language
+ * headers) are not re-parsed, re-canonicalized and looked up in the likely subtags
+ * trie on every call.
+ *
+ * The cache is split by key hash into SHARD_COUNT shards with a lock each,
+ * and each shard evicts its own least recently used entry.
+ *
+ * Keys and values are locale IDs or language tags of up to MAX_LENGTH bytes;
+ * longer ones are not cached. Only successful results are cached.
+ * The results depend only on the input and the loaded data, so the cache is
+ * cleared in u_cleanup() and otherwise never invalidated.
+ *
+ * @internal
+ */
+class U_COMMON_API LocaleIDCache {
+public:
+    LocaleIDCache() = delete;  // all static
+
+    /** What a cached value was computed with, from the key. */
+    enum Kind {
+        /** Locale::createCanonical(key).getName() */
+        CANONICAL_LOCALE,
+        /** ulocimp_addLikelySubtags(key) */
+        ADD_LIKELY_SUBTAGS,
+        /** ulocimp_minimizeSubtags(key, false) */
+        MINIMIZE_SUBTAGS,
+        /** ulocimp_minimizeSubtags(key, true) */
+        MINIMIZE_SUBTAGS_FAVOR_SCRIPT,
+        /** ulocimp_forLanguageTag(key) of a well-formed tag */
+        FOR_LANGUAGE_TAG,
+        KIND_COUNT
+    };
+
+    /** Total number of entries, over all shards. */
+    static constexpr int32_t CAPACITY = 256;
+    static constexpr int32_t SHARD_COUNT = 16;
+    static constexpr int32_t MAX_LENGTH = 64;
+
+    /** Counters for one kind of entry, since the last clear(). */
+    struct Metrics {
+        int64_t hits;
+        int64_t misses;
+        int64_t evictions;
+        /** The number of entries of this kind in the cache. */
+        int32_t size;
+    };
+
+    /**
+     * Looks up the key, and if found appends the value and makes the entry
+     * the most recently used one.
+     * @return true if the key was found
+     */
+    static bool get(Kind kind, StringPiece key, CharString &value, UErrorCode &errorCode);
+
+    /**
+     * Adds or replaces the entry for the key, evicting the least recently used
+     * entry if the cache is full. Does nothing if the key or value are too long.
+     */
+    static void put(Kind kind, StringPiece key, StringPiece value);
+
+    static Metrics getMetrics(Kind kind);
+
+    /** Removes all entries and resets the metrics. */
+    static void clear();
+
+    /** @return the shard for the key, 0..SHARD_COUNT-1; for testing */
+    static int32_t getShard(Kind kind, StringPiece key);
+};
+
+U_NAMESPACE_END
+
+#endif  // __LOCCACHE_H__
@@ -10,11 +10,13 @@
 #include "unicode/locid.h"
 #include "unicode/uobject.h"
 #include "unicode/ures.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "locdistance.h"
 #include "loclikelysubtags.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
+#include "uhash.h"
 #include "uinvchar.h"
 #include "umutex.h"
 
@@ -106,55 +108,115 @@ LocaleDistance::LocaleDistance(const LocaleDistanceData &data, const LikelySubta
     defaultDemotionPerDesiredLocale  = getDistanceFloor(indexAndDistance);
 }
 
+SupportedLanguageIndex::SupportedLanguageIndex(const LSR **supportedLSRs,
+                                               int32_t supportedLSRsLength,
+                                               UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    LocalUHashtablePointer groupOfLanguage(
+        uhash_openSize(uhash_hashChars, uhash_compareChars, nullptr,
+                       supportedLSRsLength, &errorCode));
+    MaybeStackArray<int32_t, 100> groupOf(supportedLSRsLength, errorCode);
+    languages = static_cast<const char **>(
+        uprv_malloc(supportedLSRsLength * sizeof(const char *)));
+    limits = static_cast<int32_t *>(uprv_malloc(supportedLSRsLength * sizeof(int32_t)));
+    indexes = static_cast<int32_t *>(uprv_malloc(supportedLSRsLength * sizeof(int32_t)));
+    if (U_FAILURE(errorCode)) { return; }
+    if (languages == nullptr || limits == nullptr || indexes == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Number the languages in order of first appearance, and count their LSRs.
+    for (int32_t i = 0; i < supportedLSRsLength; ++i) {
+        const char *language = supportedLSRs[i]->language;
+        UBool found = false;
+        int32_t group = uhash_getiAndFound(groupOfLanguage.getAlias(), language, &found);
+        if (!found) {
+            group = languagesLength++;
+            languages[group] = language;
+            limits[group] = 0;
+            uhash_putiAllowZero(groupOfLanguage.getAlias(), const_cast<char *>(language),
+                                group, &errorCode);
+            if (U_FAILURE(errorCode)) { return; }
+        }
+        groupOf[i] = group;
+        ++limits[group];
+    }
+    // Turn the counts into limits, and fill each group in ascending index order.
+    for (int32_t group = 1; group < languagesLength; ++group) {
+        limits[group] += limits[group - 1];
+    }
+    for (int32_t i = supportedLSRsLength - 1; i >= 0; --i) {
+        indexes[--limits[groupOf[i]]] = i;
+    }
+    for (int32_t group = 0; group < languagesLength; ++group) {
+        limits[group] = group + 1 < languagesLength ? limits[group + 1] : supportedLSRsLength;
+    }
+}
+
+SupportedLanguageIndex::~SupportedLanguageIndex() {
+    uprv_free(languages);
+    uprv_free(limits);
+    uprv_free(indexes);
+}
+
 int32_t LocaleDistance::getBestIndexAndDistance(
         const LSR &desired,
         const LSR **supportedLSRs, int32_t supportedLSRsLength,
         int32_t shiftedThreshold,
         ULocMatchFavorSubtag favorSubtag, ULocMatchDirection direction) const {
+    return getBestIndexAndDistance(desired, supportedLSRs, supportedLSRsLength, nullptr,
+                                   shiftedThreshold, favorSubtag, direction);
+}
+
+int32_t LocaleDistance::getBestIndexAndDistance(
+        const LSR &desired,
+        const LSR **supportedLSRs, int32_t supportedLSRsLength,
+        const SupportedLanguageIndex *languageIndex,
+        int32_t shiftedThreshold,
+        ULocMatchFavorSubtag favorSubtag, ULocMatchDirection direction) const {
     BytesTrie iter(trie);
     // Look up the desired language only once for all supported LSRs.
     // Its "distance" is either a match point value of 0, or a non-match negative value.
     // Note: The data builder verifies that there are no <*, supported> or <desired, *> rules.
     int32_t desLangDistance = trieNext(iter, desired.language, false);
-    uint64_t desLangState = desLangDistance >= 0 && supportedLSRsLength > 1 ? iter.getState64() : 0;
+    uint64_t desLangState = desLangDistance >= 0 ? iter.getState64() : 0;
     // Index of the supported LSR with the lowest distance.
     int32_t bestIndex = -1;
     // Cached lookup info from LikelySubtags.compareLikely().
     int32_t bestLikelyInfo = -1;
-    for (int32_t slIndex = 0; slIndex < supportedLSRsLength; ++slIndex) {
-        const LSR &supported = *supportedLSRs[slIndex];
-        bool star = false;
-        int32_t distance = desLangDistance;
+
+    // The language distance, and the trie state after the language pair.
+    struct LanguageDistance {
+        int32_t distance;
+        int32_t flags;
+        bool star;
+        uint64_t state;
+    };
+    auto getLanguageDistance = [&](const char *supportedLanguage) {
+        LanguageDistance result = { desLangDistance, 0, false, 0 };
+        int32_t &distance = result.distance;
         if (distance >= 0) {
             U_ASSERT((distance & DISTANCE_IS_FINAL) == 0);
-            if (slIndex != 0) {
-                iter.resetToState64(desLangState);
-            }
-            distance = trieNext(iter, supported.language, true);
+            iter.resetToState64(desLangState);
+            distance = trieNext(iter, supportedLanguage, true);
         }
         // Note: The data builder verifies that there are no rules with "any" (*) language and
         // real (non *) script or region subtags.
         // This means that if the lookup for either language fails we can use
         // the default distances without further lookups.
-        int32_t flags;
         if (distance >= 0) {
-            flags = distance & DISTANCE_IS_FINAL_OR_SKIP_SCRIPT;
+            result.flags = distance & DISTANCE_IS_FINAL_OR_SKIP_SCRIPT;
             distance &= ~DISTANCE_IS_FINAL_OR_SKIP_SCRIPT;
+            result.state = iter.getState64();
         } else {  // <*, *>
-            if (uprv_strcmp(desired.language, supported.language) == 0) {
+            if (uprv_strcmp(desired.language, supportedLanguage) == 0) {
                 distance = 0;
             } else {
                 distance = defaultLanguageDistance;
             }
-            flags = 0;
-            star = true;
+            result.star = true;
         }
         U_ASSERT(0 <= distance && distance <= 100);
-        // Round up the shifted threshold (if fraction bits are not 0)
-        // for comparison with un-shifted distances until we need fraction bits.
-        // (If we simply shifted non-zero fraction bits away, then we might ignore a language
-        // when it's really still a micro distance below the threshold.)
-        int32_t roundedThreshold = (shiftedThreshold + DISTANCE_FRACTION_MASK) >> DISTANCE_SHIFT;
         // We implement "favor subtag" by reducing the language subtag distance
         // (unscientifically reducing it to a quarter of the normal value),
         // so that the script distance is relatively more important.
@@ -163,12 +225,32 @@ int32_t LocaleDistance::getBestIndexAndDistance(
         if (favorSubtag == ULOCMATCH_FAVOR_SCRIPT) {
             distance >>= 2;
         }
+        return result;
+    };
+
+    // Compares one supported LSR with the desired one, given their language distance.
+    // Returns true if it is a perfect match.
+    auto isPerfectMatch = [&](int32_t slIndex, const LanguageDistance &langDistance) {
+        const LSR &supported = *supportedLSRs[slIndex];
+        bool star = langDistance.star;
+        int32_t distance = langDistance.distance;
+        int32_t flags = langDistance.flags;
+        // Round up the shifted threshold (if fraction bits are not 0)
+        // for comparison with un-shifted distances until we need fraction bits.
+        // (If we simply shifted non-zero fraction bits away, then we might ignore a language
+        // when it's really still a micro distance below the threshold.)
+        int32_t roundedThreshold = (shiftedThreshold + DISTANCE_FRACTION_MASK) >> DISTANCE_SHIFT;
         // Let distance == roundedThreshold pass until the tie-breaker logic
         // at the end of the loop.
         if (distance > roundedThreshold) {
-            continue;
+            return false;
         }
 
+        if (!star) {
+            // Continue after the language pair, also for the region lookup
+            // if the script lookup is skipped.
+            iter.resetToState64(langDistance.state);
+        }
         int32_t scriptDistance;
         if (star || flags != 0) {
             if (uprv_strcmp(desired.script, supported.script) == 0) {
@@ -177,14 +259,14 @@ int32_t LocaleDistance::getBestIndexAndDistance(
                 scriptDistance = defaultScriptDistance;
             }
         } else {
-            scriptDistance = getDesSuppScriptDistance(iter, iter.getState64(),
+            scriptDistance = getDesSuppScriptDistance(iter, langDistance.state,
                     desired.script, supported.script);
             flags = scriptDistance & DISTANCE_IS_FINAL;
             scriptDistance &= ~DISTANCE_IS_FINAL;
         }
         distance += scriptDistance;
         if (distance > roundedThreshold) {
-            continue;
+            return false;
         }
 
         if (uprv_strcmp(desired.region, supported.region) == 0) {
@@ -194,7 +276,7 @@ int32_t LocaleDistance::getBestIndexAndDistance(
         } else {
             int32_t remainingThreshold = roundedThreshold - distance;
             if (minRegionDistance > remainingThreshold) {
-                continue;
+                return false;
             }
 
             // From here on we know the regions are not equal.
@@ -218,7 +300,7 @@ int32_t LocaleDistance::getBestIndexAndDistance(
                         // Is there also a match when we swap desired/supported?
                         isMatch(supported, desired, shiftedThreshold, favorSubtag)) {
                     if (shiftedDistance == 0) {
-                        return slIndex << INDEX_SHIFT;
+                        return true;
                     }
                     bestIndex = slIndex;
                     shiftedThreshold = shiftedDistance;
@@ -249,6 +331,66 @@ int32_t LocaleDistance::getBestIndexAndDistance(
                 }
             }
         }
+        return false;
+    };
+
+    // With a language index, look up each supported language once, and then visit
+    // the supported LSRs of only the languages that are close enough, in index order.
+    // Skipping the others is the same as the distance > roundedThreshold check
+    // because the threshold only decreases.
+    // If there are many close languages (e.g., when favoring the script),
+    // then merging their LSRs is slower than the plain loop.
+    struct Group {
+        LanguageDistance langDistance;
+        int32_t next;
+        int32_t limit;
+    };
+    constexpr int32_t kMaxGroups = 8;
+    Group groups[kMaxGroups];
+    int32_t groupsLength = 0;
+    if (languageIndex != nullptr) {
+        int32_t roundedThreshold = (shiftedThreshold + DISTANCE_FRACTION_MASK) >> DISTANCE_SHIFT;
+        for (int32_t i = 0; i < languageIndex->languagesLength; ++i) {
+            LanguageDistance langDistance =
+                getLanguageDistance(languageIndex->languages[i]);
+            if (langDistance.distance <= roundedThreshold) {
+                if (groupsLength == kMaxGroups) {
+                    languageIndex = nullptr;
+                    break;
+                }
+                groups[groupsLength++] = {
+                    langDistance,
+                    i == 0 ? 0 : languageIndex->limits[i - 1],
+                    languageIndex->limits[i]
+                };
+            }
+        }
+    }
+    if (languageIndex != nullptr) {
+        for (;;) {
+            Group *group = nullptr;
+            int32_t slIndex = supportedLSRsLength;
+            for (int32_t i = 0; i < groupsLength; ++i) {
+                Group &g = groups[i];
+                if (g.next < g.limit && languageIndex->indexes[g.next] < slIndex) {
+                    group = &g;
+                    slIndex = languageIndex->indexes[g.next];
+                }
+            }
+            if (group == nullptr) {
+                break;
+            }
+            ++group->next;
+            if (isPerfectMatch(slIndex, group->langDistance)) {
+                return slIndex << INDEX_SHIFT;
+            }
+        }
+    } else {
+        for (int32_t slIndex = 0; slIndex < supportedLSRsLength; ++slIndex) {
+            if (isPerfectMatch(slIndex, getLanguageDistance(supportedLSRs[slIndex]->language))) {
+                return slIndex << INDEX_SHIFT;
+            }
+        }
     }
     return bestIndex >= 0 ?
             (bestIndex << INDEX_SHIFT) | shiftedThreshold :
@@ -17,6 +17,34 @@
 U_NAMESPACE_BEGIN
 
 struct LocaleDistanceData;
+class LocaleDistance;
+
+/**
+ * The supported LSRs of a LocaleMatcher grouped by language.
+ * With it, LocaleDistance::getBestIndexAndDistance() looks up the distance
+ * between the desired language and each supported language only once,
+ * and visits only the supported LSRs whose language is close enough.
+ */
+class SupportedLanguageIndex final : public UMemory {
+public:
+    SupportedLanguageIndex(const LSR **supportedLSRs, int32_t supportedLSRsLength,
+                           UErrorCode &errorCode);
+    ~SupportedLanguageIndex();
+
+private:
+    friend class LocaleDistance;
+
+    SupportedLanguageIndex(const SupportedLanguageIndex &other) = delete;
+    SupportedLanguageIndex &operator=(const SupportedLanguageIndex &other) = delete;
+
+    int32_t languagesLength = 0;
+    /** The language of each group. */
+    const char **languages = nullptr;
+    /** Group i is indexes[limits[i-1]..limits[i]-1], with limits[-1]=0. */
+    int32_t *limits = nullptr;
+    /** Indexes into the supportedLSRs, grouped by language, ascending within each group. */
+    int32_t *indexes = nullptr;
+};
 
 /**
  * Offline-built data for LocaleMatcher.
@@ -62,6 +90,18 @@ class LocaleDistance final : public UMemory {
                                     ULocMatchFavorSubtag favorSubtag,
                                     ULocMatchDirection direction) const;
 
+    /**
+     * Same as the other overload, but if the languageIndex is not nullptr
+     * (and was built from the same supportedLSRs),
+     * then it is used to skip the supported LSRs whose languages are too far.
+     */
+    int32_t getBestIndexAndDistance(const LSR &desired,
+                                    const LSR **supportedLSRs, int32_t supportedLSRsLength,
+                                    const SupportedLanguageIndex *languageIndex,
+                                    int32_t shiftedThreshold,
+                                    ULocMatchFavorSubtag favorSubtag,
+                                    ULocMatchDirection direction) const;
+
     bool isParadigmLSR(const LSR &lsr) const;
 
     int32_t getDefaultScriptDistance() const {
@@ -52,6 +52,7 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "fixedstring.h"
+#include "loccache.h"
 #include "mutex.h"
 #include "putilimp.h"
 #include "uassert.h"
@@ -1971,14 +1972,25 @@ Locale& Locale::init(StringPiece localeID, UBool canonicalize)
         int32_t length;
         UErrorCode err;
 
-        const auto parse = [canonicalize](std::string_view localeID,
-                                          char* name,
-                                          int32_t nameCapacity,
-                                          UErrorCode& status) {
+        // A cached canonical name is the final getName() of an earlier
+        // canonicalization of the same ID, after any alias replacement.
+        CharString cachedName;
+        bool isCached = false;
+        if (canonicalize) {
+            err = U_ZERO_ERROR;
+            isCached = LocaleIDCache::get(LocaleIDCache::CANONICAL_LOCALE, localeID, cachedName, err);
+        }
+
+        const auto parse = [canonicalize, isCached, &cachedName](std::string_view localeID,
+                                                                 char* name,
+                                                                 int32_t nameCapacity,
+                                                                 UErrorCode& status) {
             return ByteSinkUtil::viaByteSinkToTerminatedChars(
                 name, nameCapacity,
                 [&](ByteSink& sink, UErrorCode& status) {
-                    if (canonicalize) {
+                    if (isCached) {
+                        sink.Append(cachedName.data(), cachedName.length());
+                    } else if (canonicalize) {
                         ulocimp_canonicalize(localeID, sink, status);
                     } else {
                         ulocimp_getName(localeID, sink, status);
@@ -2110,7 +2122,7 @@ Locale& Locale::init(StringPiece localeID, UBool canonicalize)
             }
         }
 
-        if (canonicalize) {
+        if (canonicalize && !isCached) {
             if (!isKnownCanonicalizedLocale(getName(), err)) {
                 CharString replaced;
                 // Not sure it is already canonicalized
@@ -2123,6 +2135,7 @@ Locale& Locale::init(StringPiece localeID, UBool canonicalize)
                     break;
                 }
             }
+            LocaleIDCache::put(LocaleIDCache::CANONICAL_LOCALE, localeID, getName());
         }   // if (canonicalize) {
 
         // successful end of init()
@@ -2265,6 +2278,15 @@ Locale::forLanguageTag(StringPiece tag, UErrorCode& status)
     // parsing. Therefore the code here explicitly calls uloc_forLanguageTag()
     // and then Locale::init(), instead of just calling the normal constructor.
 
+    CharString cached;
+    if (LocaleIDCache::get(LocaleIDCache::FOR_LANGUAGE_TAG, tag, cached, status)) {
+        result.init(cached.data(), /*canonicalize=*/false);
+        return result;
+    }
+    if (U_FAILURE(status)) {
+        return result;
+    }
+
     int32_t parsedLength;
     CharString localeID = ulocimp_forLanguageTag(
             tag.data(),
@@ -2284,6 +2306,8 @@ Locale::forLanguageTag(StringPiece tag, UErrorCode& status)
     result.init(localeID.data(), /*canonicalize=*/false);
     if (result.isBogus()) {
         status = U_ILLEGAL_ARGUMENT_ERROR;
+    } else {
+        LocaleIDCache::put(LocaleIDCache::FOR_LANGUAGE_TAG, tag, localeID.toStringPiece());
     }
     return result;
 }
@@ -34,6 +34,7 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "loccache.h"
 #include "loclikelysubtags.h"
 #include "ulocimp.h"
 
@@ -270,6 +271,34 @@ _uloc_minimizeSubtags(const char* localeID,
         err);
 }
 
+/**
+ * Appends the cached result for the locale ID if there is one,
+ * otherwise computes it from the canonicalized locale ID, caches and appends it.
+ */
+template<typename Compute>
+void
+cachedLocaleID(icu::LocaleIDCache::Kind kind,
+               const char* localeID,
+               icu::ByteSink& sink,
+               UErrorCode& status,
+               Compute compute) {
+    icu::CharString result;
+    if (icu::LocaleIDCache::get(kind, localeID, result, status)) {
+        sink.Append(result.data(), result.length());
+        return;
+    }
+    icu::CharString localeBuffer = ulocimp_canonicalize(localeID, status);
+    {
+        icu::CharStringByteSink resultSink(&result);
+        compute(localeBuffer.data(), resultSink, status);
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+    icu::LocaleIDCache::put(kind, localeID, result.toStringPiece());
+    sink.Append(result.data(), result.length());
+}
+
 }  // namespace
 
 U_CAPI int32_t U_EXPORT2
@@ -303,8 +332,10 @@ ulocimp_addLikelySubtags(const char* localeID,
     if (localeID == nullptr) {
         localeID = uloc_getDefault();
     }
-    icu::CharString localeBuffer = ulocimp_canonicalize(localeID, status);
-    _uloc_addLikelySubtags(localeBuffer.data(), sink, status);
+    cachedLocaleID(icu::LocaleIDCache::ADD_LIKELY_SUBTAGS, localeID, sink, status,
+                   [](const char* canonical, icu::ByteSink& sink, UErrorCode& status) {
+                       _uloc_addLikelySubtags(canonical, sink, status);
+                   });
 }
 
 U_CAPI int32_t U_EXPORT2
@@ -340,8 +371,12 @@ ulocimp_minimizeSubtags(const char* localeID,
     if (localeID == nullptr) {
         localeID = uloc_getDefault();
     }
-    icu::CharString localeBuffer = ulocimp_canonicalize(localeID, status);
-    _uloc_minimizeSubtags(localeBuffer.data(), sink, favorScript, status);
+    cachedLocaleID(favorScript ? icu::LocaleIDCache::MINIMIZE_SUBTAGS_FAVOR_SCRIPT
+                               : icu::LocaleIDCache::MINIMIZE_SUBTAGS,
+                   localeID, sink, status,
+                   [favorScript](const char* canonical, icu::ByteSink& sink, UErrorCode& status) {
+                       _uloc_minimizeSubtags(canonical, sink, favorScript, status);
+                   });
 }
 
 // Pairs of (language subtag, + or -) for finding out fast if common languages
@@ -51,6 +51,7 @@ Disclaimer and license
 #include "unicode/ustring.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "ustr_imp.h"
 #include "cstring.h"
 #include "cmemory.h"
@@ -175,6 +176,118 @@ namespace {
 constexpr int32_t ENCODE_MAX_CODE_UNITS=1000;
 constexpr int32_t DECODE_MAX_CHARS=2000;
 
+/*
+ * Appends the delimiter (if there are basic code points) and the encoded
+ * extended code points to the basic ones already written to dest.
+ * cpBuffer[] has one entry per source code point: 0 for basic ones,
+ * and the code point with the caseFlag in the sign bit for extended ones.
+ * Returns the total output length, or 0 with *pErrorCode set.
+ */
+template<typename Unit>
+int32_t
+encodeExtended(const int32_t *cpBuffer, int32_t srcCPCount,
+               Unit *dest, int32_t destLength, int32_t destCapacity,
+               UErrorCode *pErrorCode) {
+    int32_t n, delta, handledCPCount, basicLength, bias, j, m, q, k, t;
+
+    /* Finish the basic string - if it is not empty - with a delimiter. */
+    basicLength=destLength;
+    if(basicLength>0) {
+        if(destLength<destCapacity) {
+            dest[destLength]=DELIMITER;
+        }
+        ++destLength;
+    }
+
+    /*
+     * handledCPCount is the number of code points that have been handled
+     * basicLength is the number of basic code points
+     * destLength is the number of chars that have been output
+     */
+
+    /* Initialize the state: */
+    n=INITIAL_N;
+    delta=0;
+    bias=INITIAL_BIAS;
+
+    /* Main encoding loop: */
+    for(handledCPCount=basicLength; handledCPCount<srcCPCount; /* no op */) {
+        /*
+         * All non-basic code points < n have been handled already.
+         * Find the next larger one:
+         */
+        for(m=0x7fffffff, j=0; j<srcCPCount; ++j) {
+            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
+            if(n<=q && q<m) {
+                m=q;
+            }
+        }
+
+        /*
+         * Increase delta enough to advance the decoder's
+         * <n,i> state to <m,0>, but guard against overflow:
+         */
+        if(m-n>(0x7fffffff-handledCPCount-delta)/(handledCPCount+1)) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+        delta+=(m-n)*(handledCPCount+1);
+        n=m;
+
+        /* Encode a sequence of same code points n */
+        for(j=0; j<srcCPCount; ++j) {
+            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
+            if(q<n) {
+                ++delta;
+            } else if(q==n) {
+                /* Represent delta as a generalized variable-length integer: */
+                for(q=delta, k=BASE; /* no condition */; k+=BASE) {
+
+                    /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
+
+                    t=k-bias;
+                    if(t<TMIN) {
+                        t=TMIN;
+                    } else if(t>TMAX) {
+                        t=TMAX;
+                    }
+                    */
+
+                    t=k-bias;
+                    if(t<TMIN) {
+                        t=TMIN;
+                    } else if(k>=(bias+TMAX)) {
+                        t=TMAX;
+                    }
+
+                    if(q<t) {
+                        break;
+                    }
+
+                    if(destLength<destCapacity) {
+                        dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
+                    }
+                    ++destLength;
+                    q=(q-t)/(BASE-t);
+                }
+
+                if(destLength<destCapacity) {
+                    dest[destLength] = digitToBasic(q, cpBuffer[j] < 0);
+                }
+                ++destLength;
+                bias = adaptBias(delta, handledCPCount + 1, handledCPCount == basicLength);
+                delta=0;
+                ++handledCPCount;
+            }
+        }
+
+        ++delta;
+        ++n;
+    }
+
+    return destLength;
+}
+
 }  // namespace
 
 // encode
@@ -185,7 +298,7 @@ u_strToPunycode(const char16_t *src, int32_t srcLength,
                 UErrorCode *pErrorCode) {
 
     int32_t cpBuffer[ENCODE_MAX_CODE_UNITS];
-    int32_t n, delta, handledCPCount, basicLength, destLength, bias, j, m, q, k, t, srcCPCount;
+    int32_t n, destLength, j, srcCPCount;
     char16_t c, c2;
 
     /* argument checking */
@@ -271,102 +384,63 @@ u_strToPunycode(const char16_t *src, int32_t srcLength,
         }
     }
 
-    /* Finish the basic string - if it is not empty - with a delimiter. */
-    basicLength=destLength;
-    if(basicLength>0) {
-        if(destLength<destCapacity) {
-            dest[destLength]=DELIMITER;
-        }
-        ++destLength;
+    destLength=encodeExtended(cpBuffer, srcCPCount, dest, destLength, destCapacity, pErrorCode);
+
+    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+U_CAPI int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode) {
+
+    int32_t cpBuffer[ENCODE_MAX_CODE_UNITS];
+    int32_t destLength, j, srcCPCount, utf16Length;
+    UChar32 c;
+
+    /* argument checking */
+    if(pErrorCode==nullptr || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if(src==nullptr || srcLength<0 || destCapacity<0 || (dest==nullptr && destCapacity!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
     }
 
     /*
-     * handledCPCount is the number of code points that have been handled
-     * basicLength is the number of basic code points
-     * destLength is the number of chars that have been output
+     * Handle the basic code points and
+     * convert extended ones to UTF-32 in cpBuffer.
+     * Limit the length in UTF-16 code units, like u_strToPunycode(),
+     * which also bounds the number of code points in cpBuffer.
      */
-
-    /* Initialize the state: */
-    n=INITIAL_N;
-    delta=0;
-    bias=INITIAL_BIAS;
-
-    /* Main encoding loop: */
-    for(handledCPCount=basicLength; handledCPCount<srcCPCount; /* no op */) {
-        /*
-         * All non-basic code points < n have been handled already.
-         * Find the next larger one:
-         */
-        for(m=0x7fffffff, j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(n<=q && q<m) {
-                m=q;
-            }
+    srcCPCount=destLength=utf16Length=0;
+    for(j=0; j<srcLength;) {
+        U8_NEXT(src, j, srcLength, c);
+        if(c<0) {
+            /* error: ill-formed UTF-8 */
+            *pErrorCode=U_INVALID_CHAR_FOUND;
+            return 0;
         }
-
-        /*
-         * Increase delta enough to advance the decoder's
-         * <n,i> state to <m,0>, but guard against overflow:
-         */
-        if(m-n>(0x7fffffff-handledCPCount-delta)/(handledCPCount+1)) {
-            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        utf16Length+=U16_LENGTH(c);
+        if(utf16Length>ENCODE_MAX_CODE_UNITS) {
+            *pErrorCode=U_INPUT_TOO_LONG_ERROR;
             return 0;
         }
-        delta+=(m-n)*(handledCPCount+1);
-        n=m;
-
-        /* Encode a sequence of same code points n */
-        for(j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(q<n) {
-                ++delta;
-            } else if(q==n) {
-                /* Represent delta as a generalized variable-length integer: */
-                for(q=delta, k=BASE; /* no condition */; k+=BASE) {
-
-                    /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
-
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(t>TMAX) {
-                        t=TMAX;
-                    }
-                    */
-
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(k>=(bias+TMAX)) {
-                        t=TMAX;
-                    }
-
-                    if(q<t) {
-                        break;
-                    }
-
-                    if(destLength<destCapacity) {
-                        dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
-                    }
-                    ++destLength;
-                    q=(q-t)/(BASE-t);
-                }
-
-                if(destLength<destCapacity) {
-                    dest[destLength] = digitToBasic(q, cpBuffer[j] < 0);
-                }
-                ++destLength;
-                bias = adaptBias(delta, handledCPCount + 1, handledCPCount == basicLength);
-                delta=0;
-                ++handledCPCount;
+        if(IS_BASIC(c)) {
+            cpBuffer[srcCPCount++]=0;
+            if(destLength<destCapacity) {
+                dest[destLength]=(char)c;
             }
+            ++destLength;
+        } else {
+            cpBuffer[srcCPCount++]=c;
         }
-
-        ++delta;
-        ++n;
     }
 
-    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+    destLength=encodeExtended(cpBuffer, srcCPCount, dest, destLength, destCapacity, pErrorCode);
+
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
 }
 
 // decode
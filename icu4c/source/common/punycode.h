@@ -71,6 +71,26 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
                 const UBool *caseFlags,
                 UErrorCode *pErrorCode);
 
+/**
+ * u_strToPunycode() for UTF-8 input, without case flags.
+ * Writes the same ASCII characters as u_strToPunycode() would for the UTF-16 form of src.
+ *
+ * @param src Input UTF-8 string. Must be well-formed and not NUL-terminated.
+ * @param srcLength Number of bytes in src.
+ * @param dest Output Punycode array.
+ * @param destCapacity Size of dest.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   U_INVALID_CHAR_FOUND if src contains an ill-formed sequence.
+ *                   U_INPUT_TOO_LONG_ERROR if src is too long.
+ * @return Number of ASCII characters in puny.
+ *
+ * @see u_strToPunycode
+ */
+U_CAPI int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode);
+
 /**
  * u_strFromPunycode() converts Punycode to Unicode.
  * The Unicode string will be at most as long (in UChars)
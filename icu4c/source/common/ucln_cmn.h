@@ -36,6 +36,7 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_BREAKITERATOR,
     UCLN_COMMON_RBBI,
     UCLN_COMMON_SERVICE,
+    UCLN_COMMON_LOCALE_ID_CACHE,
     UCLN_COMMON_LOCALE_KEY_TYPE,
     UCLN_COMMON_LOCALE,
     UCLN_COMMON_LOCALE_ALIAS,
@@ -33,9 +33,14 @@
 #include "unicode/uidna.h"
 #include "unicode/unistr.h"
 
+struct UHashtable;
+
 U_NAMESPACE_BEGIN
 
 class IDNAInfo;
+#ifndef U_HIDE_DRAFT_API
+class IDNALabelCache;
+#endif  // U_HIDE_DRAFT_API
 
 /**
  * Abstract base class for IDNA processing.
@@ -261,7 +266,101 @@ class U_COMMON_API IDNA : public UObject {
     virtual void
     nameToUnicodeUTF8(StringPiece name, ByteSink &dest,
                       IDNAInfo &info, UErrorCode &errorCode) const;
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Converts an array of whole domain names into their ASCII forms for DNS lookup.
+     * Same results as nameToASCII_UTF8() for each of the names,
+     * but intended for high volumes of host names, where many of them share labels.
+     *
+     * The results are written one after another, without separators,
+     * into one buffer; limits[i] is the end of the result for names[i]
+     * and the start of the next one.
+     * The buffer is NUL-terminated if there is room for the NUL.
+     *
+     * If a cache is passed in, then the results for single labels are looked up in
+     * and added to it, so that common labels like "www" or "com"
+     * (and "xn--" labels, and labels that need mapping or Punycode encoding)
+     * are processed only once.
+     *
+     * @param names Input domain names
+     * @param count Number of names
+     * @param dest Destination buffer for the results;
+     *             can be nullptr if capacity is 0, for preflighting
+     * @param capacity Size of the destination buffer in bytes
+     * @param limits Receives count result limits in dest
+     * @param errors If not nullptr, receives count bit sets of processing errors
+     *               like IDNAInfo::getErrors() for the names
+     * @param cache The label cache to use, or nullptr
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_BUFFER_OVERFLOW_ERROR if the results do not fit
+     *                  into the buffer; limits and errors are set anyway.
+     * @return The total length of the results, not counting the terminating NUL.
+     * @draft ICU 79
+     */
+    int32_t
+    nameToASCIIBatch(const StringPiece names[], int32_t count,
+                     char *dest, int32_t capacity,
+                     int32_t limits[], uint32_t errors[],
+                     IDNALabelCache *cache, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+};
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A bounded cache of single-label results for IDNA::nameToASCIIBatch().
+ * It can be reused across calls but must not be used concurrently:
+ * Use one cache per thread.
+ *
+ * The cached results depend on the IDNA options, not on the IDNA instance.
+ * When a cache is used with an instance with different options than before,
+ * it is cleared first.
+ * @draft ICU 79
+ */
+class U_COMMON_API IDNALabelCache : public UMemory {
+public:
+    /**
+     * Constructor.
+     * @param capacity The maximum number of labels in the cache;
+     *                 when it is full, it is cleared.
+     * @param errorCode Standard ICU error code.
+     *                  Set to U_ILLEGAL_ARGUMENT_ERROR if capacity<=0.
+     * @draft ICU 79
+     */
+    IDNALabelCache(int32_t capacity, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 79
+     */
+    ~IDNALabelCache();
+
+    /**
+     * Removes all labels from the cache.
+     * @draft ICU 79
+     */
+    void clear();
+
+    /**
+     * @return the number of labels in the cache
+     * @draft ICU 79
+     */
+    int32_t size() const;
+
+private:
+    friend class UTS46;
+
+    IDNALabelCache(const IDNALabelCache &other) = delete;  // no copying
+    IDNALabelCache &operator=(const IDNALabelCache &other) = delete;  // no copying
+
+    UHashtable *map;  // char * label -> LabelCacheEntry *
+    int32_t capacity;
+    uint32_t options;
 };
+#endif  // U_HIDE_DRAFT_API
 
 class UTS46;
 
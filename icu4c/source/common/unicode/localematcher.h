@@ -138,6 +138,8 @@ struct LSR;
 class LikelySubtags;
 class LocaleDistance;
 class LocaleLsrIterator;
+class LocaleMatcherListCache;
+class SupportedLanguageIndex;
 class UVector;
 
 /**
@@ -700,8 +702,12 @@ class U_COMMON_API LocaleMatcher : public UMemory {
     const LSR **supportedLSRs;
     int32_t *supportedIndexes;
     int32_t supportedLSRsLength;
+    // supportedLSRs grouped by language, if there are enough of them.
+    SupportedLanguageIndex *supportedLanguageIndex;
     Locale *ownedDefaultLocale;
     const Locale *defaultLocale;
+    // Recent getBestMatchForListString() results.
+    LocaleMatcherListCache *listCache;
 };
 
 U_NAMESPACE_END
@@ -374,6 +374,7 @@
 #define u_strToJavaModifiedUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToJavaModifiedUTF8)
 #define u_strToLower U_ICU_ENTRY_POINT_RENAME(u_strToLower)
 #define u_strToPunycode U_ICU_ENTRY_POINT_RENAME(u_strToPunycode)
+#define u_strToPunycodeUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToPunycodeUTF8)
 #define u_strToTitle U_ICU_ENTRY_POINT_RENAME(u_strToTitle)
 #define u_strToUTF32 U_ICU_ENTRY_POINT_RENAME(u_strToUTF32)
 #define u_strToUTF32WithSub U_ICU_ENTRY_POINT_RENAME(u_strToUTF32WithSub)
@@ -522,6 +523,7 @@
 #define ucal_clearField U_ICU_ENTRY_POINT_RENAME(ucal_clearField)
 #define ucal_clone U_ICU_ENTRY_POINT_RENAME(ucal_clone)
 #define ucal_close U_ICU_ENTRY_POINT_RENAME(ucal_close)
+#define ucal_computeFieldsBatch U_ICU_ENTRY_POINT_RENAME(ucal_computeFieldsBatch)
 #define ucal_countAvailable U_ICU_ENTRY_POINT_RENAME(ucal_countAvailable)
 #define ucal_equivalentTo U_ICU_ENTRY_POINT_RENAME(ucal_equivalentTo)
 #define ucal_get U_ICU_ENTRY_POINT_RENAME(ucal_get)
@@ -854,6 +856,8 @@
 #define udat_countSymbols U_ICU_ENTRY_POINT_RENAME(udat_countSymbols)
 #define udat_format U_ICU_ENTRY_POINT_RENAME(udat_format)
 #define udat_formatCalendar U_ICU_ENTRY_POINT_RENAME(udat_formatCalendar)
+#define udat_formatBatch U_ICU_ENTRY_POINT_RENAME(udat_formatBatch)
+#define udat_formatBatchUTF8 U_ICU_ENTRY_POINT_RENAME(udat_formatBatchUTF8)
 #define udat_formatCalendarForFields U_ICU_ENTRY_POINT_RENAME(udat_formatCalendarForFields)
 #define udat_formatForFields U_ICU_ENTRY_POINT_RENAME(udat_formatForFields)
 #define udat_get2DigitYearStart U_ICU_ENTRY_POINT_RENAME(udat_get2DigitYearStart)
@@ -1318,6 +1322,7 @@
 #define unum_parse U_ICU_ENTRY_POINT_RENAME(unum_parse)
 #define unum_parseDecimal U_ICU_ENTRY_POINT_RENAME(unum_parseDecimal)
 #define unum_parseDouble U_ICU_ENTRY_POINT_RENAME(unum_parseDouble)
+#define unum_parseDoubleBatch U_ICU_ENTRY_POINT_RENAME(unum_parseDoubleBatch)
 #define unum_parseDoubleCurrency U_ICU_ENTRY_POINT_RENAME(unum_parseDoubleCurrency)
 #define unum_parseInt64 U_ICU_ENTRY_POINT_RENAME(unum_parseInt64)
 #define unum_parseToUFormattable U_ICU_ENTRY_POINT_RENAME(unum_parseToUFormattable)
@@ -1723,7 +1728,9 @@
 #define usearch_getBreakIterator U_ICU_ENTRY_POINT_RENAME(usearch_getBreakIterator)
 #define usearch_getCollator U_ICU_ENTRY_POINT_RENAME(usearch_getCollator)
 #define usearch_getMatchedLength U_ICU_ENTRY_POINT_RENAME(usearch_getMatchedLength)
+#define usearch_getMatchedLengthUTF8 U_ICU_ENTRY_POINT_RENAME(usearch_getMatchedLengthUTF8)
 #define usearch_getMatchedStart U_ICU_ENTRY_POINT_RENAME(usearch_getMatchedStart)
+#define usearch_getMatchedStartUTF8 U_ICU_ENTRY_POINT_RENAME(usearch_getMatchedStartUTF8)
 #define usearch_getMatchedText U_ICU_ENTRY_POINT_RENAME(usearch_getMatchedText)
 #define usearch_getOffset U_ICU_ENTRY_POINT_RENAME(usearch_getOffset)
 #define usearch_getPattern U_ICU_ENTRY_POINT_RENAME(usearch_getPattern)
@@ -1747,6 +1754,7 @@
 #define usearch_setOffset U_ICU_ENTRY_POINT_RENAME(usearch_setOffset)
 #define usearch_setPattern U_ICU_ENTRY_POINT_RENAME(usearch_setPattern)
 #define usearch_setText U_ICU_ENTRY_POINT_RENAME(usearch_setText)
+#define usearch_setUTF8Text U_ICU_ENTRY_POINT_RENAME(usearch_setUTF8Text)
 #define uset_add U_ICU_ENTRY_POINT_RENAME(uset_add)
 #define uset_addAll U_ICU_ENTRY_POINT_RENAME(uset_addAll)
 #define uset_addAllCodePoints U_ICU_ENTRY_POINT_RENAME(uset_addAllCodePoints)
@@ -1858,6 +1866,8 @@
 #define uspoof_getRecommendedUnicodeSet U_ICU_ENTRY_POINT_RENAME(uspoof_getRecommendedUnicodeSet)
 #define uspoof_getRestrictionLevel U_ICU_ENTRY_POINT_RENAME(uspoof_getRestrictionLevel)
 #define uspoof_getSkeleton U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeleton)
+#define uspoof_getSkeletonBatchUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonBatchUTF8)
+#define uspoof_getSkeletonByteSink U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonByteSink)
 #define uspoof_getSkeletonUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUTF8)
 #define uspoof_getSkeletonUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUnicodeString)
 #define uspoof_internalInitStatics U_ICU_ENTRY_POINT_RENAME(uspoof_internalInitStatics)
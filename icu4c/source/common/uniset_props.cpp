@@ -268,7 +268,7 @@ class UnicodeSet::Lexer {
 
         UChar32 codePoint(UErrorCode &errorCode) const {
             if (!U_FAILURE(errorCode)) {
-                errorCode = errorCode;
+                errorCode = errorCode_;
             }
             return codePoint_;
         }
@@ -315,7 +315,7 @@ class UnicodeSet::Lexer {
       private:
         Lexer &lexer_;
         RuleCharacterIterator::Pos after_;
-        UErrorCode errorCode_;
+        UErrorCode errorCode_ = U_ZERO_ERROR;
         UChar32 codePoint_;
         UBool escaped_;
         // `std::nullopt` if we have not yet called `lookupMatcher`, otherwise the result of
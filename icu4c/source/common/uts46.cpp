@@ -24,11 +24,15 @@
 #include "unicode/uscript.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "bytesinkutil.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "punycode.h"
 #include "ubidi_props.h"
+#include "uhash.h"
+#include "ustr_imp.h"
 
 // Note about tests for UIDNA_ERROR_DOMAIN_NAME_TOO_LONG:
 //
@@ -60,6 +64,47 @@ isASCIIString(const UnicodeString &dest) {
     return true;
 }
 
+static inline UBool
+isASCIIString(StringPiece dest) {
+    const char *s=dest.data();
+    const char *limit=s+dest.length();
+    while(s<limit) {
+        if(static_cast<int8_t>(*s++)<0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Code point iteration for the label checks which work on both UTF-16 and UTF-8 labels.
+static inline UChar32
+nextCodePoint(const char16_t *s, int32_t &i, int32_t length) {
+    UChar32 c;
+    U16_NEXT(s, i, length, c);
+    return c;
+}
+
+static inline UChar32
+nextCodePoint(const uint8_t *s, int32_t &i, int32_t length) {
+    UChar32 c;
+    U8_NEXT_OR_FFFD(s, i, length, c);
+    return c;
+}
+
+static inline UChar32
+previousCodePoint(const char16_t *s, int32_t &i) {
+    UChar32 c;
+    U16_PREV(s, 0, i, c);
+    return c;
+}
+
+static inline UChar32
+previousCodePoint(const uint8_t *s, int32_t &i) {
+    UChar32 c;
+    U8_PREV_OR_FFFD(s, 0, i, c);
+    return c;
+}
+
 static UBool
 isASCIIOkBiDi(const char16_t *s, int32_t length);
 
@@ -149,6 +194,12 @@ class UTS46 : public IDNA {
     nameToUnicodeUTF8(StringPiece name, ByteSink &dest,
                       IDNAInfo &info, UErrorCode &errorCode) const override;
 
+    int32_t
+    nameToASCIIBatch(const StringPiece names[], int32_t count,
+                     char *dest, int32_t capacity,
+                     int32_t limits[], uint32_t errors[],
+                     IDNALabelCache *cache, UErrorCode &errorCode) const;
+
 private:
     UnicodeString &
     process(const UnicodeString &src,
@@ -156,10 +207,11 @@ class UTS46 : public IDNA {
             UnicodeString &dest,
             IDNAInfo &info, UErrorCode &errorCode) const;
 
+    // The cache is only used for toASCII of whole names.
     void
     processUTF8(StringPiece src,
                 UBool isLabel, UBool toASCII,
-                ByteSink &dest,
+                ByteSink &dest, IDNALabelCache *cache,
                 IDNAInfo &info, UErrorCode &errorCode) const;
 
     UnicodeString &
@@ -169,6 +221,22 @@ class UTS46 : public IDNA {
                    UnicodeString &dest,
                    IDNAInfo &info, UErrorCode &errorCode) const;
 
+    // Same as processUnicode() but in UTF-8, for all of src.
+    void
+    processUnicodeUTF8(StringPiece src,
+                       UBool isLabel, UBool toASCII,
+                       CharString &dest,
+                       IDNAInfo &info, UErrorCode &errorCode) const;
+
+    // Same as processUnicodeUTF8(src, false, true, ...) but with the results of the labels
+    // between full stops looked up in and added to the cache.
+    // Returns false without changing dest and info if some label cannot be
+    // processed on its own; then processUnicodeUTF8() must be used instead.
+    UBool
+    processLabelsCached(StringPiece src,
+                        CharString &dest, IDNALabelCache &cache,
+                        IDNAInfo &info, UErrorCode &errorCode) const;
+
     // returns the new dest.length()
     int32_t
     mapDevChars(UnicodeString &dest, int32_t labelStart, int32_t mappingStart,
@@ -180,19 +248,29 @@ class UTS46 : public IDNA {
                  int32_t labelStart, int32_t labelLength,
                  UBool toASCII,
                  IDNAInfo &info, UErrorCode &errorCode) const;
+    // Appends the processed label to dest.
+    void
+    processLabelUTF8(StringPiece label,
+                     UBool toASCII, UBool doMapDevChars,
+                     CharString &dest,
+                     IDNAInfo &info, UErrorCode &errorCode) const;
     int32_t
     markBadACELabel(UnicodeString &dest,
                     int32_t labelStart, int32_t labelLength,
                     UBool toASCII, IDNAInfo &info, UErrorCode &errorCode) const;
 
+    // The label checks are instantiated for UTF-16 (char16_t) and UTF-8 (uint8_t).
+    template<typename Unit>
     void
-    checkLabelBiDi(const char16_t *label, int32_t labelLength, IDNAInfo &info) const;
+    checkLabelBiDi(const Unit *label, int32_t labelLength, IDNAInfo &info) const;
 
+    template<typename Unit>
     UBool
-    isLabelOkContextJ(const char16_t *label, int32_t labelLength) const;
+    isLabelOkContextJ(const Unit *label, int32_t labelLength) const;
 
+    template<typename Unit>
     void
-    checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &info) const;
+    checkLabelContextO(const Unit *label, int32_t labelLength, IDNAInfo &info) const;
 
     const Normalizer2 &uts46Norm2;  // uts46.nrm
     uint32_t options;
@@ -256,25 +334,160 @@ UTS46::nameToUnicode(const UnicodeString &name, UnicodeString &dest,
 void
 UTS46::labelToASCII_UTF8(StringPiece label, ByteSink &dest,
                          IDNAInfo &info, UErrorCode &errorCode) const {
-    processUTF8(label, true, true, dest, info, errorCode);
+    processUTF8(label, true, true, dest, nullptr, info, errorCode);
 }
 
 void
 UTS46::labelToUnicodeUTF8(StringPiece label, ByteSink &dest,
                           IDNAInfo &info, UErrorCode &errorCode) const {
-    processUTF8(label, true, false, dest, info, errorCode);
+    processUTF8(label, true, false, dest, nullptr, info, errorCode);
 }
 
 void
 UTS46::nameToASCII_UTF8(StringPiece name, ByteSink &dest,
                         IDNAInfo &info, UErrorCode &errorCode) const {
-    processUTF8(name, false, true, dest, info, errorCode);
+    processUTF8(name, false, true, dest, nullptr, info, errorCode);
 }
 
 void
 UTS46::nameToUnicodeUTF8(StringPiece name, ByteSink &dest,
                          IDNAInfo &info, UErrorCode &errorCode) const {
-    processUTF8(name, false, false, dest, info, errorCode);
+    processUTF8(name, false, false, dest, nullptr, info, errorCode);
+}
+
+// Batch processing -------------------------------------------------------- ***
+
+namespace {
+
+// Appends the results for the names one after another.
+// processName(name, sink, info) does the work for one name.
+template<typename ProcessName>
+int32_t
+processBatch(const StringPiece names[], int32_t count,
+             char *dest, int32_t capacity,
+             int32_t limits[], uint32_t errors[],
+             UErrorCode &errorCode, ProcessName processName) {
+    if(U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if( count<0 || (count>0 && (names==nullptr || limits==nullptr)) ||
+        capacity<0 || (dest==nullptr && capacity!=0)
+    ) {
+        errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t length=0;
+    for(int32_t i=0; i<count; ++i) {
+        // After an overflow, only count the lengths.
+        CheckedArrayByteSink sink(length<capacity ? dest+length : nullptr,
+                                  length<capacity ? capacity-length : 0);
+        IDNAInfo info;
+        processName(names[i], sink, info);
+        if(U_FAILURE(errorCode)) {
+            return 0;
+        }
+        length+=sink.NumberOfBytesAppended();
+        limits[i]=length;
+        if(errors!=nullptr) {
+            errors[i]=info.getErrors();
+        }
+    }
+    return u_terminateChars(dest, capacity, length, &errorCode);
+}
+
+}  // namespace
+
+int32_t
+IDNA::nameToASCIIBatch(const StringPiece names[], int32_t count,
+                       char *dest, int32_t capacity,
+                       int32_t limits[], uint32_t errors[],
+                       IDNALabelCache *cache, UErrorCode &errorCode) const {
+    const UTS46 *uts46=dynamic_cast<const UTS46 *>(this);
+    if(uts46!=nullptr) {
+        return uts46->nameToASCIIBatch(names, count, dest, capacity, limits, errors,
+                                       cache, errorCode);
+    }
+    return processBatch(names, count, dest, capacity, limits, errors, errorCode,
+                        [&](StringPiece name, ByteSink &sink, IDNAInfo &info) {
+        nameToASCII_UTF8(name, sink, info, errorCode);
+    });
+}
+
+int32_t
+UTS46::nameToASCIIBatch(const StringPiece names[], int32_t count,
+                        char *dest, int32_t capacity,
+                        int32_t limits[], uint32_t errors[],
+                        IDNALabelCache *cache, UErrorCode &errorCode) const {
+    if(cache!=nullptr && U_SUCCESS(errorCode)) {
+        if(cache->map==nullptr) {
+            errorCode=U_ILLEGAL_ARGUMENT_ERROR;  // The cache constructor failed.
+            return 0;
+        }
+        if(cache->options!=options) {
+            cache->clear();
+            cache->options=options;
+        }
+    }
+    return processBatch(names, count, dest, capacity, limits, errors, errorCode,
+                        [&](StringPiece name, ByteSink &sink, IDNAInfo &info) {
+        processUTF8(name, false, true, sink, cache, info, errorCode);
+    });
+}
+
+namespace {
+
+// Labels longer than this are not cached.
+// (The longest valid label is 63 ASCII characters,
+// which can come from more than 63 bytes of input.)
+constexpr int32_t kMaxCachedLabelLength=255;
+
+// One cached toASCII label result.
+// The memory block is followed by the NUL-terminated input label (the hash key)
+// and then the result bytes.
+struct LabelCacheEntry {
+    uint32_t labelErrors;
+    UBool isTransDiff;
+    UBool isBiDi;
+    UBool isOkBiDi;
+    int32_t keyLength;
+    int32_t resultLength;
+
+    const char *key() const { return reinterpret_cast<const char *>(this+1); }
+    const char *result() const { return key()+keyLength+1; }
+};
+
+}  // namespace
+
+IDNALabelCache::IDNALabelCache(int32_t cap, UErrorCode &errorCode)
+        : map(nullptr), capacity(cap), options(0) {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    if(cap<=0) {
+        errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // The keys are stored in the values.
+    map=uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        uhash_setValueDeleter(map, uprv_free);
+    }
+}
+
+IDNALabelCache::~IDNALabelCache() {
+    uhash_close(map);
+}
+
+void
+IDNALabelCache::clear() {
+    if(map!=nullptr) {
+        uhash_removeAll(map);
+    }
+}
+
+int32_t
+IDNALabelCache::size() const {
+    return map!=nullptr ? uhash_count(map) : 0;
 }
 
 // UTS #46 data for ASCII characters.
@@ -406,7 +619,7 @@ UTS46::process(const UnicodeString &src,
 void
 UTS46::processUTF8(StringPiece src,
                    UBool isLabel, UBool toASCII,
-                   ByteSink &dest,
+                   ByteSink &dest, IDNALabelCache *cache,
                    IDNAInfo &info, UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) {
         return;
@@ -424,7 +637,7 @@ UTS46::processUTF8(StringPiece src,
         dest.Flush();
         return;
     }
-    UnicodeString destString;
+    CharString destString;
     int32_t labelStart=0;
     if(srcLength<=256) {  // length of stackArray[]
         // ASCII fastpath
@@ -491,26 +704,30 @@ UTS46::processUTF8(StringPiece src,
             }
         }
         info.errors|=info.labelErrors;
-        // Convert the processed ASCII prefix of the current label to UTF-16.
-        int32_t mappingStart=i-labelStart;
-        destString=UnicodeString::fromUTF8(StringPiece(destArray+labelStart, mappingStart));
-        // Output the previous ASCII labels and process the rest of src in UTF-16.
+        // Output the previous ASCII labels and process the rest of src,
+        // starting with the current label.
         dest.Append(destArray, labelStart);
-        processUnicode(UnicodeString::fromUTF8(StringPiece(src, labelStart)), 0, mappingStart,
-                       isLabel, toASCII,
-                       destString, info, errorCode);
+        StringPiece rest(src, labelStart);
+        if(cache==nullptr || !processLabelsCached(rest, destString, *cache, info, errorCode)) {
+            processUnicodeUTF8(rest,
+                               isLabel, toASCII,
+                               destString, info, errorCode);
+        }
     } else {
         // src is too long for the ASCII fastpath implementation.
-        processUnicode(UnicodeString::fromUTF8(src), 0, 0,
-                       isLabel, toASCII,
-                       destString, info, errorCode);
+        if(cache==nullptr || !processLabelsCached(src, destString, *cache, info, errorCode)) {
+            processUnicodeUTF8(src,
+                               isLabel, toASCII,
+                               destString, info, errorCode);
+        }
     }
-    destString.toUTF8(dest);  // calls dest.Flush()
+    dest.Append(destString.data(), destString.length());
+    dest.Flush();
     if(toASCII && !isLabel) {
         // length==labelStart==254 means that there is a trailing dot (ok) and
         // destString is empty (do not index at 253-labelStart).
         int32_t length=labelStart+destString.length();
-        if( length>=254 && isASCIIString(destString) &&
+        if( length>=254 && isASCIIString(destString.toStringPiece()) &&
             (length>254 ||
              (labelStart<254 && destString[253-labelStart]!=0x2e))
         ) {
@@ -598,6 +815,158 @@ UTS46::processUnicode(const UnicodeString &src,
     return dest;
 }
 
+void
+UTS46::processUnicodeUTF8(StringPiece src,
+                          UBool isLabel, UBool toASCII,
+                          CharString &dest,
+                          IDNAInfo &info, UErrorCode &errorCode) const {
+    // Ill-formed sequences are passed through by the normalizer
+    // and replaced with U+FFFD in processLabelUTF8().
+    CharString normalized;
+    {
+        CharStringByteSink sink(&normalized);
+        uts46Norm2.normalizeUTF8(0, src, sink, nullptr, errorCode);
+    }
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    UBool doMapDevChars=
+        toASCII ? (options&UIDNA_NONTRANSITIONAL_TO_ASCII)==0 :
+                  (options&UIDNA_NONTRANSITIONAL_TO_UNICODE)==0;
+    const char *s=normalized.data();
+    int32_t length=normalized.length();
+    int32_t labelStart=0;
+    for(int32_t labelLimit=0;; ++labelLimit) {
+        if(labelLimit==length) {
+            // Permit an empty label at the end (0<labelStart==labelLimit==length is ok)
+            // but not an empty label elsewhere nor a completely empty domain name.
+            // processLabelUTF8() sets UIDNA_ERROR_EMPTY_LABEL when the label is empty.
+            if(0==labelStart || labelStart<labelLimit) {
+                processLabelUTF8(StringPiece(s+labelStart, labelLimit-labelStart),
+                                 toASCII, doMapDevChars, dest, info, errorCode);
+                info.errors|=info.labelErrors;
+            }
+            return;
+        }
+        if(s[labelLimit]==0x2e && !isLabel) {
+            processLabelUTF8(StringPiece(s+labelStart, labelLimit-labelStart),
+                             toASCII, doMapDevChars, dest, info, errorCode);
+            info.errors|=info.labelErrors;
+            info.labelErrors=0;
+            dest.append('.', errorCode);
+            if(U_FAILURE(errorCode)) {
+                return;
+            }
+            labelStart=labelLimit+1;
+        }
+    }
+}
+
+UBool
+UTS46::processLabelsCached(StringPiece src,
+                           CharString &dest, IDNALabelCache &cache,
+                           IDNAInfo &info, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) {
+        return true;
+    }
+    int32_t destStart=dest.length();
+    uint32_t errors=0;
+    UBool isTransDiff=false, isBiDi=false, isOkBiDi=true;
+    const char *s=src.data();
+    int32_t length=src.length();
+    int32_t labelStart=0;
+    for(int32_t labelLimit=0;; ++labelLimit) {
+        if(labelLimit<length && s[labelLimit]!=0x2e) {
+            continue;
+        }
+        int32_t labelLength=labelLimit-labelStart;
+        if(labelLength==0) {
+            // Permit an empty label at the end but not elsewhere,
+            // as in processUnicodeUTF8().
+            if(labelLimit<length || labelStart==0) {
+                errors|=UIDNA_ERROR_EMPTY_LABEL;
+            }
+        } else {
+            if( labelLength>kMaxCachedLabelLength ||
+                uprv_memchr(s+labelStart, 0, labelLength)!=nullptr
+            ) {
+                dest.truncate(destStart);
+                return false;
+            }
+            char key[kMaxCachedLabelLength+1];
+            uprv_memcpy(key, s+labelStart, labelLength);
+            key[labelLength]=0;
+            const LabelCacheEntry *entry=
+                static_cast<const LabelCacheEntry *>(uhash_get(cache.map, key));
+            if(entry==nullptr) {
+                // Normalization does not interact across a full stop,
+                // so a label can be mapped on its own,
+                // unless that results in an empty label or in more labels.
+                CharString normalized;
+                {
+                    CharStringByteSink sink(&normalized);
+                    uts46Norm2.normalizeUTF8(0, StringPiece(key, labelLength), sink, nullptr, errorCode);
+                }
+                if(U_FAILURE(errorCode)) {
+                    return true;
+                }
+                if( normalized.isEmpty() ||
+                    uprv_memchr(normalized.data(), 0x2e, normalized.length())!=nullptr
+                ) {
+                    dest.truncate(destStart);
+                    return false;
+                }
+                IDNAInfo labelInfo;
+                CharString result;
+                processLabelUTF8(normalized.toStringPiece(), true,
+                                 (options&UIDNA_NONTRANSITIONAL_TO_ASCII)==0,
+                                 result, labelInfo, errorCode);
+                if(U_FAILURE(errorCode)) {
+                    return true;
+                }
+                LabelCacheEntry *newEntry=static_cast<LabelCacheEntry *>(uprv_malloc(
+                    sizeof(LabelCacheEntry)+labelLength+1+result.length()));
+                if(newEntry==nullptr) {
+                    errorCode=U_MEMORY_ALLOCATION_ERROR;
+                    return true;
+                }
+                newEntry->labelErrors=labelInfo.labelErrors;
+                newEntry->isTransDiff=labelInfo.isTransDiff;
+                newEntry->isBiDi=labelInfo.isBiDi;
+                newEntry->isOkBiDi=labelInfo.isOkBiDi;
+                newEntry->keyLength=labelLength;
+                newEntry->resultLength=result.length();
+                char *bytes=const_cast<char *>(newEntry->key());
+                uprv_memcpy(bytes, key, labelLength+1);
+                uprv_memcpy(bytes+labelLength+1, result.data(), result.length());
+                if(uhash_count(cache.map)>=cache.capacity) {
+                    uhash_removeAll(cache.map);
+                }
+                uhash_put(cache.map, bytes, newEntry, &errorCode);  // deletes newEntry on failure
+                if(U_FAILURE(errorCode)) {
+                    return true;
+                }
+                entry=newEntry;
+            }
+            dest.append(entry->result(), entry->resultLength, errorCode);
+            errors|=entry->labelErrors;
+            isTransDiff|=entry->isTransDiff;
+            isBiDi|=entry->isBiDi;
+            isOkBiDi&=entry->isOkBiDi;
+        }
+        if(labelLimit==length) {
+            break;
+        }
+        dest.append('.', errorCode);
+        labelStart=labelLimit+1;
+    }
+    info.errors|=errors;
+    info.isTransDiff|=isTransDiff;
+    info.isBiDi|=isBiDi;
+    info.isOkBiDi&=isOkBiDi;
+    return true;
+}
+
 int32_t
 UTS46::mapDevChars(UnicodeString &dest, int32_t labelStart, int32_t mappingStart,
                    UErrorCode &errorCode) const {
@@ -918,6 +1287,193 @@ UTS46::processLabel(UnicodeString &dest,
                         *labelString, labelLength, errorCode);
 }
 
+void
+UTS46::processLabelUTF8(StringPiece label,
+                        UBool toASCII, UBool doMapDevChars,
+                        CharString &dest,
+                        IDNAInfo &info, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    // Replace ill-formed sequences with U+FFFD, and map deviation characters if requested.
+    // Copy the label only if something changes.
+    static const char fffd[]="\xef\xbf\xbd";
+    const uint8_t *s=reinterpret_cast<const uint8_t *>(label.data());
+    int32_t length=label.length();
+    CharString mapped;
+    int32_t unmappedStart=0;
+    UBool didMapDevChars=false;
+    for(int32_t i=0; i<length;) {
+        if(s[i]<0x80) {
+            ++i;
+            continue;
+        }
+        int32_t start=i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if(c<0) {
+            info.labelErrors|=UIDNA_ERROR_DISALLOWED;
+            mapped.append(label.data()+unmappedStart, start-unmappedStart, errorCode).
+                append(fffd, 3, errorCode);
+            unmappedStart=i;
+        } else if(c<=0x200d && (c==0xdf || c==0x3c2 || c>=0x200c)) {
+            info.isTransDiff=true;
+            if(doMapDevChars) {
+                mapped.append(label.data()+unmappedStart, start-unmappedStart, errorCode);
+                if(c==0xdf) {
+                    mapped.append("ss", 2, errorCode);  // Map sharp s to ss.
+                } else if(c==0x3c2) {
+                    mapped.append("\xcf\x83", 2, errorCode);  // Map final sigma to nonfinal sigma.
+                }  // else ignore/remove ZWNJ & ZWJ
+                unmappedStart=i;
+                didMapDevChars=true;
+            }
+        }
+    }
+    if(unmappedStart>0) {
+        mapped.append(label.data()+unmappedStart, length-unmappedStart, errorCode);
+        if(didMapDevChars) {
+            // Mapping deviation characters might have resulted in an un-NFC string.
+            CharString normalized;
+            CharStringByteSink sink(&normalized);
+            uts46Norm2.normalizeUTF8(0, mapped.toStringPiece(), sink, nullptr, errorCode);
+            mapped=std::move(normalized);
+        }
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        label=mapped.toStringPiece();
+        s=reinterpret_cast<const uint8_t *>(label.data());
+        length=label.length();
+    }
+    if(length>=4 && s[0]==0x78 && s[1]==0x6e && s[2]==0x2d && s[3]==0x2d) {
+        // Label starts with "xn--": Decode and check it in UTF-16.
+        UnicodeString label16=UnicodeString::fromUTF8(label);
+        int32_t newLength=processLabel(label16, 0, label16.length(), toASCII, info, errorCode);
+        if(U_SUCCESS(errorCode)) {
+            CharStringByteSink sink(&dest);
+            label16.tempSubString(0, newLength).toUTF8(sink);
+        }
+        return;
+    }
+    // Validity check
+    if(length==0) {
+        info.labelErrors|=UIDNA_ERROR_EMPTY_LABEL;
+        return;
+    }
+    // length>0
+    // label starts with "??--"
+    // (Check UTF-16 indexes 2 and 3 as in processLabel().)
+    {
+        int32_t i=0, length16=0;
+        while(length16<2 && i<length) {
+            length16+=U16_LENGTH(nextCodePoint(s, i, length));
+        }
+        if(length16==2 && (i+1)<length && s[i]==0x2d && s[i+1]==0x2d) {
+            info.labelErrors|=UIDNA_ERROR_HYPHEN_3_4;
+        }
+    }
+    if(s[0]==0x2d) {
+        // label starts with "-"
+        info.labelErrors|=UIDNA_ERROR_LEADING_HYPHEN;
+    }
+    if(s[length-1]==0x2d) {
+        // label ends with "-"
+        info.labelErrors|=UIDNA_ERROR_TRAILING_HYPHEN;
+    }
+    // Copy the label to dest, and handle the STD3 restriction to LDH characters (if set),
+    // U+FFFD which indicates disallowed characters, dots from the input to a single-label
+    // function, and a leading combining mark, as in processLabel().
+    // Unchanged runs of text are appended in one piece.
+    int32_t destLabelStart=dest.length();
+    UChar32 oredChars=0;
+    UBool disallowNonLDHDot=(options&UIDNA_USE_STD3_RULES)!=0;
+    int32_t copyStart=0;
+    for(int32_t i=0; i<length;) {
+        int32_t start=i;
+        UChar32 c=nextCodePoint(s, i, length);
+        if(c<=0x7f) {
+            if(c==0x2e) {
+                info.labelErrors|=UIDNA_ERROR_LABEL_HAS_DOT;
+            } else if(disallowNonLDHDot && asciiData[c]<0) {
+                info.labelErrors|=UIDNA_ERROR_DISALLOWED;
+            } else {
+                continue;
+            }
+        } else {
+            oredChars|=c;
+            if(start==0 && (U_GET_GC_MASK(c)&U_GC_M_MASK)!=0) {
+                info.labelErrors|=UIDNA_ERROR_LEADING_COMBINING_MARK;
+            } else {
+                if(c==0xfffd) {
+                    info.labelErrors|=UIDNA_ERROR_DISALLOWED;
+                }
+                continue;
+            }
+        }
+        dest.append(label.data()+copyStart, start-copyStart, errorCode).append(fffd, 3, errorCode);
+        copyStart=i;
+    }
+    dest.append(label.data()+copyStart, length-copyStart, errorCode);
+    if(U_FAILURE(errorCode)) {
+        return;
+    }
+    const uint8_t *destLabel=reinterpret_cast<const uint8_t *>(dest.data()+destLabelStart);
+    int32_t destLabelLength=dest.length()-destLabelStart;
+    if((info.labelErrors&severeErrors)==0) {
+        // Do contextual checks only if we do not have U+FFFD from a severe error
+        // because U+FFFD can make these checks fail.
+        if((options&UIDNA_CHECK_BIDI)!=0 && (!info.isBiDi || info.isOkBiDi)) {
+            checkLabelBiDi(destLabel, destLabelLength, info);
+        }
+        if( (options&UIDNA_CHECK_CONTEXTJ)!=0 && (oredChars&0x200c)==0x200c &&
+            !isLabelOkContextJ(destLabel, destLabelLength)
+        ) {
+            info.labelErrors|=UIDNA_ERROR_CONTEXTJ;
+        }
+        if((options&UIDNA_CHECK_CONTEXTO)!=0 && oredChars>=0xb7) {
+            checkLabelContextO(destLabel, destLabelLength, info);
+        }
+        if(toASCII) {
+            if(oredChars>=0x80) {
+                // Contains non-ASCII characters.
+                char buffer[64];  // 63==maximum DNS label length
+                char *punycode=buffer;
+                MaybeStackArray<char, 1> longer;
+                UErrorCode punycodeErrorCode=U_ZERO_ERROR;
+                int32_t punycodeLength=u_strToPunycodeUTF8(
+                    reinterpret_cast<const char *>(destLabel), destLabelLength,
+                    punycode, UPRV_LENGTHOF(buffer), &punycodeErrorCode);
+                if(punycodeErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+                    punycodeErrorCode=U_ZERO_ERROR;
+                    punycode=longer.resize(punycodeLength+1);
+                    if(punycode==nullptr) {
+                        errorCode=U_MEMORY_ALLOCATION_ERROR;
+                        return;
+                    }
+                    punycodeLength=u_strToPunycodeUTF8(
+                        reinterpret_cast<const char *>(destLabel), destLabelLength,
+                        punycode, punycodeLength+1, &punycodeErrorCode);
+                }
+                if(U_FAILURE(punycodeErrorCode)) {
+                    errorCode=punycodeErrorCode;
+                    return;
+                }
+                if(punycodeLength+4>63) {
+                    info.labelErrors|=UIDNA_ERROR_LABEL_TOO_LONG;
+                }
+                dest.truncate(destLabelStart).append("xn--", 4, errorCode).
+                    append(punycode, punycodeLength, errorCode);
+            } else {
+                // all-ASCII label
+                if(destLabelLength>63) {
+                    info.labelErrors|=UIDNA_ERROR_LABEL_TOO_LONG;
+                }
+            }
+        }
+    }
+}
+
 // Make sure an ACE label does not look valid.
 // Append U+FFFD if the label has only LDH characters.
 // If UIDNA_USE_STD3_RULES, also replace disallowed ASCII characters with U+FFFD.
@@ -993,13 +1549,14 @@ const uint32_t R_AL_AN_EN_ES_CS_ET_ON_BN_NSM_MASK=R_AL_MASK|EN_AN_MASK|ES_CS_ET_
 // In a BiDi domain name, all labels must pass the BiDi Rule, but we might find
 // that a domain name is a BiDi domain name (has an RTL label) only after
 // processing several earlier labels.
+template<typename Unit>
 void
-UTS46::checkLabelBiDi(const char16_t *label, int32_t labelLength, IDNAInfo &info) const {
+UTS46::checkLabelBiDi(const Unit *label, int32_t labelLength, IDNAInfo &info) const {
     // IDNA2008 BiDi rule
     // Get the directionality of the first character.
     UChar32 c;
     int32_t i=0;
-    U16_NEXT_UNSAFE(label, i, c);
+    c=nextCodePoint(label, i, labelLength);
     uint32_t firstMask=U_MASK(u_charDirection(c));
     // 1. The first character must be a character with BIDI property L, R
     // or AL.  If it has the R or AL property, it is an RTL label; if it
@@ -1014,7 +1571,7 @@ UTS46::checkLabelBiDi(const char16_t *label, int32_t labelLength, IDNAInfo &info
             lastMask=firstMask;
             break;
         }
-        U16_PREV_UNSAFE(label, labelLength, c);
+        c=previousCodePoint(label, labelLength);
         UCharDirection dir=u_charDirection(c);
         if(dir!=U_DIR_NON_SPACING_MARK) {
             lastMask=U_MASK(dir);
@@ -1036,7 +1593,7 @@ UTS46::checkLabelBiDi(const char16_t *label, int32_t labelLength, IDNAInfo &info
     // Add the directionalities of the intervening characters.
     uint32_t mask=firstMask|lastMask;
     while(i<labelLength) {
-        U16_NEXT_UNSAFE(label, i, c);
+        c=nextCodePoint(label, i, labelLength);
         mask|=U_MASK(u_charDirection(c));
     }
     if(firstMask&L_MASK) {
@@ -1142,24 +1699,26 @@ isASCIIOkBiDi(const char *s, int32_t length) {
     return true;
 }
 
+template<typename Unit>
 UBool
-UTS46::isLabelOkContextJ(const char16_t *label, int32_t labelLength) const {
+UTS46::isLabelOkContextJ(const Unit *label, int32_t labelLength) const {
     // [IDNA2008-Tables]
     // 200C..200D  ; CONTEXTJ    # ZERO WIDTH NON-JOINER..ZERO WIDTH JOINER
-    for(int32_t i=0; i<labelLength; ++i) {
-        if(label[i]==0x200c) {
+    for(int32_t i=0; i<labelLength;) {
+        int32_t start=i;
+        UChar32 cp=nextCodePoint(label, i, labelLength);
+        if(cp==0x200c) {
             // Appendix A.1. ZERO WIDTH NON-JOINER
             // Rule Set:
             //  False;
             //  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
             //  If RegExpMatch((Joining_Type:{L,D})(Joining_Type:T)*\u200C
             //     (Joining_Type:T)*(Joining_Type:{R,D})) Then True;
-            if(i==0) {
+            if(start==0) {
                 return false;
             }
-            UChar32 c;
-            int32_t j=i;
-            U16_PREV_UNSAFE(label, j, c);
+            int32_t j=start;
+            UChar32 c=previousCodePoint(label, j);
             if(uts46Norm2.getCombiningClass(c)==9) {
                 continue;
             }
@@ -1170,7 +1729,7 @@ UTS46::isLabelOkContextJ(const char16_t *label, int32_t labelLength) const {
                     if(j==0) {
                         return false;
                     }
-                    U16_PREV_UNSAFE(label, j, c);
+                    c=previousCodePoint(label, j);
                 } else if(type==U_JT_LEFT_JOINING || type==U_JT_DUAL_JOINING) {
                     break;  // precontext fulfilled
                 } else {
@@ -1178,11 +1737,11 @@ UTS46::isLabelOkContextJ(const char16_t *label, int32_t labelLength) const {
                 }
             }
             // check postcontext (Joining_Type:T)*(Joining_Type:{R,D})
-            for(j=i+1;;) {
+            for(j=i;;) {
                 if(j==labelLength) {
                     return false;
                 }
-                U16_NEXT_UNSAFE(label, j, c);
+                c=nextCodePoint(label, j, labelLength);
                 UJoiningType type=ubidi_getJoiningType(c);
                 if(type==U_JT_TRANSPARENT) {
                     // just skip this character
@@ -1192,17 +1751,16 @@ UTS46::isLabelOkContextJ(const char16_t *label, int32_t labelLength) const {
                     return false;
                 }
             }
-        } else if(label[i]==0x200d) {
+        } else if(cp==0x200d) {
             // Appendix A.2. ZERO WIDTH JOINER (U+200D)
             // Rule Set:
             //  False;
             //  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
-            if(i==0) {
+            if(start==0) {
                 return false;
             }
-            UChar32 c;
-            int32_t j=i;
-            U16_PREV_UNSAFE(label, j, c);
+            int32_t j=start;
+            UChar32 c=previousCodePoint(label, j);
             if(uts46Norm2.getCombiningClass(c)!=9) {
                 return false;
             }
@@ -1211,12 +1769,13 @@ UTS46::isLabelOkContextJ(const char16_t *label, int32_t labelLength) const {
     return true;
 }
 
+template<typename Unit>
 void
-UTS46::checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &info) const {
-    int32_t labelEnd=labelLength-1;  // inclusive
+UTS46::checkLabelContextO(const Unit *label, int32_t labelLength, IDNAInfo &info) const {
     int32_t arabicDigits=0;  // -1 for 066x, +1 for 06Fx
-    for(int32_t i=0; i<=labelEnd; ++i) {
-        UChar32 c=label[i];
+    for(int32_t i=0; i<labelLength;) {
+        int32_t start=i;
+        UChar32 c=nextCodePoint(label, i, labelLength);
         if(c<0xb7) {
             // ASCII fastpath
         } else if(c<=0x6f9) {
@@ -1226,8 +1785,8 @@ UTS46::checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &
                 //  False;
                 //  If Before(cp) .eq.  U+006C And
                 //     After(cp) .eq.  U+006C Then True;
-                if(!(0<i && label[i-1]==0x6c &&
-                     i<labelEnd && label[i+1]==0x6c)) {
+                if(!(0<start && label[start-1]==0x6c &&
+                     i<labelLength && label[i]==0x6c)) {
                     info.labelErrors|=UIDNA_ERROR_CONTEXTO_PUNCTUATION;
                 }
             } else if(c==0x375) {
@@ -1236,10 +1795,10 @@ UTS46::checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &
                 //  False;
                 //  If Script(After(cp)) .eq.  Greek Then True;
                 UScriptCode script=USCRIPT_INVALID_CODE;
-                if(i<labelEnd) {
+                if(i<labelLength) {
                     UErrorCode errorCode=U_ZERO_ERROR;
-                    int32_t j=i+1;
-                    U16_NEXT(label, j, labelLength, c);
+                    int32_t j=i;
+                    c=nextCodePoint(label, j, labelLength);
                     script=uscript_getScript(c, &errorCode);
                 }
                 if(script!=USCRIPT_GREEK) {
@@ -1256,10 +1815,10 @@ UTS46::checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &
                 //  False;
                 //  If Script(Before(cp)) .eq.  Hebrew Then True;
                 UScriptCode script=USCRIPT_INVALID_CODE;
-                if(0<i) {
+                if(0<start) {
                     UErrorCode errorCode=U_ZERO_ERROR;
-                    int32_t j=i;
-                    U16_PREV(label, 0, j, c);
+                    int32_t j=start;
+                    c=previousCodePoint(label, j);
                     script=uscript_getScript(c, &errorCode);
                 }
                 if(script!=USCRIPT_HEBREW) {
@@ -1299,12 +1858,12 @@ UTS46::checkLabelContextO(const char16_t *label, int32_t labelLength, IDNAInfo &
             //    If Script(cp) .in. {Hiragana, Katakana, Han} Then True;
             //  End For;
             UErrorCode errorCode=U_ZERO_ERROR;
-            for(int j=0;;) {
-                if(j>labelEnd) {
+            for(int32_t j=0;;) {
+                if(j>=labelLength) {
                     info.labelErrors|=UIDNA_ERROR_CONTEXTO_PUNCTUATION;
                     break;
                 }
-                U16_NEXT(label, j, labelLength, c);
+                c=nextCodePoint(label, j, labelLength);
                 UScriptCode script=uscript_getScript(c, &errorCode);
                 if(script==USCRIPT_HIRAGANA || script==USCRIPT_KATAKANA || script==USCRIPT_HAN) {
                     break;
@@ -473,6 +473,11 @@ def generate_translit(config, io, common_vars):
     dep_files = set(InFile(filename) for filename in io.glob("translit/*.txt"))
     dep_files -= set(input_files)
     dep_files.add(DepTarget("cnvalias"))
+    # Precompiling the rules builds their UnicodeSets, which needs the
+    # same property data as at runtime.
+    dep_files.add(DepTarget("normalization"))
+    dep_files.add(DepTarget("unames"))
+    dep_files.add(DepTarget("uemoji"))
     dep_files = list(sorted(dep_files))
     input_basenames = [v.filename[9:] for v in input_files]
     output_files = [
@@ -488,7 +493,7 @@ def generate_translit(config, io, common_vars):
             output_files = output_files,
             tool = IcuTool("genrb"),
             args = "-s {IN_DIR}/translit -d {OUT_DIR}/translit -i {OUT_DIR} "
-                "-k "
+                "-k --compileTransliterators "
                 "{INPUT_BASENAME}",
             format_with = {
             },
@@ -15,9 +15,6 @@
 #include <math.h>
 #include <float.h>
 #include "unicode/putil.h"
-#include "uhash.h"
-#include "umutex.h"
-#include "ucln_in.h"
 #include "putilimp.h"
 #include <stdio.h>  // for toString()
 
@@ -65,14 +62,6 @@ static inline UBool isINVALID(double d) {
   return(uprv_isNaN(d));
 }
 
-static icu::UMutex ccLock;
-
-U_CDECL_BEGIN
-static UBool calendar_astro_cleanup() {
-  return true;
-}
-U_CDECL_END
-
 U_NAMESPACE_BEGIN
 
 /**
@@ -824,77 +813,6 @@ UnicodeString CalendarAstronomer::Equatorial::toString() const
 #endif
 }
 
-
-// =============== Calendar Cache ================
-
-void CalendarCache::createCache(CalendarCache** cache, UErrorCode& status) {
-    ucln_i18n_registerCleanup(UCLN_I18N_ASTRO_CALENDAR, calendar_astro_cleanup);
-    if(cache == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    } else {
-        *cache = new CalendarCache(32, status);
-        if(U_FAILURE(status)) {
-            delete *cache;
-            *cache = nullptr;
-        }
-    }
-}
-
-int32_t CalendarCache::get(CalendarCache** cache, int32_t key, UErrorCode &status) {
-    int32_t res;
-
-    if(U_FAILURE(status)) {
-        return 0;
-    }
-    umtx_lock(&ccLock);
-
-    if(*cache == nullptr) {
-        createCache(cache, status);
-        if(U_FAILURE(status)) {
-            umtx_unlock(&ccLock);
-            return 0;
-        }
-    }
-
-    res = uhash_igeti((*cache)->fTable, key);
-    U_DEBUG_ASTRO_MSG(("%p: GET: [%d] == %d\n", (*cache)->fTable, key, res));
-
-    umtx_unlock(&ccLock);
-    return res;
-}
-
-void CalendarCache::put(CalendarCache** cache, int32_t key, int32_t value, UErrorCode &status) {
-    if(U_FAILURE(status)) {
-        return;
-    }
-    umtx_lock(&ccLock);
-
-    if(*cache == nullptr) {
-        createCache(cache, status);
-        if(U_FAILURE(status)) {
-            umtx_unlock(&ccLock);
-            return;
-        }
-    }
-
-    uhash_iputi((*cache)->fTable, key, value, &status);
-    U_DEBUG_ASTRO_MSG(("%p: PUT: [%d] := %d\n", (*cache)->fTable, key, value));
-
-    umtx_unlock(&ccLock);
-}
-
-CalendarCache::CalendarCache(int32_t size, UErrorCode &status) {
-    fTable = uhash_openSize(uhash_hashLong, uhash_compareLong, nullptr, size, &status);
-    U_DEBUG_ASTRO_MSG(("%p: Opening.\n", fTable));
-}
-
-CalendarCache::~CalendarCache() {
-    if(fTable != nullptr) {
-        U_DEBUG_ASTRO_MSG(("%p: Closing.\n", fTable));
-        uhash_close(fTable);
-    }
-}
-
 U_NAMESPACE_END
 
 #endif //  !UCONFIG_NO_FORMATTING
@@ -14,6 +14,8 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <atomic>
+
 #include "gregoimp.h"  // for Math
 #include "unicode/unistr.h"
 
@@ -439,29 +441,49 @@ class U_I18N_API CalendarAstronomer : public UMemory {
 //  UDate local(UDate localMillis);
 };
 
-U_NAMESPACE_END
-
-struct UHashtable;
-
-U_NAMESPACE_BEGIN
-
 /**
- * Cache of month -> julian day
+ * Cache of year or month -> julian day, for the calendars whose fields
+ * take lengthy computations.
+ *
+ * The cache has SIZE slots indexed by the key, so that up to SIZE
+ * consecutive keys never collide; a key evicts the entry of another key
+ * that maps to the same slot. SIZE must be a power of 2. Each slot is
+ * one atomic word holding both key and value, so that get() and put()
+ * need no lock. Threads that miss
+ * at the same time compute and store the same value.
+ *
+ * A value of 0 cannot be cached: get() returns 0 for a missing key.
+ * Declare instances as static variables. They need neither construction
+ * nor cleanup, because static storage starts out zero-filled, which is
+ * the empty cache.
  * @internal
  */
+template<int32_t SIZE>
 class CalendarCache : public UMemory {
 public:
-  static int32_t get(CalendarCache** cache, int32_t key, UErrorCode &status);
-  static void put(CalendarCache** cache, int32_t key, int32_t value, UErrorCode &status);
-  virtual ~CalendarCache();
+  int32_t get(int32_t key) const {
+    // Relaxed: nothing but the slot itself is published through the slot.
+    uint64_t entry = fSlots[slotIndex(key)].load(std::memory_order_relaxed);
+    if (static_cast<int32_t>(entry >> 32) != key) {
+      return 0;
+    }
+    return static_cast<int32_t>(entry);
+  }
+
+  void put(int32_t key, int32_t value) {
+    uint64_t entry = (static_cast<uint64_t>(static_cast<uint32_t>(key)) << 32) |
+        static_cast<uint32_t>(value);
+    fSlots[slotIndex(key)].store(entry, std::memory_order_relaxed);
+  }
+
 private:
-  CalendarCache(int32_t size, UErrorCode& status);
-  static void createCache(CalendarCache** cache, UErrorCode& status);
-  /**
-   * not implemented
-   */
-  CalendarCache();
-  UHashtable *fTable;
+  static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of 2");
+
+  static int32_t slotIndex(int32_t key) {
+    return static_cast<int32_t>(static_cast<uint32_t>(key) & (SIZE - 1));
+  }
+
+  std::atomic<uint64_t> fSlots[SIZE];
 };
 
 U_NAMESPACE_END
@@ -1181,6 +1181,277 @@ Calendar::get(UCalendarDateFields field, UErrorCode& status) const
 
 // -------------------------------------
 
+namespace {
+
+/** The number of dates that computeFieldsBatch() converts at a time. */
+constexpr int32_t kBatchBlockLength = 128;
+
+/**
+ * The time zone offsets in effect from start to before limit.
+ */
+struct ZoneOffsetSpan {
+    UDate start = 0;
+    UDate limit = 0;
+    int32_t rawOffset = 0;
+    int32_t dstOffset = 0;
+
+    /**
+     * Sets the span to the offsets in effect at the given date, and to the
+     * dates between the transitions of the zone before and after it if the
+     * zone provides them.
+     */
+    void set(const TimeZone& zone, const BasicTimeZone* basicZone, UDate date, UErrorCode& status) {
+        zone.getOffset(date, false, rawOffset, dstOffset, status);
+        start = limit = date;
+        if (U_FAILURE(status) || basicZone == nullptr) {
+            return;
+        }
+        TimeZoneTransition transition;
+        start = basicZone->getPreviousTransition(date, true, transition) ?
+            transition.getTime() : -uprv_getInfinity();
+        limit = basicZone->getNextTransition(date, false, transition) ?
+            transition.getTime() : uprv_getInfinity();
+    }
+
+    bool contains(UDate date) const {
+        return start <= date && date < limit;
+    }
+};
+
+}  // namespace
+
+void
+Calendar::computeFieldsBatch(const UDate* dates, int32_t count,
+                             const UCalendarDateFields* fields, int32_t fieldCount,
+                             int32_t* const* results, UErrorCode& status) const
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count < 0 || fieldCount < 0 ||
+            (count > 0 && fieldCount > 0 &&
+             (dates == nullptr || fields == nullptr || results == nullptr))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+    // Compute the fields directly if this is a plain GregorianCalendar and
+    // none of the fields needs the length of neighboring years.
+    bool direct = typeid(*this) == typeid(GregorianCalendar);
+    for (int32_t j = 0; j < fieldCount; ++j) {
+        if (fields[j] < 0 || fields[j] >= UCAL_FIELD_COUNT || results[j] == nullptr) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        if (fields[j] == UCAL_WEEK_OF_YEAR || fields[j] == UCAL_YEAR_WOY ||
+                fields[j] == UCAL_IS_LEAP_MONTH) {
+            direct = false;
+        }
+    }
+    // GregorianCalendar::handleComputeFields() treats the year of the
+    // Gregorian change specially, and determines that year with the Julian
+    // calendar before 1582, which is at most one year ahead. Dates after
+    // the year after that are plain proleptic Gregorian.
+    int32_t directMinYear = 0;
+    if (direct) {
+        double cutoverDay = ClockMath::floorDivide(
+            static_cast<const GregorianCalendar*>(this)->getGregorianChange(), kOneDay) + 1;
+        if (cutoverDay < Grego::MIN_ARITHMETIC_DAY) {
+            cutoverDay = Grego::MIN_ARITHMETIC_DAY;
+        } else if (cutoverDay > Grego::MAX_ARITHMETIC_DAY) {
+            cutoverDay = Grego::MAX_ARITHMETIC_DAY;
+        }
+        int32_t month, dom, dow, doy;
+        Grego::dayToFieldsArithmetic(static_cast<int32_t>(cutoverDay),
+                                     directMinYear, month, dom, dow, doy);
+        directMinYear += 2;
+    }
+
+    const TimeZone& zone = getTimeZone();
+    const BasicTimeZone* basicZone = dynamic_cast<const BasicTimeZone*>(&zone);
+    ZoneOffsetSpan span;
+    // For the dates that are not computed directly
+    LocalPointer<Calendar> copy;
+
+    int32_t days[kBatchBlockLength];
+    int32_t millisInDay[kBatchBlockLength];
+    int32_t rawOffsets[kBatchBlockLength];
+    int32_t dstOffsets[kBatchBlockLength];
+    int32_t years[kBatchBlockLength];
+    int32_t months[kBatchBlockLength];
+    int32_t doms[kBatchBlockLength];
+    int32_t dows[kBatchBlockLength];
+    int32_t doys[kBatchBlockLength];
+    bool isDirect[kBatchBlockLength];
+
+    for (int32_t blockStart = 0; blockStart < count; blockStart += kBatchBlockLength) {
+        int32_t length = count - blockStart;
+        if (length > kBatchBlockLength) {
+            length = kBatchBlockLength;
+        }
+        const UDate* blockDates = dates + blockStart;
+        if (direct) {
+            // Local days and times in day
+            for (int32_t i = 0; i < length; ++i) {
+                UDate date = blockDates[i];
+                isDirect[i] = false;
+                days[i] = millisInDay[i] = rawOffsets[i] = dstOffsets[i] = 0;
+                if (!(MIN_MILLIS <= date && date <= MAX_MILLIS)) {
+                    continue;  // out of range or NaN
+                }
+                if (!span.contains(date)) {
+                    span.set(zone, basicZone, date, status);
+                    if (U_FAILURE(status)) {
+                        return;
+                    }
+                }
+                double day = ClockMath::floorDivide(
+                    date + (span.rawOffset + span.dstOffset), U_MILLIS_PER_DAY, &millisInDay[i]);
+                if (Grego::MIN_ARITHMETIC_DAY <= day && day <= Grego::MAX_ARITHMETIC_DAY) {
+                    days[i] = static_cast<int32_t>(day);
+                    isDirect[i] = true;
+                }
+                rawOffsets[i] = span.rawOffset;
+                dstOffsets[i] = span.dstOffset;
+            }
+            for (int32_t i = 0; i < length; ++i) {
+                Grego::dayToFieldsArithmetic(days[i], years[i], months[i], doms[i], dows[i], doys[i]);
+            }
+            for (int32_t i = 0; i < length; ++i) {
+                isDirect[i] = isDirect[i] && years[i] >= directMinYear;
+            }
+            for (int32_t j = 0; j < fieldCount; ++j) {
+                int32_t* out = results[j] + blockStart;
+                switch (fields[j]) {
+                case UCAL_ERA:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = years[i] < 1 ? GregorianCalendar::BC : GregorianCalendar::AD;
+                    }
+                    break;
+                case UCAL_YEAR:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = years[i] < 1 ? 1 - years[i] : years[i];
+                    }
+                    break;
+                case UCAL_EXTENDED_YEAR:
+                    uprv_memcpy(out, years, length * sizeof(int32_t));
+                    break;
+                case UCAL_MONTH:
+                case UCAL_ORDINAL_MONTH:
+                    uprv_memcpy(out, months, length * sizeof(int32_t));
+                    break;
+                case UCAL_DAY_OF_MONTH:
+                    uprv_memcpy(out, doms, length * sizeof(int32_t));
+                    break;
+                case UCAL_DAY_OF_YEAR:
+                    uprv_memcpy(out, doys, length * sizeof(int32_t));
+                    break;
+                case UCAL_DAY_OF_WEEK:
+                    uprv_memcpy(out, dows, length * sizeof(int32_t));
+                    break;
+                case UCAL_DOW_LOCAL:
+                    for (int32_t i = 0; i < length; ++i) {
+                        int32_t dowLocal = dows[i] - fFirstDayOfWeek + 1;
+                        out[i] = dowLocal < 1 ? dowLocal + 7 : dowLocal;
+                    }
+                    break;
+                case UCAL_WEEK_OF_MONTH:
+                    for (int32_t i = 0; i < length; ++i) {
+                        // As weekNumber(dom, dow) does.
+                        int32_t periodStartDayOfWeek = (dows[i] - fFirstDayOfWeek - doms[i] + 1) % 7;
+                        if (periodStartDayOfWeek < 0) {
+                            periodStartDayOfWeek += 7;
+                        }
+                        int32_t weekNo = (doms[i] + periodStartDayOfWeek - 1) / 7;
+                        if ((7 - periodStartDayOfWeek) >= fMinimalDaysInFirstWeek) {
+                            ++weekNo;
+                        }
+                        out[i] = weekNo;
+                    }
+                    break;
+                case UCAL_DAY_OF_WEEK_IN_MONTH:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = (doms[i] - 1) / 7 + 1;
+                    }
+                    break;
+                case UCAL_JULIAN_DAY:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = days[i] + kEpochStartAsJulianDay;
+                    }
+                    break;
+                case UCAL_MILLISECONDS_IN_DAY:
+                    uprv_memcpy(out, millisInDay, length * sizeof(int32_t));
+                    break;
+                case UCAL_MILLISECOND:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] % 1000;
+                    }
+                    break;
+                case UCAL_SECOND:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] / 1000 % 60;
+                    }
+                    break;
+                case UCAL_MINUTE:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] / 60000 % 60;
+                    }
+                    break;
+                case UCAL_HOUR_OF_DAY:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] / 3600000;
+                    }
+                    break;
+                case UCAL_HOUR:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] / 3600000 % 12;
+                    }
+                    break;
+                case UCAL_AM_PM:
+                    for (int32_t i = 0; i < length; ++i) {
+                        out[i] = millisInDay[i] / 3600000 / 12;  // Assume AM == 0
+                    }
+                    break;
+                case UCAL_ZONE_OFFSET:
+                    uprv_memcpy(out, rawOffsets, length * sizeof(int32_t));
+                    break;
+                case UCAL_DST_OFFSET:
+                    uprv_memcpy(out, dstOffsets, length * sizeof(int32_t));
+                    break;
+                default:
+                    // Excluded from direct computation above.
+                    UPRV_UNREACHABLE_EXIT;
+                }
+            }
+        } else {
+            uprv_memset(isDirect, 0, sizeof(isDirect));
+        }
+        // The dates that are not computed directly
+        for (int32_t i = 0; i < length; ++i) {
+            if (isDirect[i]) {
+                continue;
+            }
+            if (copy.isNull()) {
+                copy.adoptInsteadAndCheckErrorCode(clone(), status);
+                if (U_FAILURE(status)) {
+                    return;
+                }
+            }
+            copy->setTime(blockDates[i], status);
+            for (int32_t j = 0; j < fieldCount; ++j) {
+                results[j][blockStart + i] = copy->get(fields[j], status);
+            }
+            if (U_FAILURE(status)) {
+                return;
+            }
+        }
+    }
+}
+
+// -------------------------------------
+
 void
 Calendar::set(UCalendarDateFields field, int32_t value)
 {
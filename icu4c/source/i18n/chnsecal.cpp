@@ -30,6 +30,9 @@
 #include "ucln_in.h"
 #include "cstring.h"
 
+#define INCLUDED_FROM_CHNSECAL_CPP
+#include "chnsecal_data.h"
+
 // Debugging
 #ifdef U_DEBUG_CHNSECAL
 # include <stdio.h>
@@ -53,9 +56,9 @@ static void debug_chnsecal_msg(const char *pat, ...)
 #endif
 
 
-// Lazy Creation & Access synchronized by class CalendarCache with a mutex.
-static icu::CalendarCache *gWinterSolsticeCache = nullptr;
-static icu::CalendarCache *gNewYearCache = nullptr;
+// Lock-free, see class CalendarCache.
+static icu::ChineseCalendar::YearCache gWinterSolsticeCache;
+static icu::ChineseCalendar::YearCache gNewYearCache;
 
 static icu::TimeZone *gAstronomerTimeZone = nullptr;
 static icu::UInitOnce gAstronomerTimeZoneInitOnce {};
@@ -90,14 +93,6 @@ static const int32_t SYNODIC_GAP = 25;
 
 U_CDECL_BEGIN
 static UBool calendar_chinese_cleanup() {
-    if (gWinterSolsticeCache) {
-        delete gWinterSolsticeCache;
-        gWinterSolsticeCache = nullptr;
-    }
-    if (gNewYearCache) {
-        delete gNewYearCache;
-        gNewYearCache = nullptr;
-    }
     if (gAstronomerTimeZone) {
         delete gAstronomerTimeZone;
         gAstronomerTimeZone = nullptr;
@@ -121,9 +116,9 @@ U_NAMESPACE_BEGIN
 namespace {
 
 const TimeZone* getAstronomerTimeZone();
-int32_t newMoonNear(const TimeZone*, double, UBool, UErrorCode&);
+int32_t newMoonNear(const icu::ChineseCalendar::Setting&, double, UBool, UErrorCode&);
 int32_t newYear(const icu::ChineseCalendar::Setting&, int32_t, UErrorCode&);
-UBool isLeapMonthBetween(const TimeZone*, int32_t, int32_t, UErrorCode&);
+UBool isLeapMonthBetween(const icu::ChineseCalendar::Setting&, int32_t, int32_t, UErrorCode&);
 
 } // namespace
 
@@ -269,7 +264,7 @@ int32_t ChineseCalendar::handleGetMonthLengthWithLeap(int32_t extendedYear, int3
     }
     thisStart = thisStart -
         kEpochStartAsJulianDay + 1; // Julian day -> local days
-    int32_t nextStart = newMoonNear(setting.zoneAstroCalc, thisStart + SYNODIC_GAP, true, status);
+    int32_t nextStart = newMoonNear(setting, thisStart + SYNODIC_GAP, true, status);
     return nextStart - thisStart;
 }
 
@@ -365,7 +360,7 @@ int64_t ChineseCalendar::handleComputeMonthStartWithLeap(int32_t eyear, int32_t
     }
     int32_t gyear = eyear;
     int32_t theNewYear = newYear(setting, gyear, status);
-    int32_t newMoon = newMoonNear(setting.zoneAstroCalc, theNewYear + month * 29, true, status);
+    int32_t newMoon = newMoonNear(setting, theNewYear + month * 29, true, status);
     if (U_FAILURE(status)) {
        return 0;
     }
@@ -377,7 +372,7 @@ int64_t ChineseCalendar::handleComputeMonthStartWithLeap(int32_t eyear, int32_t
        return 0;
     }
     if (month != monthInfo.month-1 || isLeapMonth != monthInfo.isLeapMonth) {
-        newMoon = newMoonNear(setting.zoneAstroCalc, newMoon + SYNODIC_GAP, true, status);
+        newMoon = newMoonNear(setting, newMoon + SYNODIC_GAP, true, status);
         if (U_FAILURE(status)) {
            return 0;
         }
@@ -431,7 +426,7 @@ struct RollMonthInfo {
     int32_t thisMoon;
 };
 
-struct RollMonthInfo rollMonth(const TimeZone* timeZone, int32_t amount, int32_t day, int32_t month, int32_t dayOfMonth,
+struct RollMonthInfo rollMonth(const icu::ChineseCalendar::Setting& setting, int32_t amount, int32_t day, int32_t month, int32_t dayOfMonth,
                                bool isLeapMonth, bool hasLeapMonthBetweenWinterSolstices,
                                UErrorCode& status) {
     struct RollMonthInfo output = {0, 0, 0};
@@ -460,11 +455,11 @@ struct RollMonthInfo rollMonth(const TimeZone* timeZone, int32_t amount, int32_t
             // otherwise it will be the start of month 1.
             int prevMoon = output.thisMoon -
                 static_cast<int>(CalendarAstronomer::SYNODIC_MONTH * (month - 0.5));
-            prevMoon = newMoonNear(timeZone, prevMoon, true, status);
+            prevMoon = newMoonNear(setting, prevMoon, true, status);
             if (U_FAILURE(status)) {
                return output;
             }
-            if (isLeapMonthBetween(timeZone, prevMoon, output.thisMoon, status)) {
+            if (isLeapMonthBetween(setting, prevMoon, output.thisMoon, status)) {
                 ++month;
             }
             if (U_FAILURE(status)) {
@@ -505,7 +500,7 @@ void ChineseCalendar::roll(UCalendarDateFields field, int32_t amount, UErrorCode
             bool isLeapMonth = get(UCAL_IS_LEAP_MONTH, status) == 1;
             if (U_FAILURE(status)) break;
             struct RollMonthInfo r = rollMonth(
-                setting.zoneAstroCalc, amount, day, month, dayOfMonth, isLeapMonth,
+                setting, amount, day, month, dayOfMonth, isLeapMonth,
                 hasLeapMonthBetweenWinterSolstices, status);
             if (U_FAILURE(status)) break;
             if (r.newMoon != r.month) {
@@ -583,6 +578,57 @@ double millisToDays(const TimeZone* timeZone, double millis, UErrorCode& status)
 // Astronomical computations
 //------------------------------------------------------------------
 
+/**
+ * Return the number of bits set in the given value.
+ */
+inline int32_t countOnes(uint32_t value) {
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    return static_cast<int32_t>((((value + (value >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+}
+
+/**
+ * Return the i-th new moon of the precomputed table.
+ * @param table the precomputed table
+ * @param i 0 <= i < table.newMoonCount
+ * @return days after January 1, 1970 0:00 astronomical base zone
+ */
+inline int32_t tableNewMoon(const icu::ChineseCalendar::PrecomputedTable& table, int32_t i) {
+    const icu::ChineseCalendar::NewMoonBlock& block = table.newMoonBlocks[i >> 5];
+    uint32_t before = block.longMonths & ((static_cast<uint32_t>(1) << (i & 31)) - 1);
+    return block.start + 29 * (i & 31) + countOnes(before);
+}
+
+/**
+ * Return the index of the first new moon of the precomputed table on or
+ * after the given day, or -1 if the table cannot tell the new moons on
+ * both sides of the day.
+ * @param table the precomputed table
+ * @param days days after January 1, 1970 0:00 astronomical base zone
+ * @return 1 <= index < table.newMoonCount, or -1
+ */
+int32_t tableNewMoonIndex(const icu::ChineseCalendar::PrecomputedTable& table, double days) {
+    int32_t first = table.newMoonBlocks[0].start;
+    int32_t lastIndex = table.newMoonCount - 1;
+    if (!(first < days && days <= tableNewMoon(table, lastIndex)) ||
+            days != uprv_floor(days)) {
+        return -1;
+    }
+    int32_t day = static_cast<int32_t>(days);
+    // Estimate from the mean month length, then step to the exact month.
+    int32_t i = static_cast<int32_t>((day - first) / CalendarAstronomer::SYNODIC_MONTH);
+    if (i > lastIndex) {
+        i = lastIndex;
+    }
+    while (tableNewMoon(table, i) < day) {
+        ++i;
+    }
+    while (tableNewMoon(table, i - 1) >= day) {
+        --i;
+    }
+    return i;
+}
+
 
 /**
  * Return the major solar term on or after December 15 of the given
@@ -598,13 +644,15 @@ int32_t winterSolstice(const icu::ChineseCalendar::Setting& setting,
     if (U_FAILURE(status)) {
         return 0;
     }
-    const TimeZone* timeZone = setting.zoneAstroCalc;
-
-    int32_t cacheValue = CalendarCache::get(setting.winterSolsticeCache, gyear, status);
-    if (U_FAILURE(status)) {
-        return 0;
+    const icu::ChineseCalendar::PrecomputedTable* table = setting.table;
+    if (table != nullptr &&
+            table->firstSolsticeYear <= gyear && gyear <= table->lastSolsticeYear) {
+        return static_cast<int32_t>(Grego::fieldsToDay(
+            gyear, UCAL_DECEMBER, table->winterSolsticeDay[gyear - table->firstSolsticeYear]));
     }
+    const TimeZone* timeZone = setting.zoneAstroCalc;
 
+    int32_t cacheValue = setting.winterSolsticeCache->get(gyear);
     if (cacheValue == 0) {
         // In books December 15 is used, but it fails for some years
         // using our algorithms, e.g.: 1298 1391 1492 1553 1560.  That
@@ -628,10 +676,7 @@ int32_t winterSolstice(const icu::ChineseCalendar::Setting& setting,
             return 0;
         }
         cacheValue = static_cast<int32_t>(days);
-        CalendarCache::put(setting.winterSolsticeCache, gyear, cacheValue, status);
-    }
-    if(U_FAILURE(status)) {
-        cacheValue = 0;
+        setting.winterSolsticeCache->put(gyear, cacheValue);
     }
     return cacheValue;
 }
@@ -639,7 +684,7 @@ int32_t winterSolstice(const icu::ChineseCalendar::Setting& setting,
 /**
  * Return the closest new moon to the given date, searching either
  * forward or backward in time.
- * @param timeZone time zone for the Astro calculation.
+ * @param setting setting (time zone and precomputed table) for the Astro calculation.
  * @param days days after January 1, 1970 0:00 Asia/Shanghai
  * @param after if true, search for a new moon on or after the given
  * date; otherwise, search for a new moon before it
@@ -647,10 +692,17 @@ int32_t winterSolstice(const icu::ChineseCalendar::Setting& setting,
  * @return days after January 1, 1970 0:00 Asia/Shanghai of the nearest
  * new moon after or before <code>days</code>
  */
-int32_t newMoonNear(const TimeZone* timeZone, double days, UBool after, UErrorCode& status) {
+int32_t newMoonNear(const icu::ChineseCalendar::Setting& setting, double days, UBool after, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return 0;
     }
+    if (setting.table != nullptr) {
+        int32_t i = tableNewMoonIndex(*setting.table, days);
+        if (i >= 0) {
+            return tableNewMoon(*setting.table, after ? i : i - 1);
+        }
+    }
+    const TimeZone* timeZone = setting.zoneAstroCalc;
     double ms = daysToMillis(timeZone, days, status);
     if (U_FAILURE(status)) {
         return 0;
@@ -703,17 +755,25 @@ int32_t majorSolarTerm(const TimeZone* timeZone, int32_t days, UErrorCode& statu
 
 /**
  * Return true if the given month lacks a major solar term.
- * @param timeZone time zone for the Astro calculation.
+ * @param setting setting (time zone and precomputed table) for the Astro calculation.
  * @param newMoon days after January 1, 1970 0:00 Asia/Shanghai of a new
  * moon
  */
-UBool hasNoMajorSolarTerm(const TimeZone* timeZone, int32_t newMoon, UErrorCode& status) {
+UBool hasNoMajorSolarTerm(const icu::ChineseCalendar::Setting& setting, int32_t newMoon, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return false;
     }
+    const icu::ChineseCalendar::PrecomputedTable* table = setting.table;
+    if (table != nullptr) {
+        int32_t i = tableNewMoonIndex(*table, newMoon);
+        if (i >= 0 && tableNewMoon(*table, i) == newMoon) {
+            return (table->newMoonBlocks[i >> 5].noMajorSolarTerm >> (i & 31)) & 1;
+        }
+    }
+    const TimeZone* timeZone = setting.zoneAstroCalc;
     int32_t term1 = majorSolarTerm(timeZone, newMoon, status);
     int32_t term2 = majorSolarTerm(
-        timeZone, newMoonNear(timeZone, newMoon + SYNODIC_GAP, true, status), status);
+        timeZone, newMoonNear(setting, newMoon + SYNODIC_GAP, true, status), status);
     if (U_FAILURE(status)) {
         return false;
     }
@@ -728,13 +788,13 @@ UBool hasNoMajorSolarTerm(const TimeZone* timeZone, int32_t newMoon, UErrorCode&
 /**
  * Return true if there is a leap month on or after month newMoon1 and
  * at or before month newMoon2.
- * @param timeZone time zone for the Astro calculation.
+ * @param setting setting (time zone and precomputed table) for the Astro calculation.
  * @param newMoon1 days after January 1, 1970 0:00 astronomical base zone
  * of a new moon
  * @param newMoon2 days after January 1, 1970 0:00 astronomical base zone
  * of a new moon
  */
-UBool isLeapMonthBetween(const TimeZone* timeZone, int32_t newMoon1, int32_t newMoon2, UErrorCode& status) {
+UBool isLeapMonthBetween(const icu::ChineseCalendar::Setting& setting, int32_t newMoon1, int32_t newMoon2, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return false;
     }
@@ -750,10 +810,10 @@ UBool isLeapMonthBetween(const TimeZone* timeZone, int32_t newMoon1, int32_t new
 #endif
 
     while (newMoon2 >= newMoon1) {
-        if (hasNoMajorSolarTerm(timeZone, newMoon2, status)) {
+        if (hasNoMajorSolarTerm(setting, newMoon2, status)) {
             return true;
         }
-        newMoon2 = newMoonNear(timeZone, newMoon2 - SYNODIC_GAP, false, status);
+        newMoon2 = newMoonNear(setting, newMoon2 - SYNODIC_GAP, false, status);
         if (U_FAILURE(status)) {
             return false;
         }
@@ -809,16 +869,15 @@ struct MonthInfo computeMonthInfo(
         return output;
     }
 
-    const TimeZone* timeZone = setting.zoneAstroCalc;
     // Find the start of the month after month 11.  This will be either
     // the prior month 12 or leap month 11 (very rare).  Also find the
     // start of the following month 11.
-    int32_t firstMoon = newMoonNear(timeZone, solsticeBefore + 1, true, status);
-    int32_t lastMoon = newMoonNear(timeZone, solsticeAfter + 1, false, status);
+    int32_t firstMoon = newMoonNear(setting, solsticeBefore + 1, true, status);
+    int32_t lastMoon = newMoonNear(setting, solsticeAfter + 1, false, status);
     if (U_FAILURE(status)) {
         return output;
     }
-    output.thisMoon = newMoonNear(timeZone, days + 1, false, status); // Start of this month
+    output.thisMoon = newMoonNear(setting, days + 1, false, status); // Start of this month
     if (U_FAILURE(status)) {
         return output;
     }
@@ -841,7 +900,7 @@ struct MonthInfo computeMonthInfo(
         }
     }
     if (output.hasLeapMonthBetweenWinterSolstices &&
-        isLeapMonthBetween(timeZone, firstMoon, output.thisMoon, status)) {
+        isLeapMonthBetween(setting, firstMoon, output.thisMoon, status)) {
         output.month--;
     }
     if (U_FAILURE(status)) {
@@ -855,9 +914,9 @@ struct MonthInfo computeMonthInfo(
         output.ordinalMonth += 12;
     }
     output.isLeapMonth = output.hasLeapMonthBetweenWinterSolstices &&
-        hasNoMajorSolarTerm(timeZone, output.thisMoon, status) &&
-        !isLeapMonthBetween(timeZone, firstMoon,
-                            newMoonNear(timeZone, output.thisMoon - SYNODIC_GAP, false, status),
+        hasNoMajorSolarTerm(setting, output.thisMoon, status) &&
+        !isLeapMonthBetween(setting, firstMoon,
+                            newMoonNear(setting, output.thisMoon - SYNODIC_GAP, false, status),
                             status);
     if (U_FAILURE(status)) {
         return output;
@@ -999,12 +1058,7 @@ int32_t newYear(const icu::ChineseCalendar::Setting& setting,
     if (U_FAILURE(status)) {
         return 0;
     }
-    const TimeZone* timeZone = setting.zoneAstroCalc;
-    int32_t cacheValue = CalendarCache::get(setting.newYearCache, gyear, status);
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-
+    int32_t cacheValue = setting.newYearCache->get(gyear);
     if (cacheValue == 0) {
 
         int32_t gprevious_year;
@@ -1014,17 +1068,17 @@ int32_t newYear(const icu::ChineseCalendar::Setting& setting,
         }
         int32_t solsticeBefore= winterSolstice(setting, gprevious_year, status);
         int32_t solsticeAfter = winterSolstice(setting, gyear, status);
-        int32_t newMoon1 = newMoonNear(timeZone, solsticeBefore + 1, true, status);
-        int32_t newMoon2 = newMoonNear(timeZone, newMoon1 + SYNODIC_GAP, true, status);
-        int32_t newMoon11 = newMoonNear(timeZone, solsticeAfter + 1, false, status);
+        int32_t newMoon1 = newMoonNear(setting, solsticeBefore + 1, true, status);
+        int32_t newMoon2 = newMoonNear(setting, newMoon1 + SYNODIC_GAP, true, status);
+        int32_t newMoon11 = newMoonNear(setting, solsticeAfter + 1, false, status);
         if (U_FAILURE(status)) {
             return 0;
         }
 
         if (synodicMonthsBetween(newMoon1, newMoon11) == 12 &&
-            (hasNoMajorSolarTerm(timeZone, newMoon1, status) ||
-             hasNoMajorSolarTerm(timeZone, newMoon2, status))) {
-            cacheValue = newMoonNear(timeZone, newMoon2 + SYNODIC_GAP, true, status);
+            (hasNoMajorSolarTerm(setting, newMoon1, status) ||
+             hasNoMajorSolarTerm(setting, newMoon2, status))) {
+            cacheValue = newMoonNear(setting, newMoon2 + SYNODIC_GAP, true, status);
         } else {
             cacheValue = newMoon2;
         }
@@ -1032,10 +1086,7 @@ int32_t newYear(const icu::ChineseCalendar::Setting& setting,
             return 0;
         }
 
-        CalendarCache::put(setting.newYearCache, gyear, cacheValue, status);
-    }
-    if(U_FAILURE(status)) {
-        cacheValue = 0;
+        setting.newYearCache->put(gyear, cacheValue);
     }
     return cacheValue;
 }
@@ -1072,7 +1123,7 @@ void ChineseCalendar::offsetMonth(int32_t newMoon, int32_t dayOfMonth, int32_t d
     newMoon = static_cast<int32_t>(value);
 
     // Search forward to the target month's new moon
-    newMoon = newMoonNear(setting.zoneAstroCalc, newMoon, true, status);
+    newMoon = newMoonNear(setting, newMoon, true, status);
     if (U_FAILURE(status)) {
         return;
     }
@@ -1200,7 +1251,8 @@ ChineseCalendar::Setting ChineseCalendar::getSetting(UErrorCode&) const {
   return {
         getAstronomerTimeZone(),
         &gWinterSolsticeCache,
-        &gNewYearCache
+        &gNewYearCache,
+        &gPrecomputedTable
   };
 }
 
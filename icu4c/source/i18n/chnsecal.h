@@ -27,7 +27,7 @@
 
 U_NAMESPACE_BEGIN
 
-class CalendarCache;
+template<int32_t SIZE> class CalendarCache;
 /**
  * <code>ChineseCalendar</code> is a concrete subclass of {@link Calendar}
  * that implements a traditional Chinese calendar.  The traditional Chinese
@@ -246,10 +246,48 @@ class U_I18N_API ChineseCalendar : public Calendar {
 
   virtual int32_t getActualMaximum(UCalendarDateFields field, UErrorCode& status) const override;
 
+  /**
+   * Thirty-two consecutive new moons of a PrecomputedTable.
+   * @internal
+   */
+  struct NewMoonBlock {
+      /** The first new moon, in days after January 1, 1970 0:00 astronomical base zone. */
+      int32_t start;
+      /** Bit i is set if month i of the block has 30 days rather than 29. */
+      uint32_t longMonths;
+      /** Bit i is set if month i of the block lacks a major solar term. */
+      uint32_t noMajorSolarTerm;
+  };
+
+  /**
+   * Results of the astronomical computations for a range of Gregorian years,
+   * generated with CalendarAstronomer by tools/unicode/c/genchnsecal.
+   * Lookups in it need no locking; outside its range the astronomer is used.
+   * @internal
+   */
+  struct PrecomputedTable {
+      /** Gregorian years of the first and last entries of winterSolsticeDay. */
+      int32_t firstSolsticeYear;
+      int32_t lastSolsticeYear;
+      /** Day of December of the winter solstice of each of those years. */
+      const uint8_t* winterSolsticeDay;
+      /** Number of consecutive new moons in newMoonBlocks. */
+      int32_t newMoonCount;
+      const NewMoonBlock* newMoonBlocks;
+  };
+
+  /**
+   * Cache keyed by Gregorian year, big enough for several centuries.
+   * @internal
+   */
+  typedef CalendarCache<512> YearCache;
+
   struct Setting {
       const TimeZone* zoneAstroCalc;
-      CalendarCache** winterSolsticeCache;
-      CalendarCache** newYearCache;
+      YearCache* winterSolsticeCache;
+      YearCache* newYearCache;
+      /** Can be nullptr, then everything is computed with the astronomer. */
+      const PrecomputedTable* table;
   };
  protected:
   virtual Setting getSetting(UErrorCode& status) const;
@@ -0,0 +1,114 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// chnsecal_data.h
+//
+// machine-generated by: tools/unicode/c/genchnsecal
+// DO NOT EDIT THIS FILE BY HAND.
+//
+// Winter solstices and new moons of the Chinese calendar for Gregorian years
+// 1900..2100, computed with CalendarAstronomer in UTC+8.
+
+#ifdef INCLUDED_FROM_CHNSECAL_CPP
+
+static const uint8_t gWinterSolsticeDay[203]={
+22,22,22,23,23,22,22,23,23,22,22,23,23,22,22,23,23,22,22,23,
+23,22,22,22,23,22,22,22,23,22,22,22,23,22,22,22,23,22,22,22,
+23,22,22,22,23,22,22,22,23,22,22,22,23,22,22,22,22,22,22,22,
+22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+22,22,22,22,22,22,22,22,22,21,22,22,22,21,22,22,22,21,22,22,
+22,21,22,22,22,21,22,22,22,21,22,22,22,21,22,22,22,21,21,22,
+22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,
+22,21,21,22,22,21,21,22,22,21,21,21,22,21,21,21,22,21,21,21,
+22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,
+22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,22,22
+};
+
+static const icu::ChineseCalendar::NewMoonBlock gNewMoonBlocks[79]={
+    {-25626,0x5752b695,0x00000800},
+    {-24681,0xc9764aea,0x00002000},
+    {-23736,0xaaaad536,0x00020000},
+    {-22791,0x5d4ad655,0x00100000},
+    {-21846,0x25d92ba9,0x00020000},
+    {-20902,0xb4aba4bb,0x00200000},
+    {-19956,0x6d2ad655,0x01000000},
+    {-19011,0x9764b6a5,0x00200000},
+    {-18066,0xd26e92f4,0x02000000},
+    {-17121,0xb52b6a56,0x10000000},
+    {-16176,0x5d52da95,0x80000000},
+    {-15231,0x49ba4bd2,0x10000000},
+    {-14287,0xb52ba95b,0x00000000},
+    {-13341,0x6d4b5a95,0x00000001},
+    {-12396,0x26e92ec9,0x00000008},
+    {-11452,0xd4aea4ed,0x00000001},
+    {-10506,0xb5556a96,0x00000010},
+    {-9561,0x9ba4daaa,0x00000080},
+    {-8616,0x52ba93b4,0x00000400},
+    {-7672,0xb54daa5b,0x00000100},
+    {-6726,0x6d956aaa,0x00000800},
+    {-5781,0x4aea4ed2,0x00004000},
+    {-4837,0xd52ea95d,0x00001000},
+    {-3891,0xb5556aaa,0x00008000},
+    {-2946,0x2ba95b4a,0x00040000},
+    {-2002,0x64bb2575,0x00400000},
+    {-1057,0xd555aa9b,0x00080000},
+    {-111,0xaea56d2a,0x00400000},
+    {834,0x92ec96d4,0x04000000},
+    {1778,0xda55d25d,0x00800000},
+    {2724,0xb6956d2a,0x04000000},
+    {3669,0x4bb25b52,0x20000000},
+    {4613,0x6937497a,0x90000000},
+    {5558,0xda95b52b,0x40000000},
+    {6504,0x2ea96d52,0x00000000},
+    {7448,0xa4dd25e9,0x00000002},
+    {8393,0x5a95d4ad,0x00000010},
+    {9338,0xb6a9ad53,0x00000004},
+    {10284,0x93749764,0x00000010},
+    {11228,0x6a5752b6,0x00000100},
+    {12173,0x5aaab54b,0x00000800},
+    {13118,0x4dd26d55,0x00000200},
+    {14063,0xa95d49da,0x00001000},
+    {15008,0x6aa6d52d,0x00010000},
+    {15953,0x574ab555,0x00004000},
+    {16898,0x25752b69,0x00010000},
+    {17842,0x6a9764af,0x00080000},
+    {18788,0x5b2ab555,0x00400000},
+    {19733,0x95d4ada5,0x00080000},
+    {20678,0xb25d92bc,0x00800000},
+    {21623,0x6b2ada55,0x04000000},
+    {22568,0x5752b695,0x28800000},
+    {23513,0x49764b6a,0x08000000},
+    {24457,0x6d2ae92f,0x80000000},
+    {25403,0x5b52d695,0x00000000},
+    {26348,0x25d92da9,0x80000002},
+    {27292,0xb4aba4bd,0x00000000},
+    {28238,0x6d52da95,0x00000004},
+    {29183,0x9764b6a9,0x00000020},
+    {30128,0xd26e92f4,0x00000108},
+    {31073,0xad4aea56,0x00000040},
+    {32018,0x5d54daa9,0x00000200},
+    {32963,0x49ba4dd2,0x00002000},
+    {33907,0xb52ba95b,0x00000400},
+    {34853,0xad555aa5,0x00002000},
+    {35798,0x26e956ca,0x00020000},
+    {36742,0xd4aea56d,0x00004000},
+    {37688,0xb5556a96,0x00020000},
+    {38633,0xaba55aaa,0x00100000},
+    {39578,0x92ba95b4,0x01000000},
+    {40522,0xb653b25b,0x00200000},
+    {41468,0xad955aaa,0x01000000},
+    {42413,0x4aea56d2,0x10000000},
+    {43357,0xd92ed16e,0x02000000},
+    {44303,0xb5956d2a,0x10000000},
+    {45248,0x2ba95b52,0x80000000},
+    {46192,0xa8bb45b9,0x00000000},
+    {47137,0xd695749b,0x00000004},
+    {48083,0x00000012,0x00000001}
+};
+
+static const icu::ChineseCalendar::PrecomputedTable gPrecomputedTable={
+    1899,2101,gWinterSolsticeDay,2503,gNewMoonBlocks
+};
+
+#endif  // INCLUDED_FROM_CHNSECAL_CPP
@@ -23,10 +23,13 @@
 #include "unicode/rbtz.h"
 #include "unicode/tzrule.h"
 
+#define INCLUDED_FROM_DANGICAL_CPP
+#include "dangical_data.h"
+
 // --- The cache --
-// Lazy Creation & Access synchronized by class CalendarCache with a mutex.
-static icu::CalendarCache *gWinterSolsticeCache = nullptr;
-static icu::CalendarCache *gNewYearCache = nullptr;
+// Lock-free, see class CalendarCache.
+static icu::ChineseCalendar::YearCache gWinterSolsticeCache;
+static icu::ChineseCalendar::YearCache gNewYearCache;
 
 // gAstronomerTimeZone
 static icu::TimeZone *gAstronomerTimeZone = nullptr;
@@ -34,15 +37,6 @@ static icu::UInitOnce gAstronomerTimeZoneInitOnce {};
 
 U_CDECL_BEGIN
 static UBool calendar_dangi_cleanup() {
-    if (gWinterSolsticeCache) {
-        delete gWinterSolsticeCache;
-        gWinterSolsticeCache = nullptr;
-    }
-    if (gNewYearCache) {
-        delete gNewYearCache;
-        gNewYearCache = nullptr;
-    }
-
     if (gAstronomerTimeZone) {
         delete gAstronomerTimeZone;
         gAstronomerTimeZone = nullptr;
@@ -155,7 +149,8 @@ const TimeZone* getAstronomerTimeZone(UErrorCode &status) {
 ChineseCalendar::Setting DangiCalendar::getSetting(UErrorCode& status) const {
   return {
     getAstronomerTimeZone(status),
-    &gWinterSolsticeCache, &gNewYearCache
+    &gWinterSolsticeCache, &gNewYearCache,
+    &gPrecomputedTable
   };
 }
 
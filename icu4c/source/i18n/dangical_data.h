@@ -0,0 +1,114 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// dangical_data.h
+//
+// machine-generated by: tools/unicode/c/genchnsecal
+// DO NOT EDIT THIS FILE BY HAND.
+//
+// Winter solstices and new moons of the Dangi calendar for Gregorian years
+// 1900..2100, computed with CalendarAstronomer in the Korean zone of dangical.cpp.
+
+#ifdef INCLUDED_FROM_DANGICAL_CPP
+
+static const uint8_t gWinterSolsticeDay[203]={
+22,22,22,23,23,22,22,23,23,22,22,23,23,22,22,23,23,22,22,23,
+23,22,22,23,23,22,22,23,23,22,22,22,23,22,22,22,23,22,22,22,
+23,22,22,22,23,22,22,22,23,22,22,22,23,22,22,22,23,22,22,22,
+22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+22,22,22,22,22,22,22,22,22,22,22,22,22,21,22,22,22,21,22,22,
+22,21,22,22,22,21,22,22,22,21,22,22,22,21,22,22,22,21,22,22,
+22,21,22,22,22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,
+22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,21,
+22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,
+22,21,21,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,22,22
+};
+
+static const icu::ChineseCalendar::NewMoonBlock gNewMoonBlocks[79]={
+    {-25626,0x5752b695,0x00000800},
+    {-24681,0xc9764aea,0x00002000},
+    {-23736,0xaaaad536,0x00020000},
+    {-22791,0x5d4ad655,0x00100000},
+    {-21846,0x25d92ba9,0x00020000},
+    {-20902,0xb29ba4bb,0x00200000},
+    {-19956,0x6d2ad555,0x00800000},
+    {-19011,0x96d4aea5,0x00200000},
+    {-18066,0xd26e92ec,0x01000000},
+    {-17121,0xad2b5956,0x10000000},
+    {-16176,0x5b52da95,0x80000000},
+    {-15231,0x49ba4bb2,0x10000000},
+    {-14287,0xb52ba93b,0x00000000},
+    {-13341,0x6d4ada95,0x00000001},
+    {-12396,0x26e92ea9,0x00000008},
+    {-11452,0xd4aea4ed,0x00000001},
+    {-10506,0xb54b6a96,0x00000010},
+    {-9561,0x9ba4daa5,0x00000080},
+    {-8616,0x52ba93b4,0x00000400},
+    {-7672,0xb54b6a57,0x00000100},
+    {-6726,0x6d955aaa,0x00000800},
+    {-5781,0x4aea4ed2,0x00004000},
+    {-4837,0xd52da95d,0x00001000},
+    {-3891,0xb5556aaa,0x00008000},
+    {-2946,0x2ba95b4a,0x00040000},
+    {-2002,0x64b72575,0x00400000},
+    {-1057,0xd5556a9b,0x00080000},
+    {-111,0xaea56b2a,0x00400000},
+    {834,0x92dc95d4,0x04000000},
+    {1778,0xd955d25d,0x00800000},
+    {2724,0xb6956b2a,0x04000000},
+    {3669,0x4bb25b52,0x20000000},
+    {4613,0x69374976,0x90000000},
+    {5558,0xd695b52b,0x20000000},
+    {6504,0x2da96d4a,0x00000000},
+    {7448,0xa4dd25d9,0x00000002},
+    {8393,0xda95d4ad,0x00000010},
+    {9339,0xb6a5ad4a,0x00000004},
+    {10284,0x93749764,0x00000010},
+    {11228,0x6a575276,0x00000100},
+    {12173,0xdaaab54b,0x00000800},
+    {13119,0x4dd26d54,0x00000200},
+    {14063,0xa95d49da,0x00001000},
+    {15008,0x5aa5d52d,0x00008000},
+    {15953,0x574ab555,0x00004000},
+    {16898,0xa5752769,0x00008000},
+    {17843,0x6a96d4ae,0x00080000},
+    {18788,0x5aaab555,0x00400000},
+    {19733,0x95d4ada5,0x00080000},
+    {20678,0xb25b92ba,0x00800000},
+    {21623,0x6aaad64d,0x04000000},
+    {22568,0x5752b695,0x28800000},
+    {23513,0xc9764aea,0x08000000},
+    {24458,0x6d2ae92e,0x80000000},
+    {25403,0x5b4ab695,0x00000000},
+    {26348,0x25d92da9,0x80000002},
+    {27292,0xb49ba4bd,0x00000000},
+    {28238,0x6d4ada95,0x00000004},
+    {29183,0x96e4b6a5,0x00000020},
+    {30128,0xd26e92ec,0x00000108},
+    {31073,0xad4aea56,0x00000040},
+    {32018,0x5b54d6a9,0x00000200},
+    {32963,0x49ba4bb2,0x00002000},
+    {33907,0xb52ba95b,0x00000400},
+    {34853,0xad555aa5,0x00002000},
+    {35798,0x26e936aa,0x00020000},
+    {36742,0xd4aea4ed,0x00004000},
+    {37688,0xb5556a96,0x00020000},
+    {38633,0xaba55aaa,0x00100000},
+    {39578,0x52ba95b4,0x01000000},
+    {40522,0xb54bb257,0x00200000},
+    {41468,0xad955aaa,0x01000000},
+    {42413,0x4aea56d2,0x10000000},
+    {43357,0xd92ec95e,0x02000000},
+    {44303,0xb5556b2a,0x10000000},
+    {45248,0x2ba95b4a,0x80000000},
+    {46192,0x64bb2575,0x00000000},
+    {47137,0xb6957497,0x00000008},
+    {48083,0x0000000a,0x00000001}
+};
+
+static const icu::ChineseCalendar::PrecomputedTable gPrecomputedTable={
+    1899,2101,gWinterSolsticeDay,2503,gNewMoonBlocks
+};
+
+#endif  // INCLUDED_FROM_DANGICAL_CPP
@@ -35,6 +35,7 @@
 #include "uarrsort.h"
 
 #include "cstring.h"
+#include "fphdlimp.h"
 #include "windtfmt.h"
 
 #if defined( U_DEBUG_CALSVC ) || defined (U_DEBUG_CAL)
@@ -279,6 +280,13 @@ DateFormat::format(Calendar& /* unused cal */,
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosition) const {
     if (fCalendar != nullptr) {
+        // Numeric Gregorian patterns do not need a calendar
+        if (typeid(*this) == typeid(SimpleDateFormat)) {
+            FieldPositionOnlyHandler handler(fieldPosition);
+            if (static_cast<const SimpleDateFormat*>(this)->fastFormat(date, appendTo, handler)) {
+                return appendTo;
+            }
+        }
         UErrorCode ec = U_ZERO_ERROR;
         // Avoid a heap allocation and corresponding free for the common case
         if (typeid(*fCalendar) == typeid(GregorianCalendar)) {
@@ -307,7 +315,17 @@ DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosi
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPositionIterator* posIter,
                    UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
     if (fCalendar != nullptr) {
+        // Numeric Gregorian patterns do not need a calendar
+        if (posIter == nullptr && typeid(*this) == typeid(SimpleDateFormat)) {
+            FieldPositionIteratorHandler handler(posIter, status);
+            if (static_cast<const SimpleDateFormat*>(this)->fastFormat(date, appendTo, handler)) {
+                return appendTo;
+            }
+        }
         UErrorCode ec = U_ZERO_ERROR;
         // Avoid a heap allocation and corresponding free for the common case
         if (typeid(*fCalendar) == typeid(GregorianCalendar)) {
@@ -343,6 +361,62 @@ DateFormat::format(UDate date, UnicodeString& appendTo) const
 
 //----------------------------------------------------------------------
 
+UnicodeString&
+DateFormat::formatBatch(const UDate* dates, int32_t count, UnicodeString& appendTo,
+                        int32_t* offsets, UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (dates == nullptr && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    // Numeric Gregorian patterns do not need a calendar,
+    // and adjacent dates on the same day share their date fields.
+    const SimpleDateFormat* sdf = nullptr;
+    SimpleDateFormat::FastFormatDay lastDay;
+    if (typeid(*this) == typeid(SimpleDateFormat)) {
+        sdf = static_cast<const SimpleDateFormat*>(this);
+    }
+    // Otherwise use one clone of our calendar for all dates.
+    LocalPointer<Calendar> cal;
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    for (int32_t i = 0; i < count; ++i) {
+        if (offsets != nullptr) {
+            offsets[i] = appendTo.length();
+        }
+        if (fCalendar == nullptr) {
+            continue;
+        }
+        if (sdf != nullptr) {
+            FieldPositionOnlyHandler handler(pos);
+            if (sdf->fastFormat(dates[i], appendTo, handler, &lastDay)) {
+                continue;
+            }
+        }
+        if (cal.isNull()) {
+            cal.adoptInsteadAndCheckErrorCode(fCalendar->clone(), status);
+            if (U_FAILURE(status)) {
+                return appendTo;
+            }
+        }
+        cal->setTime(dates[i], status);
+        if (U_FAILURE(status)) {
+            return appendTo;
+        }
+        format(*cal, appendTo, pos);
+    }
+    if (offsets != nullptr) {
+        offsets[count] = appendTo.length();
+    }
+    if (appendTo.isBogus()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return appendTo;
+}
+
+//----------------------------------------------------------------------
+
 UDate
 DateFormat::parse(const UnicodeString& text,
                   ParsePosition& pos) const
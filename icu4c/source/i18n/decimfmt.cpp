@@ -791,6 +791,39 @@ CurrencyAmount* DecimalFormat::parseCurrency(const UnicodeString& text, ParsePos
     }
 }
 
+int32_t DecimalFormat::parseBatch(const UnicodeString* texts, int32_t count, double* results,
+                                  int32_t* parseEnds, UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (fields == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    if (count < 0 || (count > 0 && (texts == nullptr || results == nullptr))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const NumberParserImpl* parser = getParser(status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t successes = 0;
+    for (int32_t i = 0; i < count; i++) {
+        int32_t parseEnd = parser->parseDouble(texts[i], results[i], status);
+        if (U_FAILURE(status)) {
+            return successes;
+        }
+        if (parseEnds != nullptr) {
+            parseEnds[i] = parseEnd;
+        }
+        if (parseEnd >= 0) {
+            successes++;
+        }
+    }
+    return successes;
+}
+
 const DecimalFormatSymbols* DecimalFormat::getDecimalFormatSymbols() const {
     if (fields == nullptr) {
         return nullptr;
@@ -36,6 +36,8 @@ class FunctionReplacer : public UnicodeFunctor, public UnicodeReplacer {
 
  private:
 
+    friend class TransliterationRuleBinary; // reads and writes the private data
+
     /**
      * The transliterator.  Must not be null.  OWNED.
      */
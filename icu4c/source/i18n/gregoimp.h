@@ -213,6 +213,30 @@ class Grego {
     static void dayToFields(int32_t day, int32_t& year, int8_t& month,
                             int8_t& dom, int8_t& dow, int16_t& doy, UErrorCode& status);
 
+    /**
+     * The range of days accepted by dayToFieldsArithmetic(),
+     * about the years -32800..2900000.
+     */
+    static constexpr int32_t MIN_ARITHMETIC_DAY = -12699422;
+    static constexpr int32_t MAX_ARITHMETIC_DAY = 1000000000;
+
+    /**
+     * Convert a 1970-epoch day number to proleptic Gregorian year,
+     * month, day-of-month, day-of-year and day-of-week, with the same
+     * results as dayToFields(). This uses only integer multiplications,
+     * shifts and comparisons (Neri & Schneider, "Euclidean affine functions
+     * and their application to calendar algorithms", 2022), so that
+     * compilers can vectorize loops over many days.
+     * @param day 1970-epoch day, MIN_ARITHMETIC_DAY..MAX_ARITHMETIC_DAY
+     * @param year output parameter to receive year
+     * @param month output parameter to receive month (0-based, 0==Jan)
+     * @param dom output parameter to receive day-of-month (1-based)
+     * @param dow output parameter to receive day-of-week (1-based, 1==Sun)
+     * @param doy output parameter to receive day-of-year (1-based)
+     */
+    static inline void dayToFieldsArithmetic(int32_t day, int32_t& year, int32_t& month,
+                                             int32_t& dom, int32_t& dow, int32_t& doy);
+
     /**
      * Convert a 1970-epoch day number to proleptic Gregorian year.
      * @param day 1970-epoch day
@@ -324,6 +348,34 @@ class Grego {
     static const int8_t MONTH_LENGTH[24];
 };
 
+inline void Grego::dayToFieldsArithmetic(int32_t day, int32_t& year, int32_t& month,
+                                         int32_t& dom, int32_t& dow, int32_t& doy) {
+    // Shift the day so that it is positive and counts from March 1 of
+    // a year divisible by 400, with 82 cycles of 400 years to spare.
+    uint32_t n = static_cast<uint32_t>(day - MIN_ARITHMETIC_DAY);
+    // 400-year cycles (centuries) and the day within the century
+    uint32_t n1 = 4 * n + 3;
+    uint32_t century = n1 / 146097;
+    uint32_t dayOfCentury = n1 % 146097 / 4;
+    // Years and the day within the year starting on March 1
+    uint64_t p2 = static_cast<uint64_t>(2939745) * (4 * dayOfCentury + 3);
+    uint32_t yearOfCentury = static_cast<uint32_t>(p2 >> 32);
+    uint32_t dayOfMarchYear = static_cast<uint32_t>(p2) / 2939745 / 4;
+    // Months and the day within the month, with March == 3
+    uint32_t n3 = 2141 * dayOfMarchYear + 197913;
+    uint32_t marchMonth = n3 >> 16;
+    uint32_t marchDom = (n3 & 0xffff) / 2141;
+    bool januaryOrFebruary = dayOfMarchYear >= 306;
+
+    year = static_cast<int32_t>(100 * century + yearOfCentury) - 32800 + januaryOrFebruary;
+    month = static_cast<int32_t>(januaryOrFebruary ? marchMonth - 12 : marchMonth) - 1;
+    dom = static_cast<int32_t>(marchDom) + 1;
+    doy = januaryOrFebruary ? static_cast<int32_t>(dayOfMarchYear) - 305 :
+        static_cast<int32_t>(dayOfMarchYear) + 60 + isLeapYear(year);
+    // MIN_ARITHMETIC_DAY is a Wednesday.
+    dow = static_cast<int32_t>((n + 3) % 7) + 1;
+}
+
 inline double ClockMath::floorDivide(double numerator, double denominator) {
     return uprv_floor(numerator / denominator);
 }
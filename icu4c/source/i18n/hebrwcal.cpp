@@ -26,7 +26,6 @@
 #include "gregoimp.h" // ClockMath
 #include "astro.h" // CalendarCache
 #include "uhash.h"
-#include "ucln_in.h"
 
 // Hebrew Calendar implementation
 
@@ -140,15 +139,8 @@ static const int16_t  LEAP_MONTH_START[][3] = {
 static const int32_t MONTHS_IN_CYCLE = 235;
 static const int32_t YEARS_IN_CYCLE = 19;
 
-static icu::CalendarCache *gCache =  nullptr;
-
-U_CDECL_BEGIN
-static UBool calendar_hebrew_cleanup() {
-    delete gCache;
-    gCache = nullptr;
-    return true;
-}
-U_CDECL_END
+// Cache of year starts, lock-free, see class CalendarCache.
+static icu::CalendarCache<512> gCache;
 
 U_NAMESPACE_BEGIN
 //-------------------------------------------------------------------------
@@ -425,12 +417,7 @@ namespace {
 */
 int32_t startOfYear(int32_t year, UErrorCode &status)
 {
-    ucln_i18n_registerCleanup(UCLN_I18N_HEBREW_CALENDAR, calendar_hebrew_cleanup);
-    int64_t day = CalendarCache::get(&gCache, year, status);
-    if(U_FAILURE(status)) {
-        return 0;
-    }
-
+    int64_t day = gCache.get(year);
     if (day == 0) {
         // # of months before year
         int64_t months = ClockMath::floorDivideInt64(
@@ -462,7 +449,7 @@ int32_t startOfYear(int32_t year, UErrorCode &status)
             status = U_ILLEGAL_ARGUMENT_ERROR;
             return 0;
         }
-        CalendarCache::put(&gCache, year, static_cast<int32_t>(day), status);
+        gCache.put(year, static_cast<int32_t>(day));
     }
     // Out of range value is alread rejected before putting into cache.
     U_ASSERT(INT32_MIN <= day  &&  day <= INT32_MAX);
@@ -477,21 +464,13 @@ int32_t daysInYear(int32_t eyear, UErrorCode& status) {
 }
 
 /**
-* Returns the type of a given year.
+* Returns the type of a year of the given length.
 *  0   "Deficient" year with 353 or 383 days
 *  1   "Normal"    year with 354 or 384 days
 *  2   "Complete"  year with 355 or 385 days
 */
-int32_t yearType(int32_t year, UErrorCode& status)
+int32_t yearTypeOfLength(int32_t yearLength)
 {
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-    int32_t yearLength = daysInYear(year, status);
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-
     if (yearLength > 380) {
         yearLength -= 30;        // Subtract length of leap month.
     }
@@ -512,6 +491,21 @@ int32_t yearType(int32_t year, UErrorCode& status)
     return type;
 }
 
+/**
+* Returns the type of a given year, see yearTypeOfLength().
+*/
+int32_t yearType(int32_t year, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t yearLength = daysInYear(year, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    return yearTypeOfLength(yearLength);
+}
+
 }  // namespace
    //
 /**
@@ -652,14 +646,18 @@ void HebrewCalendar::handleComputeFields(int32_t julianDay, UErrorCode &status)
         dayOfYear = (d - ys);
     }
 
-    // Now figure out which month we're in, and the date within that month
-    int32_t type = yearType(year, status);
+    // Now figure out which month we're in, and the date within that month.
+    // The start of this year is known, so only the next one is needed
+    // for the length of the year.
+    int32_t type = yearTypeOfLength(startOfYear(year + 1, status) - ys);
     if (U_FAILURE(status)) {
         return;
     }
     UBool isLeap = isLeapYear(year);
 
-    int32_t month = 0;
+    // No month starts later than 30 days per month, so the month is
+    // after (dayOfYear - 1) / 30, and the search takes a step or two.
+    int32_t month = (dayOfYear - 1) / 30;
     int32_t momax = UPRV_LENGTHOF(MONTH_START);
     while (month < momax &&
            dayOfYear > (  isLeap ? LEAP_MONTH_START[month][type] : MONTH_START[month][type] ) ) {
@@ -24,7 +24,6 @@
 #include "gregoimp.h" // Math
 #include "astro.h" // CalendarAstronomer
 #include "uhash.h"
-#include "ucln_in.h"
 #include "uassert.h"
 
 static const UDate HIJRA_MILLIS = -42521587200000.0;    // 7/16/622 AD 00:00
@@ -53,18 +52,9 @@ static void debug_islamcal_msg(const char *pat, ...)
 
 
 // --- The cache --
-// cache of months
-static icu::CalendarCache *gMonthCache = nullptr;
-
-U_CDECL_BEGIN
-static UBool calendar_islamic_cleanup() {
-    if (gMonthCache) {
-        delete gMonthCache;
-        gMonthCache = nullptr;
-    }
-    return true;
-}
-U_CDECL_END
+// cache of month starts, lock-free, see class CalendarCache;
+// big enough for the months of a few centuries
+static icu::CalendarCache<4096> gMonthCache;
 
 U_NAMESPACE_BEGIN
 
@@ -302,6 +292,21 @@ inline bool civilLeapYear(int32_t year) {
     return (14 + 11 * year) % 30 < 11;
 }
 
+/**
+* Return the number of 30-day months among the first n months of the
+* given year of the Umm al-Qura table.
+*
+* @param index The year minus UMALQURA_YEAR_START
+* @param n     The number of months, 0..12
+*/
+inline int32_t umAlQuraLongMonthsBefore(int32_t index, int32_t n) {
+    // Month 0 is the highest of the 12 bits.
+    uint32_t value = static_cast<uint32_t>(UMALQURA_MONTHLENGTH[index]) >> (12 - n);
+    value = value - ((value >> 1) & 0x555);
+    value = (value & 0x333) + ((value >> 2) & 0x333);
+    return static_cast<int32_t>(((((value + (value >> 4)) & 0x0f0f) * 0x0101) >> 8) & 0xff);
+}
+
 int32_t trueMonthStart(int32_t month, UErrorCode& status);
 
 } // namespace
@@ -360,10 +365,9 @@ int32_t trueMonthStart(int32_t month, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return 0;
     }
-    ucln_i18n_registerCleanup(UCLN_I18N_ISLAMIC_CALENDAR, calendar_islamic_cleanup);
-    int64_t start = CalendarCache::get(&gMonthCache, month, status);
+    int64_t start = gMonthCache.get(month);
 
-    if (U_SUCCESS(status) && start==0) {
+    if (start==0) {
         // Make a guess at when the month started, using the average length
         UDate origin = HIJRA_MILLIS 
             + uprv_floor(month * CalendarAstronomer::SYNODIC_MONTH) * kOneDay;
@@ -387,10 +391,7 @@ int32_t trueMonthStart(int32_t month, UErrorCode& status) {
         }
         start = ClockMath::floorDivideInt64(
             static_cast<int64_t>(static_cast<int64_t>(origin) - HIJRA_MILLIS), static_cast<int64_t>(kOneDay)) + 1;
-        CalendarCache::put(&gMonthCache, month, start, status);
-    }
-    if(U_FAILURE(status)) {
-        start = 0;
+        gMonthCache.put(month, static_cast<int32_t>(start));
     }
     return start;
 }
@@ -525,8 +526,9 @@ void IslamicCalendar::handleComputeFields(int32_t julianDay, UErrorCode &status)
 
     int32_t startDate = static_cast<int32_t>(uprv_floor(month * CalendarAstronomer::SYNODIC_MONTH));
 
-    double age = moonAge(internalGetTime());
-    if ( days - startDate >= 25 && age > 0) {
+    // The age of the moon takes lengthy computations; only get it
+    // when it matters.
+    if ( days - startDate >= 25 && moonAge(internalGetTime()) > 0) {
         // If we're near the end of the month, assume next month and search backwards
         month++;
     }
@@ -672,10 +674,10 @@ int64_t IslamicCivilCalendar::yearStart(int32_t year, UErrorCode& /* status */)
 */
 int64_t IslamicCivilCalendar::monthStart(int32_t year, int32_t month, UErrorCode& /*status*/) const {
     // This does not handle months out of the range 0..11
-    return static_cast<int64_t>(
-        uprv_ceil(29.5*month) + 354LL*(year-1LL) +
+    // (59*month+1)/2 is ceil(29.5*month) for such months.
+    return (59LL * month + 1) / 2 + 354LL*(year-1LL) +
         ClockMath::floorDivideInt64(
-             11LL*static_cast<int64_t>(year) + 3LL, 30LL));
+             11LL*static_cast<int64_t>(year) + 3LL, 30LL);
 }
 
 /**
@@ -728,8 +730,9 @@ void IslamicCivilCalendar::handleComputeFields(int32_t julianDay, UErrorCode &st
     // Use the civil calendar approximation, which is just arithmetic
     int64_t year  =
         ClockMath::floorDivideInt64(30LL * days + 10646LL, 10631LL);
-    int32_t month = static_cast<int32_t>(
-        uprv_ceil((days - 29 - yearStart(year, status)) / 29.5 ));
+    // ceil((dayOfYear - 29) / 29.5) for the 0-based day of the year,
+    // the inverse of monthStart()
+    int64_t month = ClockMath::floorDivideInt64(2 * (days - yearStart(year, status)), 59LL);
     if (U_FAILURE(status)) {
         return;
     }
@@ -830,17 +833,11 @@ int64_t IslamicUmalquraCalendar::yearStart(int32_t year, UErrorCode& status) con
 * @param month The hijri month, 0-based (assumed to be in range 0..11)
 */
 int64_t IslamicUmalquraCalendar::monthStart(int32_t year, int32_t month, UErrorCode& status) const {
-    int64_t ms = yearStart(year, status);
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-    for(int i=0; i< month; i++){
-        ms+= handleGetMonthLength(year, i, status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+    if (year < UMALQURA_YEAR_START || year > UMALQURA_YEAR_END) {
+        return IslamicCivilCalendar::monthStart(year, month, status);
     }
-    return ms;
+    return yearStart(year, status) + 29 * month +
+        umAlQuraLongMonthsBefore(year - UMALQURA_YEAR_START, month);
 }
 
 /**
@@ -867,14 +864,7 @@ int32_t IslamicUmalquraCalendar::yearLength(int32_t extendedYear, UErrorCode& st
     if (extendedYear<UMALQURA_YEAR_START || extendedYear>UMALQURA_YEAR_END) {
         return IslamicCivilCalendar::handleGetYearLength(extendedYear, status);
     }
-    int length = 0;
-    for(int i=0; i<12; i++) {
-        length += handleGetMonthLength(extendedYear, i, status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
-    }
-    return length;
+    return 12 * 29 + umAlQuraLongMonthsBefore(extendedYear - UMALQURA_YEAR_START, 12);
 }
 
 /**
@@ -935,14 +925,16 @@ void IslamicUmalquraCalendar::handleComputeFields(int32_t julianDay, UErrorCode
             break;
         }
         if (d < length){
-            int32_t monthLen = handleGetMonthLength(year, month, status);
-            for (month = 0;
-                 d > monthLen;
-                 monthLen = handleGetMonthLength(year, ++month, status)) {
-                if (U_FAILURE(status)) {
-                    return;
+            // Binary search for the last month that starts before day d.
+            int64_t start = yearStart(year, status);
+            int32_t limit = 12;
+            while (limit - month > 1) {
+                int32_t middle = (month + limit) / 2;
+                if (monthStart(year, middle, status) - start < d) {
+                    month = middle;
+                } else {
+                    limit = middle;
                 }
-                d -= monthLen;
             }
             break;
         }
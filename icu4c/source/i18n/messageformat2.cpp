@@ -638,12 +638,16 @@ bool MessageFormatter::checkSelectOption(const FunctionValue& val) const {
 }
 
 // See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#resolve-preferences
-// `keys` and `matches` are vectors of strings
-void MessageFormatter::matchSelectorKeys(const UVector& keys,
+// `keys` is the list of keys for one selector; the matching keys are returned
+// as indices into `keys`, in order of preference
+void MessageFormatter::matchSelectorKeys(const UnicodeString* keys,
+                                         int32_t keysLen,
                                          MessageContext& context,
-					 InternalValue&& rv,
-					 UVector& keysOut,
-					 UErrorCode& status) const {
+                                         InternalValue&& rv,
+                                         int32_t* prefs,
+                                         int32_t& prefsLen,
+                                         UErrorCode& status) const {
+    prefsLen = 0;
     CHECK_ERROR(status);
 
     if (!rv.isSelectable()) {
@@ -652,29 +656,6 @@ void MessageFormatter::matchSelectorKeys(const UVector& keys,
 
     UErrorCode savedStatus = status;
 
-    // Convert `keys` to an array
-    int32_t keysLen = keys.size();
-    UnicodeString* keysArr = new UnicodeString[keysLen];
-    if (keysArr == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return;
-    }
-    for (int32_t i = 0; i < keysLen; i++) {
-        const UnicodeString* k = static_cast<UnicodeString*>(keys[i]);
-        U_ASSERT(k != nullptr);
-        keysArr[i] = *k;
-    }
-    LocalArray<UnicodeString> adoptedKeys(keysArr);
-
-    // Create an array to hold the output
-    int32_t* prefsArr = static_cast<int32_t*>(uprv_malloc(keysLen * sizeof(int32_t)));
-    if (prefsArr == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return;
-    }
-
-    int32_t prefsLen = 0;
-
     // Call the selector
     // Caller checked for fallback, so it's safe to call getValue()
     const FunctionValue* rvVal = rv.getValue(status);
@@ -683,14 +664,13 @@ void MessageFormatter::matchSelectorKeys(const UVector& keys,
     bool badSelectOption = !checkSelectOption(*rvVal);
 
     U_ASSERT(U_SUCCESS(status));
-    rvVal->selectKeys(adoptedKeys.getAlias(), keysLen, prefsArr, prefsLen,
-                      status);
+    rvVal->selectKeys(keys, keysLen, prefs, prefsLen, status);
 
     if (badSelectOption) {
         context.getErrors().setBadOption(rvVal->getFunctionName(), status);
-        CHECK_ERROR(status);
         // In this case, only the `*` variant should match
         prefsLen = 0;
+        CHECK_ERROR(status);
     }
 
     // Update errors
@@ -703,242 +683,178 @@ void MessageFormatter::matchSelectorKeys(const UVector& keys,
             status = savedStatus;
         }
     }
-
-    CHECK_ERROR(status);
-
-    // Copy the resulting keys (if there was no error)
-    keysOut.removeAllElements();
-    for (int32_t i = 0; i < prefsLen; i++) {
-        UnicodeString* k =
-            message2::create<UnicodeString>(std::move(keysArr[prefsArr[i]]), status);
-        if (k == nullptr) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            return;
-        }
-        keysOut.adoptElement(k, status);
-        CHECK_ERROR(status);
-    }
-
-    uprv_free(prefsArr);
 }
 
-// See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#resolve-preferences
-// `res` is a vector of FormattedPlaceholders;
-// `pref` is a vector of vectors of strings
-void MessageFormatter::resolvePreferences(MessageContext& context,
-                                          UVector& res,
-                                          UVector& pref,
-                                          UErrorCode &status) const {
+// Numbers the keys of each variant for formatSelectors().
+// Equal keys (after NFC normalization) get the same number.
+void MessageFormatter::buildVariantTable(UErrorCode& status) {
     CHECK_ERROR(status);
 
-    // 1. Let pref be a new empty list of lists of strings.
-    // (Implicit, since `pref` is an out-parameter)
-    UnicodeString ks;
-    LocalPointer<UnicodeString> ksP;
+    int32_t numSelectors = dataModel.numSelectors();
     int32_t numVariants = dataModel.numVariants();
-    const Variant* variants = dataModel.getVariantsInternal();
-    // 2. For each index i in res
-    for (int32_t i = 0; i < res.size(); i++) {
-        // 2i. Let keys be a new empty list of strings.
-        LocalPointer<UVector> keys(createUVector(status));
-        CHECK_ERROR(status);
-        // 2ii. For each variant `var` of the message
-        for (int32_t variantNum = 0; variantNum < numVariants; variantNum++) {
-            const SelectorKeys& selectorKeys = variants[variantNum].getKeys();
-
-            // Note: Here, `var` names the key list of `var`,
-            // not a Variant itself
-            const Key* var = selectorKeys.getKeysInternal();
-            // 2ii(a). Let `key` be the `var` key at position i.
-            U_ASSERT(i < selectorKeys.len); // established by semantic check in formatSelectors()
-            const Key& key = var[i];
-            // 2ii(b). If `key` is not the catch-all key '*'
-            if (!key.isWildcard()) {
-                // 2ii(b)(a) Assert that key is a literal.
-                // (Not needed)
-                // 2ii(b)(b) Let `ks` be the resolved value of `key` in Unicode Normalization Form C.
-                ks = StandardFunctions::normalizeNFC(key.asLiteral().unquoted());
-                // 2ii(b)(c) Append `ks` as the last element of the list `keys`.
-                ksP.adoptInstead(create<UnicodeString>(std::move(ks), status));
-                CHECK_ERROR(status);
-                keys->adoptElement(ksP.orphan(), status);
-            }
-        }
-        // 2iii. Let `rv` be the resolved value at index `i` of `res`.
-        U_ASSERT(i < res.size());
-        InternalValue rv = std::move(*(static_cast<InternalValue*>(res[i])));
-        // 2iv. Let matches be the result of calling the method MatchSelectorKeys(rv, keys)
-        LocalPointer<UVector> matches(createUVector(status));
-        matchSelectorKeys(*keys, context, std::move(rv), *matches, status);
-        // 2v. Append `matches` as the last element of the list `pref`
-        pref.adoptElement(matches.orphan(), status);
+    if (numSelectors == 0) {
+        return;
     }
-}
+    const Variant* variants = dataModel.getVariantsInternal();
 
-// `v` is assumed to be a vector of strings
-static int32_t vectorFind(const UVector& v, const UnicodeString& k) {
-    for (int32_t i = 0; i < v.size(); i++) {
-        if (*static_cast<UnicodeString*>(v[i]) == k) {
-            return i;
-        }
+    LocalPointer<VariantTable> table(new VariantTable());
+    if (!table.isValid()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    table->numSelectors = numSelectors;
+    table->keyStarts.adoptInstead(new int32_t[numSelectors + 1]);
+    table->variantKeyNumbers.adoptInstead(new int32_t[numVariants * numSelectors + 1]);
+    // There are at most numVariants keys per selector
+    table->keys.adoptInstead(new UnicodeString[numVariants * numSelectors + 1]);
+    table->keyNumbers.adoptInstead(new int32_t[numVariants * numSelectors + 1]);
+    if (table->keyStarts.isNull() || table->variantKeyNumbers.isNull() ||
+            table->keys.isNull() || table->keyNumbers.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
     }
-    return -1;
-}
-
-static UBool vectorContains(const UVector& v, const UnicodeString& k) {
-    return (vectorFind(v, k) != -1);
-}
-
-// See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#filter-variants
-// `pref` is a vector of vectors of strings. `vars` is a vector of PrioritizedVariants
-void MessageFormatter::filterVariants(const UVector& pref, UVector& vars, UErrorCode& status) const {
-    const Variant* variants = dataModel.getVariantsInternal();
 
-    // 1. Let `vars` be a new empty list of variants.
-    // (Not needed since `vars` is an out-parameter)
-    // 2. For each variant `var` of the message:
-    for (int32_t j = 0; j < dataModel.numVariants(); j++) {
-        const SelectorKeys& selectorKeys = variants[j].getKeys();
-        const Pattern& p = variants[j].getPattern();
-
-        // Note: Here, `var` names the key list of `var`,
-        // not a Variant itself
-        const Key* var = selectorKeys.getKeysInternal();
-        // 2i. For each index `i` in `pref`:
-        bool noMatch = false;
-        for (int32_t i = 0; i < pref.size(); i++) {
-            // 2i(a). Let `key` be the `var` key at position `i`.
-            U_ASSERT(i < selectorKeys.len);
-            const Key& key = var[i];
-            // 2i(b). If key is the catch-all key '*':
-            if (key.isWildcard()) {
-                // 2i(b)(a). Continue the inner loop on pref.
+    int32_t numKeys = 0;
+    for (int32_t i = 0; i < numSelectors; i++) {
+        int32_t start = numKeys;
+        table->keyStarts[i] = start;
+        for (int32_t j = 0; j < numVariants; j++) {
+            const SelectorKeys& selectorKeys = variants[j].getKeys();
+            int32_t& keyNumber = table->variantKeyNumbers[j * numSelectors + i];
+            keyNumber = -1;
+            // Variants with the wrong number of keys are a data model error,
+            // which prevents pattern selection; a missing key is treated as `*`.
+            if (i >= selectorKeys.len) {
                 continue;
             }
-            // 2i(c). Assert that `key` is a literal.
-            // (Not needed)
-            // 2i(d). Let `ks` be the resolved value of `key`.
-            UnicodeString ks = StandardFunctions::normalizeNFC(key.asLiteral().unquoted());
-            // 2i(e). Let `matches` be the list of strings at index `i` of `pref`.
-            const UVector& matches = *(static_cast<UVector*>(pref[i])); // `matches` is a vector of strings
-            // 2i(f). If `matches` includes `ks`
-            if (vectorContains(matches, ks)) {
-                // 2i(f)(a). Continue the inner loop on `pref`.
+            const Key& key = selectorKeys.getKeysInternal()[i];
+            if (key.isWildcard()) {
                 continue;
             }
-            // 2i(g). Else:
-            // 2i(g)(a). Continue the outer loop on message variants.
-            noMatch = true;
-            break;
-        }
-        if (!noMatch) {
-            // Append `var` as the last element of the list `vars`.
-	    PrioritizedVariant* tuple = create<PrioritizedVariant>(PrioritizedVariant(-1, selectorKeys, p), status);
-            CHECK_ERROR(status);
-            vars.adoptElement(tuple, status);
-        }
-    }
-}
-
-// See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#sort-variants
-// Leaves the preferred variant as element 0 in `sortable`
-// Note: this sorts in-place, so `sortable` is just `vars`
-// `pref` is a vector of vectors of strings; `vars` is a vector of PrioritizedVariants
-void MessageFormatter::sortVariants(const UVector& pref, UVector& vars, UErrorCode& status) const {
-    CHECK_ERROR(status);
-
-// Note: steps 1 and 2 are omitted since we use `vars` as `sortable` (we sort in-place)
-    // 1. Let `sortable` be a new empty list of (integer, variant) tuples.
-    // (Not needed since `sortable` is an out-parameter)
-    // 2. For each variant `var` of `vars`
-    // 2i. Let tuple be a new tuple (-1, var).
-    // 2ii. Append `tuple` as the last element of the list `sortable`.
-
-    // 3. Let `len` be the integer count of items in `pref`.
-    int32_t len = pref.size();
-    // 4. Let `i` be `len` - 1.
-    int32_t i = len - 1;
-    // 5. While i >= 0:
-    while (i >= 0) {
-        // 5i. Let `matches` be the list of strings at index `i` of `pref`.
-        U_ASSERT(pref[i] != nullptr);
-	const UVector& matches = *(static_cast<UVector*>(pref[i])); // `matches` is a vector of strings
-        // 5ii. Let `minpref` be the integer count of items in `matches`.
-        int32_t minpref = matches.size();
-        // 5iii. For each tuple `tuple` of `sortable`:
-        for (int32_t j = 0; j < vars.size(); j++) {
-            U_ASSERT(vars[j] != nullptr);
-            PrioritizedVariant& tuple = *(static_cast<PrioritizedVariant*>(vars[j]));
-            // 5iii(a). Let matchpref be an integer with the value minpref.
-            int32_t matchpref = minpref;
-            // 5iii(b). Let `key` be the tuple variant key at position `i`.
-            const Key* tupleVariantKeys = tuple.keys.getKeysInternal();
-            U_ASSERT(i < tuple.keys.len); // Given by earlier semantic checking
-            const Key& key = tupleVariantKeys[i];
-            // 5iii(c) If `key` is not the catch-all key '*':
-            if (!key.isWildcard()) {
-                // 5iii(c)(a). Assert that `key` is a literal.
-                // (Not needed)
-                // 5iii(c)(b). Let `ks` be the resolved value of `key`.
-                UnicodeString ks = StandardFunctions::normalizeNFC(key.asLiteral().unquoted());
-                // 5iii(c)(c) Let matchpref be the integer position of ks in `matches`.
-                matchpref = vectorFind(matches, ks);
-                U_ASSERT(matchpref >= 0);
+            UnicodeString& ks = table->keys[numKeys];
+            ks = StandardFunctions::normalizeNFC(key.asLiteral().unquoted());
+            keyNumber = numKeys - start;
+            for (int32_t k = start; k < numKeys; k++) {
+                if (table->keys[k] == ks) {
+                    keyNumber = k - start;
+                    break;
+                }
             }
-            // 5iii(d) Set the `tuple` integer value as matchpref.
-            tuple.priority = matchpref;
+            table->keyNumbers[numKeys] = keyNumber;
+            numKeys++;
         }
-        // 5iv. Set `sortable` to be the result of calling the method SortVariants(`sortable`)
-        vars.sort(comparePrioritizedVariants, status);
-        CHECK_ERROR(status);
-        // 5v. Set `i` to be `i` - 1.
-        i--;
     }
-    // The caller is responsible for steps 6 and 7
-    // 6. Let `var` be the `variant` element of the first element of `sortable`.
-    // 7. Select the pattern of `var`
+    table->keyStarts[numSelectors] = numKeys;
+    variantTable = table.orphan();
 }
 
+// See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#pattern-selection
+//
+// Resolve Preferences, Filter Variants and Sort Variants are combined, using the
+// key numbers from the variant table: for each variant, the priority of its key at
+// position `i` is the position of that key in the list of matches for selector `i`
+// (or the length of that list, for the catch-all key). Sorting the variants
+// successively by these priorities, from the last selector to the first,
+// puts first the matching variant whose list of priorities is lexicographically
+// smallest; this is computed directly, without sorting.
 void MessageFormatter::formatSelectors(MessageContext& context,
                                        Environment& env,
                                        UErrorCode &status,
                                        UnicodeString& result) const {
     CHECK_ERROR(status);
-
-    // See https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#pattern-selection
+    if (variantTable == nullptr) {
+        // Only possible if the constructor failed
+        status = U_INVALID_STATE_ERROR;
+        return;
+    }
 
     // Resolve Selectors
     // res is a vector of InternalValues
     LocalPointer<UVector> res(createUVector(status));
     CHECK_ERROR(status);
     resolveSelectors(context, env, status, *res);
-
-    // Resolve Preferences
-    // pref is a vector of vectors of strings
-    LocalPointer<UVector> pref(createUVector(status));
-    CHECK_ERROR(status);
-    resolvePreferences(context, *res, *pref, status);
-
-    // Filter Variants
-    // vars is a vector of PrioritizedVariants
-    LocalPointer<UVector> vars(createUVector(status));
     CHECK_ERROR(status);
-    filterVariants(*pref, *vars, status);
 
-    // Sort Variants and select the final pattern
-    // Note: `sortable` in the spec is just `vars` here,
-    // which is sorted in-place
-    sortVariants(*pref, *vars, status);
+    const VariantTable& table = *variantTable;
+    int32_t numSelectors = res->size();
+    int32_t numVariants = dataModel.numVariants();
+    U_ASSERT(numSelectors == dataModel.numSelectors());
+
+    // priorities[j * numSelectors + i] is the priority of variant `j` for selector `i`,
+    // or -1 if its key does not match
+    MaybeStackArray<int32_t, 32> priorities;
+    MaybeStackArray<int32_t, 16> prefs;
+    if (priorities.getCapacity() < numVariants * numSelectors &&
+            priorities.resize(numVariants * numSelectors) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < numSelectors; i++) {
+        // Resolve Preferences for selector `i`
+        int32_t keysLen = table.getKeysLength(i);
+        if (prefs.getCapacity() < keysLen && prefs.resize(keysLen) == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        int32_t prefsLen = 0;
+        InternalValue rv = std::move(*(static_cast<InternalValue*>((*res)[i])));
+        matchSelectorKeys(table.getKeys(i), keysLen, context, std::move(rv),
+                          prefs.getAlias(), prefsLen, status);
+        CHECK_ERROR(status);
 
-    CHECK_ERROR(status);
+        for (int32_t j = 0; j < numVariants; j++) {
+            int32_t keyNumber = table.getVariantKeyNumber(j, i);
+            int32_t priority = -1;
+            if (keyNumber < 0) {
+                // The catch-all key matches with the lowest priority
+                priority = prefsLen;
+            } else {
+                for (int32_t p = 0; p < prefsLen; p++) {
+                    if (table.getKeyNumber(i, prefs[p]) == keyNumber) {
+                        priority = p;
+                        break;
+                    }
+                }
+            }
+            priorities[j * numSelectors + i] = priority;
+        }
+    }
 
-    // 6. Let `var` be the `variant` element of the first element of `sortable`.
-    U_ASSERT(vars->size() > 0); // This should have been checked earlier (having 0 variants would be a data model error)
-    const PrioritizedVariant& var = *(static_cast<PrioritizedVariant*>(vars->elementAt(0)));
-    // 7. Select the pattern of `var`
-    const Pattern& pat = var.pat;
+    // Filter Variants and Sort Variants
+    const int32_t* best = nullptr;
+    int32_t bestVariant = -1;
+    for (int32_t j = 0; j < numVariants; j++) {
+        const int32_t* variantPriorities = priorities.getAlias() + j * numSelectors;
+        bool matches = true;
+        for (int32_t i = 0; i < numSelectors; i++) {
+            if (variantPriorities[i] < 0) {
+                matches = false;
+                break;
+            }
+        }
+        if (!matches) {
+            continue;
+        }
+        bool isBetter = best == nullptr;
+        for (int32_t i = 0; !isBetter && i < numSelectors; i++) {
+            if (variantPriorities[i] != best[i]) {
+                isBetter = variantPriorities[i] < best[i];
+                break;
+            }
+        }
+        if (isBetter) {
+            best = variantPriorities;
+            bestVariant = j;
+        }
+    }
 
-    // Format the pattern
+    // The catch-all variant always matches; not having one is a data model error
+    U_ASSERT(bestVariant >= 0);
+    if (bestVariant < 0) {
+        return;
+    }
+    // Select the pattern of the best variant, and format it
+    const Pattern& pat = dataModel.getVariantsInternal()[bestVariant].getPattern();
     formatPattern(context, env, pat, status, result);
 }
 
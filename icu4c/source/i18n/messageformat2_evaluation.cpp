@@ -367,17 +367,10 @@ void InternalValue::update(const UnicodeString& fb) {
     val = fb;
 }
 
-// PrioritizedVariant
-// ------------------
+// VariantTable
+// ------------
 
-UBool PrioritizedVariant::operator<(const PrioritizedVariant& other) const {
-  if (priority < other.priority) {
-      return true;
-  }
-  return false;
-}
-
-PrioritizedVariant::~PrioritizedVariant() {}
+VariantTable::~VariantTable() {}
 
     // ---------------- Environments and closures
 
@@ -187,36 +187,48 @@ namespace message2 {
             VariableValue(const FunctionValue*);
     }; // class VariableValue
 
-    // PrioritizedVariant
-
-    // For how this class is used, see the references to (integer, variant) tuples
-    // in https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#pattern-selection
-    class PrioritizedVariant : public UObject {
+    // VariantTable
+
+    // The keys of the variants of a message with selectors, NFC-normalized and
+    // numbered once by the MessageFormatter constructor. Pattern selection
+    // ( https://github.com/unicode-org/message-format-wg/blob/main/spec/formatting.md#pattern-selection )
+    // then compares key numbers instead of normalizing and comparing strings
+    // on each call.
+    class VariantTable : public UMemory {
     public:
-        PrioritizedVariant() = default;
-        PrioritizedVariant(PrioritizedVariant&&) = default;
-        PrioritizedVariant& operator=(PrioritizedVariant&&) noexcept = default;
-        UBool operator<(const PrioritizedVariant&) const;
-        int32_t priority;
-        /* const */ SelectorKeys keys;
-        /* const */ Pattern pat;
-        PrioritizedVariant(uint32_t p,
-                           const SelectorKeys& k,
-                           const Pattern& pattern) noexcept : priority(p), keys(k), pat(pattern) {}
-        virtual ~PrioritizedVariant();
-    }; // class PrioritizedVariant
-
-    static inline int32_t comparePrioritizedVariants(UElement left, UElement right) {
-        const PrioritizedVariant& tuple1 = *(static_cast<const PrioritizedVariant*>(left.pointer));
-        const PrioritizedVariant& tuple2 = *(static_cast<const PrioritizedVariant*>(right.pointer));
-        if (tuple1 < tuple2) {
-            return -1;
+        // The keys at position `selector` of all variants, in variant order, omitting
+        // catch-all keys. This is the list `keys` of "Resolve Preferences".
+        const UnicodeString* getKeys(int32_t selector) const {
+            return keys.getAlias() + keyStarts[selector];
         }
-        if (tuple1.priority == tuple2.priority) {
-            return 0;
+        int32_t getKeysLength(int32_t selector) const {
+            return keyStarts[selector + 1] - keyStarts[selector];
         }
-        return 1;
-    }
+        // The number of a key in getKeys(selector): the index of the first
+        // key in the list that is equal to it
+        int32_t getKeyNumber(int32_t selector, int32_t index) const {
+            return keyNumbers[keyStarts[selector] + index];
+        }
+        // The number of the key of `variant` at position `selector`,
+        // or -1 if it is the catch-all key
+        int32_t getVariantKeyNumber(int32_t variant, int32_t selector) const {
+            return variantKeyNumbers[variant * numSelectors + selector];
+        }
+        VariantTable() = default;
+        virtual ~VariantTable();
+    private:
+        friend class MessageFormatter;
+
+        int32_t numSelectors = 0;
+        // Keys for all selectors, concatenated
+        LocalArray<UnicodeString> keys;
+        // Start of the keys of each selector in `keys`, plus the total number of keys
+        LocalArray<int32_t> keyStarts;
+        // Parallel to `keys`
+        LocalArray<int32_t> keyNumbers;
+        // numVariants rows of numSelectors key numbers
+        LocalArray<int32_t> variantKeyNumbers;
+    }; // class VariantTable
 
     // Closures and environments
     // -------------------------
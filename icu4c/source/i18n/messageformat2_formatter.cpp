@@ -217,6 +217,9 @@ namespace message2 {
             errors = errorsNew.orphan();
         }
 
+        // Prepare the variant keys for pattern selection
+        buildVariantTable(success);
+
         // Note: we currently evaluate variables lazily,
         // without memoization. This call is still necessary
         // to check out-of-scope uses of local variables in
@@ -232,6 +235,8 @@ namespace message2 {
             delete errors;
             errors = nullptr;
         }
+        delete variantTable;
+        variantTable = nullptr;
     }
 
     MessageFormatter& MessageFormatter::operator=(MessageFormatter&& other) noexcept {
@@ -248,6 +253,8 @@ namespace message2 {
         bidiIsolationStyle = other.bidiIsolationStyle;
         errors = other.errors;
         other.errors = nullptr;
+        variantTable = other.variantTable;
+        other.variantTable = nullptr;
         return *this;
     }
 
@@ -592,6 +592,122 @@ LocalPointer<FunctionValue> StandardFunctions::Number::call(const FunctionContex
     return nf.locale(locale);
 }
 
+// Appends to `key` a string that identifies the value of `opt`, as seen by
+// formatterForOptions(). Returns false if the value has a type that is not
+// worth caching a formatter for.
+static bool appendOptionKey(const ResolvedFunctionOption& opt, UnicodeString& key) {
+    UErrorCode localStatus = U_ZERO_ERROR;
+    const FunctionValue& value = opt.getValue();
+    const Formattable& operand = value.unwrap();
+    key.append(opt.getName()).append(u'=');
+    // String-valued options are read through formatToString(), and digit size
+    // options through the operand, so the key consists of both.
+    key.append(value.formatToString(localStatus)).append(u'\0');
+    switch (operand.getType()) {
+    case UFMT_STRING:
+        key.append(u's').append(operand.getString(localStatus));
+        break;
+    case UFMT_DOUBLE: {
+        double d = operand.getDouble(localStatus);
+        uint64_t bits;
+        uprv_memcpy(&bits, &d, sizeof(bits));
+        key.append(u'd');
+        for (int32_t shift = 0; shift < 64; shift += 16) {
+            key.append(static_cast<char16_t>(bits >> shift));
+        }
+        break;
+    }
+    case UFMT_LONG:
+    case UFMT_INT64: {
+        int64_t i = operand.getInt64(localStatus);
+        key.append(u'i');
+        for (int32_t shift = 0; shift < 64; shift += 16) {
+            key.append(static_cast<char16_t>(static_cast<uint64_t>(i) >> shift));
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+    key.append(u'\0');
+    return U_SUCCESS(localStatus);
+}
+
+StandardFunctions::Number::SharedFormatter::~SharedFormatter() {}
+
+const StandardFunctions::Number::SharedFormatter*
+StandardFunctions::Number::formatterFor(const Locale& locale,
+                                        const FunctionOptions& opts,
+                                        UErrorCode& status) {
+    NULL_ON_ERROR(status);
+
+    UnicodeString key;
+    bool cacheable = true;
+    for (int32_t i = 0; cacheable && i < opts.optionsCount(); i++) {
+        cacheable = appendOptionKey(opts.options[i], key);
+    }
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (int32_t i = 0; i < cachedFormattersLength; i++) {
+            const CachedFormatter& entry = cachedFormatters[i];
+            if (entry.optionsKey == key && entry.locale == locale) {
+                entry.formatter->addRef();
+                return entry.formatter;
+            }
+        }
+    }
+
+    // Build the formatter without holding the lock.
+    number::LocalizedNumberFormatter formatter = formatterForOptions(*this, locale, opts, status);
+    NULL_ON_ERROR(status);
+    SharedFormatter* shared = new SharedFormatter(std::move(formatter));
+    if (shared == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    shared->addRef();  // for the caller
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        CachedFormatter& entry = cachedFormatters[nextCachedFormatter];
+        entry.locale = locale;
+        entry.optionsKey = std::move(key);
+        SharedObject::copyPtr(shared, entry.formatter);
+        nextCachedFormatter = (nextCachedFormatter + 1) % FORMATTER_CACHE_SIZE;
+        if (cachedFormattersLength < FORMATTER_CACHE_SIZE) {
+            cachedFormattersLength++;
+        }
+    }
+    return shared;
+}
+
+const SharedPluralRules* StandardFunctions::Number::pluralRulesFor(const Locale& locale,
+                                                                   UPluralType type,
+                                                                   UErrorCode& status) {
+    NULL_ON_ERROR(status);
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (pluralRules[type] != nullptr && pluralRulesLocales[type] == locale) {
+            pluralRules[type]->addRef();
+            return pluralRules[type];
+        }
+    }
+
+    LocalPointer<PluralRules> rules(PluralRules::forLocale(locale, type, status), status);
+    NULL_ON_ERROR(status);
+    SharedPluralRules* shared = new SharedPluralRules(rules.getAlias());
+    if (shared == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    rules.orphan();
+    shared->addRef();  // for the caller
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    SharedObject::copyPtr(shared, pluralRules[type]);
+    pluralRulesLocales[type] = locale;
+    return shared;
+}
+
 static double parseNumberLiteral(const UnicodeString& inputStr, UErrorCode& errorCode) {
     if (U_FAILURE(errorCode)) {
         return {};
@@ -722,11 +838,11 @@ bool StandardFunctions::Number::usePercent(const FunctionOptions& opts) const {
     return (style == UnicodeString("percent"));
 }
 
-StandardFunctions::NumberValue::NumberValue(const Number& parent,
+StandardFunctions::NumberValue::NumberValue(Number& parent,
                                             const FunctionContext& context,
                                             const FunctionValue& arg,
                                             const FunctionOptions& options,
-                                            UErrorCode& errorCode) {
+                                            UErrorCode& errorCode) : parent(&parent) {
     CHECK_ERROR(errorCode);
     // Must have an argument
     if (arg.isNullOperand()) {
@@ -741,12 +857,12 @@ StandardFunctions::NumberValue::NumberValue(const Number& parent,
     inputDir = context.getDirection();
     dir = outputDirectionalityFromUDir(inputDir, locale);
 
-    number::LocalizedNumberFormatter realFormatter;
-    realFormatter = formatterForOptions(parent, locale, opts, errorCode);
+    const Number::SharedFormatter* formatter = parent.formatterFor(locale, opts, errorCode);
 
     int64_t integerValue = 0;
 
     if (U_SUCCESS(errorCode)) {
+        const number::LocalizedNumberFormatter& realFormatter = formatter->formatter;
         switch (innerValue.getType()) {
         case UFMT_DOUBLE: {
             double d = innerValue.getDouble(errorCode);
@@ -774,8 +890,10 @@ StandardFunctions::NumberValue::NumberValue(const Number& parent,
             const UnicodeString& s = innerValue.getString(errorCode);
             U_ASSERT(U_SUCCESS(errorCode));
             double d = parseNumberLiteral(s, errorCode);
-            if (U_FAILURE(errorCode))
+            if (U_FAILURE(errorCode)) {
+                formatter->removeRef();
                 return;
+            }
             formattedNumber = realFormatter.formatDouble(d, errorCode);
             integerValue = static_cast<int64_t>(std::round(d));
             break;
@@ -786,6 +904,7 @@ StandardFunctions::NumberValue::NumberValue(const Number& parent,
             break;
         }
         }
+        formatter->removeRef();
     }
 
     // Ignore U_USING_DEFAULT_WARNING
@@ -807,7 +926,14 @@ UnicodeString StandardFunctions::NumberValue::formatToString(UErrorCode& errorCo
     return formattedNumber.toString(errorCode);
 }
 
-StandardFunctions::Number::~Number() {}
+StandardFunctions::Number::~Number() {
+    for (int32_t i = 0; i < cachedFormattersLength; i++) {
+        SharedObject::clearPtr(cachedFormatters[i].formatter);
+    }
+    for (int32_t i = 0; i < UPLURAL_TYPE_COUNT; i++) {
+        SharedObject::clearPtr(pluralRules[i]);
+    }
+}
 StandardFunctions::NumberValue::~NumberValue() {}
 
 /* static */ StandardFunctions::Number::PluralType
@@ -851,10 +977,11 @@ void StandardFunctions::NumberValue::selectKeys(const UnicodeString* keys,
     if (type != Number::PluralType::PLURAL_EXACT) {
         UPluralType t = type == Number::PluralType::PLURAL_ORDINAL ? UPLURAL_TYPE_ORDINAL : UPLURAL_TYPE_CARDINAL;
         // Look up plural rules by locale and type
-        LocalPointer<PluralRules> rules(PluralRules::forLocale(locale, t, errorCode));
+        const SharedPluralRules* rules = parent->pluralRulesFor(locale, t, errorCode);
         CHECK_ERROR(errorCode);
 
-        keyword = rules->select(formattedNumber, errorCode);
+        keyword = (*rules)->select(formattedNumber, errorCode);
+        rules->removeRef();
     }
 
     // Steps 3-4 elided:
@@ -868,18 +995,21 @@ void StandardFunctions::NumberValue::selectKeys(const UnicodeString* keys,
     // 5. For each string key in keys:
     double keyAsDouble = 0;
     for (int32_t i = 0; i < keysLen; i++) {
+        // The string comparison of step 5i(a) is done first,
+        // since parsing the key is much more expensive
+        if (exact != keys[i]) {
+            continue;
+        }
         // Try parsing the key as a double
         UErrorCode localErrorCode = U_ZERO_ERROR;
         strToDouble(keys[i], keyAsDouble, localErrorCode);
         // 5i. If the value of key matches the production number-literal, then
         if (U_SUCCESS(localErrorCode)) {
             // 5i(a). If key and exact consist of the same sequence of Unicode code points, then
-            if (exact == keys[i]) {
-                // 5i(a)(a) Append key as the last element of the list resultExact.
-		prefs[prefsLen] = i;
-                prefsLen++;
-                break;
-            }
+            // 5i(a)(a) Append key as the last element of the list resultExact.
+            prefs[prefsLen] = i;
+            prefsLen++;
+            break;
         }
     }
 
@@ -16,8 +16,14 @@
 
 #if !UCONFIG_NO_MF2
 
+#include <mutex>
+
 #include "unicode/datefmt.h"
 #include "unicode/messageformat2_function_registry.h"
+#include "unicode/numberformatter.h"
+#include "unicode/plurrule.h"
+#include "sharedobject.h"
+#include "sharedpluralrules.h"
 
 U_NAMESPACE_BEGIN
 
@@ -161,6 +167,23 @@ static constexpr std::u16string_view YEAR = u"year";
             static Number* create(bool, UErrorCode&);
             Number(bool isInt) : isInteger(isInt) /*, icuFormatter(number::NumberFormatter::withLocale(loc))*/ {}
 
+            // A formatter shared between the cache and the values using it
+            class SharedFormatter : public SharedObject {
+            public:
+                SharedFormatter(number::LocalizedNumberFormatter&& f) : formatter(std::move(f)) {}
+                virtual ~SharedFormatter();
+                const number::LocalizedNumberFormatter formatter;
+            };
+
+            // Returns a formatter for the given locale and resolved options. Formatters are
+            // kept across calls, so that formatting a message does not rebuild (and reload the
+            // locale data of) a number formatter for each placeholder.
+            // The caller must call removeRef() on the result.
+            const SharedFormatter* formatterFor(const Locale&, const FunctionOptions&, UErrorCode&);
+            // Returns the plural rules of the given type for `locale`.
+            // The caller must call removeRef() on the result.
+            const SharedPluralRules* pluralRulesFor(const Locale&, UPluralType, UErrorCode&);
+
         // These options have their own accessor methods, since they have different default values.
             int32_t digitSizeOption(const FunctionOptions&, const UnicodeString&) const;
             int32_t maximumFractionDigits(const FunctionOptions& options) const;
@@ -174,6 +197,24 @@ static constexpr std::u16string_view YEAR = u"year";
             const number::LocalizedNumberFormatter icuFormatter;
 
             static PluralType pluralType(const FunctionOptions& opts);
+
+            // The caches below are used by the const MessageFormatter::formatToString()
+            // and thus from several threads at once. They only hold references, so that an
+            // entry that is replaced stays alive until the last value using it is done.
+            std::mutex cacheMutex;
+            // Formatters returned by formatterFor(), replaced round-robin
+            static constexpr int32_t FORMATTER_CACHE_SIZE = 4;
+            struct CachedFormatter {
+                Locale locale;
+                UnicodeString optionsKey;
+                const SharedFormatter* formatter = nullptr;
+            };
+            CachedFormatter cachedFormatters[FORMATTER_CACHE_SIZE];
+            int32_t cachedFormattersLength = 0;
+            int32_t nextCachedFormatter = 0;
+            // Rules returned by pluralRulesFor(), indexed by UPluralType
+            Locale pluralRulesLocales[UPLURAL_TYPE_COUNT];
+            const SharedPluralRules* pluralRules[UPLURAL_TYPE_COUNT] = {};
         };
 
         static number::LocalizedNumberFormatter formatterForOptions(const Number& number,
@@ -198,7 +239,9 @@ static constexpr std::u16string_view YEAR = u"year";
             friend class Number;
 
             number::FormattedNumber formattedNumber;
-            NumberValue(const Number&,
+            // The function that created this value; outlives it
+            Number* parent = nullptr;
+            NumberValue(Number&,
                         const FunctionContext&,
                         const FunctionValue&,
                         const FunctionOptions&,
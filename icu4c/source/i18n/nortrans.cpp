@@ -136,8 +136,31 @@ void NormalizationTransliterator::handleTransliterate(Replaceable& text, UTransP
     UErrorCode errorCode = U_ZERO_ERROR;
     UnicodeString segment;
     UnicodeString normalized;
-    UChar32 c = text.char32At(start);
+    // For text in a UnicodeString, skip each already-normalized run in
+    // one step instead of normalizing it chunk by chunk.
+    const UnicodeString* str = dynamic_cast<const UnicodeString*>(&text);
+    UChar32 c;
     do {
+        if(str != nullptr) {
+            // The buffer may move when the text is modified.
+            UnicodeString rest(false, str->getBuffer() + start, limit - start);
+            int32_t spanLength = fNorm2.spanQuickCheckYes(rest, errorCode);
+            if(U_FAILURE(errorCode)) {
+                break;
+            }
+            // The span ends at a normalization boundary, unless it reaches
+            // the limit, which is not a boundary in incremental mode.
+            // Then the rest is normalized chunk by chunk.
+            if(spanLength == rest.length() && isIncremental) {
+                str = nullptr;
+            } else {
+                start += spanLength;
+                if(start == limit) {
+                    break;
+                }
+            }
+        }
+        c = text.char32At(start);
         int32_t prev = start;
         // Skip at least one character so we make progress.
         // c holds the character at start.
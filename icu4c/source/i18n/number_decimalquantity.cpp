@@ -16,6 +16,7 @@
 #include "putilimp.h"
 #include "number_decimalquantity.h"
 #include "number_roundingutils.h"
+#include "number_ryu.h"
 #include "double-conversion.h"
 #include "charstr.h"
 #include "number_utils.h"
@@ -68,6 +69,35 @@ double DOUBLE_MULTIPLIERS[] = {
         1e20,
         1e21};
 
+#if !UNUM_SHORTEST_DOUBLE_USE_RYU
+/** Number of fraction digits for which convertToAccurateDouble() looks for a short decimal. */
+constexpr int32_t MAX_SHORT_FRACTION_DIGITS = 8;
+#endif
+
+/**
+ * Converts a nonzero integer below 10^16 to the packed BCD of the long implementation,
+ * two digits per division.
+ */
+inline uint64_t uint64ToBcd(uint64_t n, int32_t& precision) {
+    U_ASSERT(n != 0 && n < 10000000000000000ULL);
+    uint64_t result = 0;
+    int32_t length = 0;
+    for (; n >= 100; n /= 100, length += 2) {
+        auto pair = static_cast<uint32_t>(n % 100);
+        result |= static_cast<uint64_t>(((pair / 10) << 4) | (pair % 10)) << (length * 4);
+    }
+    if (n >= 10) {
+        auto pair = static_cast<uint32_t>(n);
+        result |= static_cast<uint64_t>(((pair / 10) << 4) | (pair % 10)) << (length * 4);
+        length += 2;
+    } else {
+        result |= n << (length * 4);
+        length += 1;
+    }
+    precision = length;
+    return result;
+}
+
 }  // namespace
 
 icu::IFixedDecimal::~IFixedDecimal() = default;
@@ -506,6 +536,36 @@ void DecimalQuantity::convertToAccurateDouble() {
     U_ASSERT(origDouble != 0);
     int32_t delta = origDelta;
 
+#if UNUM_SHORTEST_DOUBLE_USE_RYU
+    // Write the shortest decimal straight into the BCD.
+    uint64_t significand;
+    int32_t exponent;
+    doubleToShortestDecimal(origDouble, significand, exponent);
+    setBcdToZero();
+    readLongToBcd(static_cast<int64_t>(significand));
+    scale = exponent + delta;
+    explicitExactDouble = true;
+#else
+    // Most doubles in practice are short decimals like 1234.5678. If r / 10^k rounds back to
+    // the double for the smallest such k, then r * 10^-k is its shortest representation, and
+    // it is unique as long as r * 10^-k is much coarser than the double's ulp.
+    double n = origDouble;
+    for (int32_t k = 0; k <= MAX_SHORT_FRACTION_DIGITS; k++) {
+        double scaled = n * DOUBLE_MULTIPLIERS[k];
+        if (scaled >= 1125899906842624.0) { // 2^50
+            break;
+        }
+        double r = uprv_round(scaled);
+        if (r != 0 && r / DOUBLE_MULTIPLIERS[k] == n) {
+            setBcdToZero();
+            readLongToBcd(static_cast<int64_t>(r));
+            compact();
+            scale += delta - k;
+            explicitExactDouble = true;
+            return;
+        }
+    }
+
     // Call the slow oracle function (Double.toString in Java, DoubleToAscii in C++).
     char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
     bool sign; // unused; always positive
@@ -526,6 +586,7 @@ void DecimalQuantity::convertToAccurateDouble() {
     readDoubleConversionToBcd(buffer, length, point);
     scale += delta;
     explicitExactDouble = true;
+#endif
 }
 
 DecimalQuantity &DecimalQuantity::setToDecNumber(StringPiece n, UErrorCode& status) {
@@ -1194,15 +1255,9 @@ void DecimalQuantity::setBcdToZero() {
 void DecimalQuantity::readIntToBcd(int32_t n) {
     U_ASSERT(n != 0);
     // ints always fit inside the long implementation.
-    uint64_t result = 0L;
-    int i = 16;
-    for (; n != 0; n /= 10, i--) {
-        result = (result >> 4) + ((static_cast<uint64_t>(n) % 10) << 60);
-    }
     U_ASSERT(!usingBytes);
-    fBCD.bcdLong = result >> (i * 4);
+    fBCD.bcdLong = uint64ToBcd(static_cast<uint64_t>(n), precision);
     scale = 0;
-    precision = 16 - i;
 }
 
 void DecimalQuantity::readLongToBcd(int64_t n) {
@@ -1217,16 +1272,9 @@ void DecimalQuantity::readLongToBcd(int64_t n) {
         scale = 0;
         precision = i;
     } else {
-        uint64_t result = 0L;
-        int i = 16;
-        for (; n != 0L; n /= 10L, i--) {
-            result = (result >> 4) + ((n % 10) << 60);
-        }
-        U_ASSERT(i >= 0);
         U_ASSERT(!usingBytes);
-        fBCD.bcdLong = result >> (i * 4);
+        fBCD.bcdLong = uint64ToBcd(static_cast<uint64_t>(n), precision);
         scale = 0;
-        precision = 16 - i;
     }
 }
 
@@ -1299,16 +1347,23 @@ void DecimalQuantity::compact() {
         }
 
         // Compact the number (remove trailing zeros)
-        // TODO: Use a more efficient algorithm here and below. There is a logarithmic one.
+        // Binary search for the lowest and highest nonzero nibbles.
+        uint64_t bcdLong = fBCD.bcdLong;
         int32_t delta = 0;
-        for (; delta < precision && getDigitPos(delta) == 0; delta++);
-        fBCD.bcdLong >>= delta * 4;
+        if ((bcdLong & 0xffffffff) == 0) { delta += 8; bcdLong >>= 32; }
+        if ((bcdLong & 0xffff) == 0) { delta += 4; bcdLong >>= 16; }
+        if ((bcdLong & 0xff) == 0) { delta += 2; bcdLong >>= 8; }
+        if ((bcdLong & 0xf) == 0) { delta += 1; bcdLong >>= 4; }
+        fBCD.bcdLong = bcdLong;
         scale += delta;
 
         // Compute precision
-        int32_t leading = precision - 1;
-        for (; leading >= 0 && getDigitPos(leading) == 0; leading--);
-        precision = leading + 1;
+        int32_t digits = 1;
+        if ((bcdLong >> 32) != 0) { digits += 8; bcdLong >>= 32; }
+        if ((bcdLong >> 16) != 0) { digits += 4; bcdLong >>= 16; }
+        if ((bcdLong >> 8) != 0) { digits += 2; bcdLong >>= 8; }
+        if ((bcdLong >> 4) != 0) { digits += 1; }
+        precision = digits;
     }
 }
 
@@ -5,7 +5,10 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <cmath>
+
 #include "uassert.h"
+#include "unicode/ustring.h"
 #include "unicode/numberformatter.h"
 #include "number_decimalquantity.h"
 #include "number_formatimpl.h"
@@ -16,6 +19,7 @@
 #include "number_mapper.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "ustr_imp.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -648,6 +652,64 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
     }
 }
 
+int32_t LocalizedNumberFormatter::formatIntInto(int64_t value, char* dest, int32_t capacity,
+                                                UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (dest == nullptr ? capacity != 0 : capacity < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    bool compiled = computeCompiled(status);
+    if (U_FAILURE(status)) { return 0; }
+    if (compiled) {
+        int32_t length = fCompiled->formatIntUTF8(value, dest, capacity);
+        if (length >= 0) {
+            return u_terminateChars(dest, capacity, length, &status);
+        }
+    }
+    UFormattedNumberData results;
+    results.quantity.setToLong(value);
+    return formatIntoImpl(results, compiled, dest, capacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDoubleInto(double value, char* dest, int32_t capacity,
+                                                   UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (dest == nullptr ? capacity != 0 : capacity < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    bool compiled = computeCompiled(status);
+    if (U_FAILURE(status)) { return 0; }
+    // Integral doubles, except -0.0, format like the equivalent int64_t.
+    if (compiled && std::trunc(value) == value && std::fabs(value) < 9007199254740992.0 &&
+            !(value == 0 && std::signbit(value))) {
+        int32_t length = fCompiled->formatIntUTF8(static_cast<int64_t>(value), dest, capacity);
+        if (length >= 0) {
+            return u_terminateChars(dest, capacity, length, &status);
+        }
+    }
+    UFormattedNumberData results;
+    results.quantity.setToDouble(value);
+    return formatIntoImpl(results, compiled, dest, capacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatIntoImpl(UFormattedNumberData& results, bool compiled, char* dest,
+                                                 int32_t capacity, UErrorCode& status) const {
+    // Same as formatImpl() but with a stack-allocated results object and without the terminator.
+    if (compiled) {
+        fCompiled->format(&results, status);
+    } else {
+        NumberFormatterImpl::formatStatic(fMacros, &results, status);
+    }
+    if (U_FAILURE(status)) { return 0; }
+    UnicodeString string = results.getStringRef().toTempUnicodeString();
+    int32_t length = 0;
+    u_strToUTF8WithSub(dest, capacity, &length, string.getBuffer(), string.length(), 0xfffd, nullptr,
+                       &status);
+    return length;
+}
+
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
     if (computeCompiled(status)) {
         fCompiled->format(results, status);
@@ -5,10 +5,13 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <algorithm>
+
 #include "cstring.h"
 #include "unicode/ures.h"
 #include "uresimp.h"
 #include "charstr.h"
+#include "bytesinkutil.h"
 #include "number_formatimpl.h"
 #include "unicode/numfmt.h"
 #include "number_patternstring.h"
@@ -68,6 +71,42 @@ int32_t NumberFormatterImpl::format(UFormattedNumberData *results, UErrorCode &s
     return length;
 }
 
+int32_t NumberFormatterImpl::formatIntUTF8(int64_t value, char* dest, int32_t capacity) const {
+    if (fFastInteger.isNull()) {
+        return -1;
+    }
+    const FastIntegerUTF8& fast = *fFastInteger;
+    Signum signum = value < 0 ? SIGNUM_NEG : value == 0 ? SIGNUM_POS_ZERO : SIGNUM_POS;
+    // Negate as unsigned so that INT64_MIN works.
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    int8_t digits[19];
+    int32_t digitCount = 0;
+    do {
+        digits[digitCount++] = static_cast<int8_t>(magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    char buffer[FastIntegerUTF8::kMaxLength];
+    int32_t length = 0;
+    auto append = [&](const CharString& s) {
+        uprv_memcpy(buffer + length, s.data(), s.length());
+        length += s.length();
+    };
+    append(fast.prefixes[signum]);
+    uint32_t groupingMask = fast.groupingMasks[digitCount - 1];
+    for (int32_t i = digitCount - 1; i >= 0; i--) {
+        append(fast.digits[digits[i]]);
+        if ((groupingMask & (static_cast<uint32_t>(1) << i)) != 0) {
+            append(fast.groupingSeparator);
+        }
+    }
+    append(fast.suffixes[signum]);
+    if (length <= capacity) {
+        uprv_memcpy(dest, buffer, length);
+    }
+    return length;
+}
+
 void NumberFormatterImpl::preProcess(DecimalQuantity& inValue, MicroProps& microsOut,
                                      UErrorCode& status) const {
     if (U_FAILURE(status)) { return; }
@@ -473,6 +512,7 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
     if (safe) {
         fImmutablePatternModifier->addToChain(chain);
         chain = fImmutablePatternModifier.getAlias();
+        initFastInteger(macros, precision, status);
     } else {
         patternModifier->addToChain(chain);
         chain = patternModifier;
@@ -481,6 +521,81 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
     return chain;
 }
 
+void NumberFormatterImpl::initFastInteger(const MacroProps& macros, const Precision& precision,
+                                          UErrorCode& status) {
+    if (U_FAILURE(status)) { return; }
+    // Only plain numbers whose affixes do not depend on plural forms, and for which
+    // rounding and integer width leave integers unchanged.
+    if (macros.notation.fType != Notation::NTN_SIMPLE ||
+            !utils::unitIsBaseUnit(macros.unit) ||
+            macros.usage.isSet() ||
+            macros.scale.isValid() ||
+            fMicros.padding.isValid() ||
+            !(fMicros.integerWidth == IntegerWidth::standard()) ||
+            fMicros.simple.decimal != UNUM_DECIMAL_SEPARATOR_AUTO ||
+            fPatternModifier->needsPlurals()) {
+        return;
+    }
+    if (precision.fType != Precision::RND_NONE &&
+            !(precision.fType == Precision::RND_FRACTION && precision.fUnion.fracSig.fMinFrac == 0)) {
+        return;
+    }
+
+    LocalPointer<FastIntegerUTF8> fast(new FastIntegerUTF8(), status);
+    if (U_FAILURE(status)) { return; }
+    int32_t maxAffixLength = 0;
+    for (int32_t signum = 0; signum < SIGNUM_COUNT; signum++) {
+        FormattedStringBuilder affixes;
+        const Modifier* modifier =
+            fImmutablePatternModifier->getModifier(static_cast<Signum>(signum), StandardPlural::OTHER);
+        modifier->apply(affixes, 0, 0, status);
+        if (U_FAILURE(status)) { return; }
+        int32_t prefixLength = modifier->getPrefixLength();
+        UnicodeString affixString = affixes.toTempUnicodeString();
+        CharStringByteSink prefixSink(&fast->prefixes[signum]);
+        affixString.tempSubStringBetween(0, prefixLength).toUTF8(prefixSink);
+        CharStringByteSink suffixSink(&fast->suffixes[signum]);
+        affixString.tempSubString(prefixLength).toUTF8(suffixSink);
+        maxAffixLength = std::max(
+            maxAffixLength, fast->prefixes[signum].length() + fast->suffixes[signum].length());
+    }
+
+    const DecimalFormatSymbols& symbols = *fMicros.simple.symbols;
+    int32_t maxDigitLength = 0;
+    for (int32_t digit = 0; digit < 10; digit++) {
+        CharStringByteSink sink(&fast->digits[digit]);
+        if (symbols.getCodePointZero() != -1) {
+            UnicodeString(symbols.getCodePointZero() + digit).toUTF8(sink);
+        } else {
+            symbols.getConstDigitSymbol(digit).toUTF8(sink);
+        }
+        maxDigitLength = std::max(maxDigitLength, fast->digits[digit].length());
+    }
+    CharStringByteSink separatorSink(&fast->groupingSeparator);
+    symbols.getConstSymbol(DecimalFormatSymbols::kGroupingSeparatorSymbol).toUTF8(separatorSink);
+
+    // Grouping depends only on the number of integer digits.
+    DecimalQuantity probe;
+    int64_t power = 1;
+    for (int32_t digitCount = 1; digitCount <= 19; digitCount++, power *= 10) {
+        probe.setToLong(power);
+        uint32_t mask = 0;
+        for (int32_t i = 0; i < digitCount; i++) {
+            if (fMicros.simple.grouping.groupAtPosition(i, probe)) {
+                mask |= static_cast<uint32_t>(1) << i;
+            }
+        }
+        fast->groupingMasks[digitCount - 1] = mask;
+    }
+
+    if (U_FAILURE(status) ||
+            maxAffixLength + 19 * maxDigitLength + 18 * fast->groupingSeparator.length() >
+                FastIntegerUTF8::kMaxLength) {
+        return;
+    }
+    fFastInteger.adoptInstead(fast.orphan());
+}
+
 const PluralRules*
 NumberFormatterImpl::resolvePluralRules(
         const PluralRules* rulesPtr,
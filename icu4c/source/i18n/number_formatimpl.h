@@ -7,6 +7,7 @@
 #ifndef __NUMBER_FORMATIMPL_H__
 #define __NUMBER_FORMATIMPL_H__
 
+#include "charstr.h"
 #include "number_types.h"
 #include "formatted_string_builder.h"
 #include "number_patternstring.h"
@@ -60,6 +61,15 @@ class NumberFormatterImpl : public UMemory {
      */
     int32_t format(UFormattedNumberData *results, UErrorCode &status) const;
 
+    /**
+     * Formats an integer directly to UTF-8 if the settings allow it, without a DecimalQuantity
+     * or a FormattedStringBuilder; see FastIntegerUTF8.
+     *
+     * @return The UTF-8 length of the result, or -1 if the fast path does not apply.
+     *         The result is written to dest only if it fits into capacity; it is not NUL-terminated.
+     */
+    int32_t formatIntUTF8(int64_t value, char* dest, int32_t capacity) const;
+
     /**
      * Like format(), but saves the result into an output MicroProps without additional processing.
      */
@@ -97,6 +107,26 @@ class NumberFormatterImpl : public UMemory {
         UErrorCode& status);
 
   private:
+    /**
+     * Precomputed UTF-8 strings for formatting plain integers, for settings where the pipeline
+     * reduces to affixes that depend only on the sign, and grouped digits.
+     */
+    struct FastIntegerUTF8 : public UMemory {
+        // Longest possible output for an int64_t.
+        static constexpr int32_t kMaxLength = 120;
+
+        // Indexed by Signum.
+        CharString prefixes[SIGNUM_COUNT];
+        CharString suffixes[SIGNUM_COUNT];
+        CharString digits[10];
+        CharString groupingSeparator;
+        // Bit i of groupingMasks[n - 1] is set if an n-digit integer has a grouping separator
+        // after the digit with magnitude i.
+        uint32_t groupingMasks[19];
+    };
+
+    LocalPointer<const FastIntegerUTF8> fFastInteger;
+
     // Head of the MicroPropsGenerator linked list. Subclasses' processQuantity
     // methods process this list in a parent-first order, such that the last
     // item added, which this points to, typically has its logic executed last.
@@ -137,6 +167,11 @@ class NumberFormatterImpl : public UMemory {
     const PluralRules *
     resolvePluralRules(const PluralRules *rulesPtr, const Locale &locale, UErrorCode &status);
 
+    /**
+     * Sets up fFastInteger if the settings allow it. Called at the end of the safe constructor.
+     */
+    void initFastInteger(const MacroProps& macros, const Precision& precision, UErrorCode& status);
+
     /**
      * Synthesizes the MacroProps into a MicroPropsGenerator. All information, including the locale, is encoded into the
      * MicroPropsGenerator, except for the quantity itself, which is left abstract and must be provided to the returned
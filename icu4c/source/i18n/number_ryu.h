@@ -0,0 +1,43 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+#ifndef __NUMBER_RYU_H__
+#define __NUMBER_RYU_H__
+
+#include <cstdint>
+
+/**
+ * Whether DecimalQuantity converts doubles to their shortest round-trip decimal with the
+ * table-driven conversion below (1) or with double-conversion's DoubleToAscii (0).
+ * Both produce identical digits; this switch exists for platforms that prefer the smaller
+ * code size of the latter.
+ */
+#ifndef UNUM_SHORTEST_DOUBLE_USE_RYU
+#define UNUM_SHORTEST_DOUBLE_USE_RYU 1
+#endif
+
+U_NAMESPACE_BEGIN
+namespace number::impl {
+
+/**
+ * Computes the shortest decimal that reads back as the given finite, positive, nonzero double,
+ * choosing the one closest to the exact binary value, with ties to even. This is the same
+ * decimal as DoubleToStringConverter::DoubleToAscii in SHORTEST mode, computed with the Ryu
+ * algorithm (Ulf Adams, PLDI 2018) using fixed 128-bit tables of powers of 5 and no bignums.
+ *
+ * @param d The double; must be finite and greater than zero.
+ * @param significand Set to the decimal digits, at most 17 of them, with no trailing zeros.
+ * @param exponent Set such that the value is significand * 10^exponent.
+ * @internal
+ */
+void doubleToShortestDecimal(double d, uint64_t& significand, int32_t& exponent);
+
+} // namespace number::impl
+U_NAMESPACE_END
+
+#endif //__NUMBER_RYU_H__
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
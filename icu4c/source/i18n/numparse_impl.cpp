@@ -22,6 +22,7 @@
 #include "cstr.h"
 #include "number_mapper.h"
 #include "static_unicode_sets.h"
+#include "unicode/uchar.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -203,10 +204,120 @@ NumberParserImpl::createParserFromProperties(const number::impl::DecimalFormatPr
         parser->addMatcher(parser->fLocalValidators.multiplier = {multiplier});
     }
 
+    if (!parseCurrency) {
+        parser->initSimpleShape(properties, symbols, affixProvider.get(), grouper, isStrict);
+    }
+
     parser->freeze();
     return parser.orphan();
 }
 
+namespace {
+
+/** Returns the symbol as a single code unit, or 0 if it is longer or could be mistaken for a digit. */
+char16_t getSimpleSymbol(const DecimalFormatSymbols& symbols, DecimalFormatSymbols::ENumberFormatSymbol key) {
+    const UnicodeString& symbol = symbols.getConstSymbol(key);
+    if (symbol.length() != 1 || u_isdigit(symbol.charAt(0))) {
+        return 0;
+    }
+    return symbol.charAt(0);
+}
+
+/** Whether the four UTF-16 code units packed into word are all ASCII digits. */
+inline bool isFourDigits(uint64_t word) {
+    // With every unit below 0x80, adding 0x46 sets bit 7 iff the unit is above '9', and
+    // subtracting 0x30 sets some bit of 0xff80 iff the unit is below '0'. A borrow out of a
+    // unit below '0' can only disturb the units above it, and the word is rejected anyway.
+    constexpr uint64_t HIGH_BITS = 0xff80ff80ff80ff80ULL;
+    return (word & HIGH_BITS) == 0 &&
+        (((word + 0x0046004600460046ULL) | (word - 0x0030003000300030ULL)) & HIGH_BITS) == 0;
+}
+
+/** The value of four ASCII digits packed into word, the first digit in the lowest unit. */
+inline uint32_t fourDigitsValue(uint64_t word) {
+    word -= 0x0030003000300030ULL;
+    // Combine adjacent digits into two units of 0..99, then those into 0..9999.
+    word = (word * 10 + (word >> 16)) & 0x0000ffff0000ffffULL;
+    return static_cast<uint32_t>((word & 0xffff) * 100 + (word >> 32));
+}
+
+/**
+ * Consumes ASCII digits from p up to limit, accumulating them into value, and returns how many
+ * were consumed. Four digits at a time are validated and converted within one 64-bit word.
+ */
+int32_t consumeDigits(const char16_t*& p, const char16_t* limit, uint64_t& value) {
+    const char16_t* start = p;
+    while (limit - p >= 4) {
+        uint64_t word = static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 16) |
+            (static_cast<uint64_t>(p[2]) << 32) | (static_cast<uint64_t>(p[3]) << 48);
+        if (!isFourDigits(word)) {
+            break;
+        }
+        value = value * 10000 + fourDigitsValue(word);
+        p += 4;
+    }
+    for (; p < limit && *p >= u'0' && *p <= u'9'; p++) {
+        value = value * 10 + (*p - u'0');
+    }
+    return static_cast<int32_t>(p - start);
+}
+
+/** More digits than this may overflow the uint64_t accumulator. */
+constexpr int32_t MAX_SIMPLE_DIGITS = 19;
+
+/** Powers of ten up to 10^MAX_SIMPLE_DIGITS, all exact as doubles. */
+const double POWERS_OF_TEN[MAX_SIMPLE_DIGITS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+    1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19};
+
+} // namespace
+
+void NumberParserImpl::initSimpleShape(const DecimalFormatProperties& properties,
+                                       const DecimalFormatSymbols& symbols,
+                                       const AffixPatternProvider& affixProvider,
+                                       const Grouper& grouper, bool isStrict) {
+    // Only plain decimal patterns with a leading minus sign; anything that adds matchers or
+    // validators beyond signs, digits and separators is left to the matchers.
+    if (0 != (fParseFlags & PARSE_FLAG_INTEGER_ONLY) ||
+            affixProvider.hasCurrencySign() ||
+            !affixProvider.getString(AffixPatternProvider::AFFIX_POS_PREFIX).isEmpty() ||
+            !affixProvider.getString(AffixPatternProvider::AFFIX_POS_SUFFIX).isEmpty() ||
+            affixProvider.getString(AffixPatternProvider::AFFIX_NEG_PREFIX) != u"-" ||
+            !affixProvider.getString(AffixPatternProvider::AFFIX_NEG_SUFFIX).isEmpty() ||
+            properties.decimalPatternMatchRequired ||
+            !properties.padString.isBogus() ||
+            scaleFromProperties(properties).isValid()) {
+        return;
+    }
+    char16_t minusSign = getSimpleSymbol(symbols, DecimalFormatSymbols::kMinusSignSymbol);
+    // In strict mode, only the affixes can supply a sign.
+    char16_t plusSign = isStrict ? 0 : getSimpleSymbol(symbols, DecimalFormatSymbols::kPlusSignSymbol);
+    char16_t decimalSeparator = getSimpleSymbol(symbols, DecimalFormatSymbols::kDecimalSeparatorSymbol);
+    char16_t groupingSeparator = 0;
+    if (0 == (fParseFlags & PARSE_FLAG_GROUPING_DISABLED)) {
+        groupingSeparator = getSimpleSymbol(symbols, DecimalFormatSymbols::kGroupingSeparatorSymbol);
+        if (groupingSeparator == 0 || grouper.getPrimary() <= 0 || grouper.getSecondary() <= 0) {
+            return;
+        }
+    }
+    if (minusSign == 0 || decimalSeparator == 0 || (plusSign == 0 && !isStrict)) {
+        return;
+    }
+    // The symbols must be told apart; only plusSign and groupingSeparator can both be zero.
+    if (minusSign == plusSign || minusSign == groupingSeparator || minusSign == decimalSeparator ||
+            decimalSeparator == plusSign || decimalSeparator == groupingSeparator ||
+            (plusSign != 0 && plusSign == groupingSeparator)) {
+        return;
+    }
+    fSimpleShape.minusSign = minusSign;
+    fSimpleShape.plusSign = plusSign;
+    fSimpleShape.groupingSeparator = groupingSeparator;
+    fSimpleShape.decimalSeparator = decimalSeparator;
+    fSimpleShape.grouping1 = grouper.getPrimary();
+    fSimpleShape.grouping2 = grouper.getSecondary();
+    fSimpleShape.enabled = true;
+}
+
 NumberParserImpl::NumberParserImpl(parse_flags_t parseFlags)
         : fParseFlags(parseFlags) {
 }
@@ -260,6 +371,103 @@ void NumberParserImpl::parse(const UnicodeString& input, int32_t start, bool gre
     result.postProcess();
 }
 
+int32_t NumberParserImpl::parseDouble(const UnicodeString& input, double& result,
+                                      UErrorCode& status) const {
+    result = 0.0;
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    if (fSimpleShape.enabled && parseSimpleDouble(input.getBuffer(), input.length(), result)) {
+        return input.length();
+    }
+    ParsedNumber parsed;
+    parse(input, 0, true, parsed, status);
+    if (U_FAILURE(status) || !parsed.success()) {
+        return -1;
+    }
+    result = parsed.getDouble(status);
+    if (result == 0 && 0 != (fParseFlags & PARSE_FLAG_INTEGER_ONLY)) {
+        // populateFormattable() does not produce -0.0 when parsing integers only.
+        result = 0.0;
+    }
+    return parsed.charEnd;
+}
+
+bool NumberParserImpl::parseSimpleDouble(const char16_t* input, int32_t length, double& result) const {
+    // Accepts the whole input only if it has the shape
+    //     [sign] digits ([grouping] digits)* [decimal digits]
+    // with grouping sizes that the DecimalMatcher accepts even in strict mode, at most
+    // MAX_SIMPLE_DIGITS digits, and a value that converts to a correctly rounded double in one
+    // operation: an integer, or digits of at most 2^53 over a power of ten. The matchers parse
+    // such input to the same double; anything else returns false and is left to them.
+    const char16_t* p = input;
+    const char16_t* limit = input + length;
+    if (p == limit) {
+        return false;
+    }
+    bool negative = false;
+    if (*p == fSimpleShape.minusSign) {
+        negative = true;
+        p++;
+    } else if (*p == fSimpleShape.plusSign && fSimpleShape.plusSign != 0) {
+        p++;
+    }
+
+    uint64_t value = 0;
+    int32_t remaining = MAX_SIMPLE_DIGITS;
+    auto digitLimit = [&]() { return limit - p > remaining ? p + remaining : limit; };
+    int32_t groupLength = consumeDigits(p, digitLimit(), value);
+    if (groupLength == 0) {
+        return false;
+    }
+    remaining -= groupLength;
+    if (p < limit && *p == fSimpleShape.groupingSeparator && fSimpleShape.groupingSeparator != 0) {
+        // The first group has 1..grouping2 digits, the middle groups grouping2 digits,
+        // and the last group grouping1 digits.
+        if (groupLength > fSimpleShape.grouping2) {
+            return false;
+        }
+        for (;;) {
+            p++;
+            groupLength = consumeDigits(p, digitLimit(), value);
+            remaining -= groupLength;
+            if (p == limit || *p != fSimpleShape.groupingSeparator) {
+                if (groupLength != fSimpleShape.grouping1) {
+                    return false;
+                }
+                break;
+            }
+            if (groupLength != fSimpleShape.grouping2) {
+                return false;
+            }
+        }
+    }
+
+    int32_t fractionLength = 0;
+    if (p < limit && *p == fSimpleShape.decimalSeparator) {
+        p++;
+        fractionLength = consumeDigits(p, digitLimit(), value);
+        if (fractionLength == 0) {
+            return false;
+        }
+    }
+    if (p != limit) {
+        return false;
+    }
+
+    double d;
+    if (fractionLength == 0) {
+        d = static_cast<double>(value);
+    } else if (value <= (static_cast<uint64_t>(1) << 53)) {
+        // Both operands are exact, so the quotient is correctly rounded.
+        d = static_cast<double>(value) / POWERS_OF_TEN[fractionLength];
+    } else {
+        return false;
+    }
+    result = negative ? -d : d;
+    return true;
+}
+
 void NumberParserImpl::parseGreedy(StringSegment& segment, ParsedNumber& result,
                                             UErrorCode& status) const {
     // Note: this method is not recursive in order to avoid stack overflow.
@@ -55,6 +55,16 @@ class U_I18N_API_CLASS NumberParserImpl : public MutableMatcherCollection, publi
     void parse(const UnicodeString& input, int32_t start, bool greedy, ParsedNumber& result,
                UErrorCode& status) const;
 
+    /**
+     * Greedily parses the input from its start into a double, with the same result as parse()
+     * followed by ParsedNumber::populateFormattable(). Inputs of the shape "optional sign,
+     * grouped digits, optional decimal separator and digits" are parsed without running the
+     * matchers when the parser was created from properties that permit it.
+     *
+     * @return The index at which parsing ended, or -1 if the input could not be parsed.
+     */
+    int32_t parseDouble(const UnicodeString& input, double& result, UErrorCode& status) const;
+
     U_I18N_API UnicodeString toString() const;
 
   private:
@@ -64,6 +74,18 @@ class U_I18N_API_CLASS NumberParserImpl : public MutableMatcherCollection, publi
     MaybeStackArray<const NumberParseMatcher*, 10> fMatchers;
     bool fFrozen = false;
 
+    // Symbols for parseSimpleDouble(), set up by createParserFromProperties().
+    // A zero plusSign or groupingSeparator means that the plus sign or grouping is not accepted.
+    struct {
+        bool enabled = false;
+        char16_t minusSign = 0;
+        char16_t plusSign = 0;
+        char16_t groupingSeparator = 0;
+        char16_t decimalSeparator = 0;
+        int32_t grouping1 = 0;
+        int32_t grouping2 = 0;
+    } fSimpleShape;
+
     // WARNING: All of these matchers start in an undefined state (default-constructed).
     // You must use an assignment operator on them before using.
     struct {
@@ -92,6 +114,14 @@ class U_I18N_API_CLASS NumberParserImpl : public MutableMatcherCollection, publi
 
     explicit NumberParserImpl(parse_flags_t parseFlags);
 
+    void initSimpleShape(const number::impl::DecimalFormatProperties& properties,
+                         const DecimalFormatSymbols& symbols,
+                         const number::impl::AffixPatternProvider& affixProvider,
+                         const number::impl::Grouper& grouper,
+                         bool isStrict);
+
+    bool parseSimpleDouble(const char16_t* input, int32_t length, double& result) const;
+
     void parseGreedy(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const;
 
     void parseLongestRecursive(
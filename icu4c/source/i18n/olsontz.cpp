@@ -28,6 +28,10 @@
 #include "uresimp.h"
 #include "zonemeta.h"
 #include "umutex.h"
+#include "mutex.h"
+#include "sharedobject.h"
+#include "uhash.h"
+#include "ucln_in.h"
 
 #ifdef U_DEBUG_TZ
 # include <stdio.h>
@@ -81,6 +85,130 @@ U_NAMESPACE_BEGIN
 
 static const int32_t ZEROS[] = {0,0};
 
+/**
+ * Number of years after the current year (or after the start of the final
+ * rule, if that is later) for which the transitions of the final rule are
+ * expanded into a table.  Dates beyond the window use the final rule.
+ */
+#ifndef U_OLSONTZ_FINAL_TRANSITION_YEARS
+#define U_OLSONTZ_FINAL_TRANSITION_YEARS 50
+#endif
+
+/**
+ * The transitions of an OlsonTimeZone's final rule from the start of the
+ * rule to the end of the window, with the offsets in effect after each
+ * of them.  Immutable once created.
+ */
+class OlsonFinalTransitions : public SharedObject {
+public:
+    OlsonFinalTransitions() = default;
+    virtual ~OlsonFinalTransitions();
+
+    /** The final rule the table was created from (owned). */
+    SimpleTimeZone *rules = nullptr;
+    /** The table is valid for startMillis <= date < limitMillis. */
+    double startMillis = 0;
+    double limitMillis = 0;
+    /** Transition times in UTC milliseconds, count entries. */
+    LocalMemory<double> times;
+    /**
+     * Raw and DST offsets in milliseconds, (count + 1) pairs.  The first
+     * pair applies before times[0], the pair i+1 from times[i] on.
+     */
+    LocalMemory<int32_t> offsets;
+    int32_t count = 0;
+
+    /**
+     * Returns the number of transitions at or before date, that is the
+     * index of the offsets pair in effect at date.
+     */
+    int32_t indexOf(double date) const {
+        int32_t start = 0;
+        int32_t limit = count;
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+            if (times[mid] <= date) {
+                start = mid + 1;
+            } else {
+                limit = mid;
+            }
+        }
+        return start;
+    }
+};
+
+OlsonFinalTransitions::~OlsonFinalTransitions() {
+    delete rules;
+}
+
+// Final transition tables by canonical ID; owns one reference to each table.
+static UHashtable *gFinalTransitionsCache = nullptr;
+static UMutex gFinalTransitionsLock;
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV olsontz_cleanup() {
+    if (gFinalTransitionsCache != nullptr) {
+        uhash_close(gFinalTransitionsCache);
+        gFinalTransitionsCache = nullptr;
+    }
+    return true;
+}
+
+static void U_CALLCONV deleteFinalTransitions(void *obj) {
+    static_cast<const OlsonFinalTransitions *>(obj)->removeRef();
+}
+U_CDECL_END
+
+static OlsonFinalTransitions *
+createFinalTransitions(const SimpleTimeZone &finalZone, double finalStartMillis,
+                       int32_t finalStartYear, UErrorCode &status) {
+    LocalPointer<OlsonFinalTransitions> table(new OlsonFinalTransitions(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    table->rules = finalZone.clone();
+    if (table->rules == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    int32_t endYear = Grego::timeToYear(uprv_getUTCtime(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    endYear = (endYear > finalStartYear ? endYear : finalStartYear) + U_OLSONTZ_FINAL_TRANSITION_YEARS;
+    double endMillis = Grego::fieldsToDay(endYear + 1, 0, 1) * U_MILLIS_PER_DAY;
+
+    // A SimpleTimeZone has at most two transitions per year.
+    int32_t capacity = 2 * (endYear - finalStartYear + 2);
+    if (table->times.allocateInsteadAndReset(capacity) == nullptr ||
+            table->offsets.allocateInsteadAndReset(2 * (capacity + 1)) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    table->startMillis = finalStartMillis;
+    table->limitMillis = DBL_MAX;
+    finalZone.getOffset(finalStartMillis, false, table->offsets[0], table->offsets[1], status);
+
+    // Take the offsets from getOffset() rather than from the transition
+    // rules, so that the table gives exactly the same results as finalZone.
+    TimeZoneTransition tzt;
+    double t = finalStartMillis;
+    while (U_SUCCESS(status) && finalZone.getNextTransition(t, false, tzt)) {
+        t = tzt.getTime();
+        if (t >= endMillis || table->count == capacity) {
+            table->limitMillis = t;
+            break;
+        }
+        int32_t i = table->count++;
+        table->times[i] = t;
+        finalZone.getOffset(t, false, table->offsets[2 * i + 2], table->offsets[2 * i + 3], status);
+    }
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return table.orphan();
+}
+
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(OlsonTimeZone)
 
 /**
@@ -295,6 +423,15 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
     finalStartYear = other.finalStartYear;
     finalStartMillis = other.finalStartMillis;
 
+    const OlsonFinalTransitions *table = other.finalTransitions.load();
+    if (table != nullptr) {
+        table->addRef();
+    }
+    table = finalTransitions.exchange(table);
+    if (table != nullptr) {
+        table->removeRef();
+    }
+
     clearTransitionRules();
 
     return *this;
@@ -306,6 +443,10 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
     delete finalZone;
+    const OlsonFinalTransitions *table = finalTransitions.exchange(nullptr);
+    if (table != nullptr) {
+        table->removeRef();
+    }
 }
 
 /**
@@ -394,7 +535,9 @@ void OlsonTimeZone::getOffset(UDate date, UBool local, int32_t& rawoff,
         return;
     }
     if (finalZone != nullptr && date >= finalStartMillis) {
-        finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        if (!getFinalOffsetFromTable(date, local, rawoff, dstoff)) {
+            finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        }
     } else {
         getHistoricalOffset(date, local, kFormer, kLatter, rawoff, dstoff);
     }
@@ -407,7 +550,10 @@ void OlsonTimeZone::getOffsetFromLocal(UDate date, UTimeZoneLocalOption nonExist
         return;
     }
     if (finalZone != nullptr && date >= finalStartMillis) {
-        finalZone->getOffsetFromLocal(date, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff, ec);
+        // Away from transitions, the result does not depend on the options.
+        if (!getFinalOffsetFromTable(date, true, rawoff, dstoff)) {
+            finalZone->getOffsetFromLocal(date, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff, ec);
+        }
     } else {
         getHistoricalOffset(date, true, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff);
     }
@@ -470,6 +616,111 @@ OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
 // quick zone transition checking.
 #define MAX_OFFSET_SECONDS 86400
 
+int16_t
+OlsonTimeZone::findTransitionIndex(double sec) const {
+    int16_t start = 0;
+    int16_t limit = transitionCount();
+    while (start < limit) {
+        int16_t mid = static_cast<int16_t>((start + limit) / 2);
+        if (static_cast<double>(transitionTimeInSeconds(mid)) <= sec) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+    return start - 1;
+}
+
+const OlsonFinalTransitions *
+OlsonTimeZone::getFinalTransitions() const {
+    const OlsonFinalTransitions *table = finalTransitions.load();
+    if (table != nullptr) {
+        return table;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    {
+        Mutex lock(&gFinalTransitionsLock);
+        if (canonicalID != nullptr && gFinalTransitionsCache != nullptr) {
+            const OlsonFinalTransitions *cached = static_cast<const OlsonFinalTransitions *>(
+                uhash_get(gFinalTransitionsCache, canonicalID));
+            if (cached != nullptr && cached->startMillis == finalStartMillis &&
+                    cached->rules->hasSameRules(*finalZone)) {
+                table = cached;
+                table->addRef();
+            }
+        }
+        if (table == nullptr) {
+            OlsonFinalTransitions *created =
+                createFinalTransitions(*finalZone, finalStartMillis, finalStartYear, status);
+            if (created == nullptr) {
+                return nullptr;
+            }
+            created->addRef();
+            table = created;
+            if (canonicalID != nullptr) {
+                if (gFinalTransitionsCache == nullptr) {
+                    gFinalTransitionsCache = uhash_open(uhash_hashUChars, uhash_compareUChars, nullptr, &status);
+                    if (U_FAILURE(status)) {
+                        gFinalTransitionsCache = nullptr;
+                    } else {
+                        // Keys are from a resource bundle, values are reference counted.
+                        uhash_setValueDeleter(gFinalTransitionsCache, deleteFinalTransitions);
+                        ucln_i18n_registerCleanup(UCLN_I18N_OLSONTZ, olsontz_cleanup);
+                    }
+                }
+                if (gFinalTransitionsCache != nullptr &&
+                        uhash_get(gFinalTransitionsCache, canonicalID) == nullptr) {
+                    table->addRef();
+                    uhash_put(gFinalTransitionsCache, const_cast<char16_t *>(canonicalID),
+                              const_cast<OlsonFinalTransitions *>(table), &status);
+                }
+            }
+        }
+    }
+
+    // Another thread using this zone may have stored a table meanwhile.
+    const OlsonFinalTransitions *expected = nullptr;
+    if (!finalTransitions.compare_exchange_strong(expected, table)) {
+        table->removeRef();
+        return expected;
+    }
+    return table;
+}
+
+UBool
+OlsonTimeZone::getFinalOffsetFromTable(UDate date, UBool local,
+                                       int32_t& rawoff, int32_t& dstoff) const {
+    const OlsonFinalTransitions *table = getFinalTransitions();
+    if (table == nullptr) {
+        return false;
+    }
+    int32_t idx;
+    if (local) {
+        // The UTC time is within a day of the local time, and finalZone
+        // may look at the local time minus its DST savings.  Without a
+        // transition in that range, there is no non-existing or duplicated
+        // local time to resolve.
+        double start = date - 2.0 * MAX_OFFSET_SECONDS * U_MILLIS_PER_SECOND;
+        double limit = date + static_cast<double>(MAX_OFFSET_SECONDS) * U_MILLIS_PER_SECOND;
+        if (start < table->startMillis || limit >= table->limitMillis) {
+            return false;
+        }
+        idx = table->indexOf(start);
+        if (idx < table->count && table->times[idx] <= limit) {
+            return false;
+        }
+    } else {
+        if (date < table->startMillis || date >= table->limitMillis) {
+            return false;
+        }
+        idx = table->indexOf(date);
+    }
+    rawoff = table->offsets[2 * idx];
+    dstoff = table->offsets[2 * idx + 1];
+    return true;
+}
+
 void
 OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
                                    int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
@@ -488,10 +739,12 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
         } else {
-            // Linear search from the end is the fastest approach, since
-            // most lookups will happen at/near the end.
-            int16_t transIdx;
-            for (transIdx = transCount - 1; transIdx >= 0; transIdx--) {
+            // Start at the last transition that the time could have passed;
+            // for local time that is the last one within a day after it.
+            // Going backwards from there, only transitions within a day
+            // of a local time need adjusting.
+            int16_t transIdx = findTransitionIndex(local ? sec + MAX_OFFSET_SECONDS : sec);
+            for (; transIdx >= 0; transIdx--) {
                 int64_t transition = transitionTimeInSeconds(transIdx);
 
                 if (local && (sec >= (transition - MAX_OFFSET_SECONDS))) {
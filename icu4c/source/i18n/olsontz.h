@@ -17,6 +17,8 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <atomic>
+
 #include "unicode/basictz.h"
 #include "umutex.h"
 
@@ -24,6 +26,7 @@ struct UResourceBundle;
 
 U_NAMESPACE_BEGIN
 
+class OlsonFinalTransitions;
 class SimpleTimeZone;
 
 /**
@@ -301,6 +304,27 @@ class U_I18N_API_CLASS OlsonTimeZone : public BasicTimeZone {
 
     int16_t transitionCount() const;
 
+    /*
+     * Returns the index of the last transition at or before the given time
+     * in seconds, or -1 if there is none.  Binary search.
+     */
+    int16_t findTransitionIndex(double sec) const;
+
+    /*
+     * Returns the transitions of finalZone expanded into a table, or nullptr
+     * if the table cannot be created.  The table is shared by all zones with
+     * the same canonical ID and final rule, and by clones of this zone.
+     */
+    const OlsonFinalTransitions *getFinalTransitions() const;
+
+    /*
+     * Returns true and sets rawoff and dstoff if the final transition table
+     * covers the given date unambiguously; otherwise the caller falls back to
+     * finalZone.
+     */
+    UBool getFinalOffsetFromTable(UDate date, UBool local,
+        int32_t& rawoff, int32_t& dstoff) const;
+
     int64_t transitionTimeInSeconds(int16_t transIdx) const;
     double transitionTime(int16_t transIdx) const;
 
@@ -379,6 +403,12 @@ class U_I18N_API_CLASS OlsonTimeZone : public BasicTimeZone {
      */
     int32_t finalStartYear;
 
+    /**
+     * Lazily created table of the finalZone transitions, see
+     * getFinalTransitions().  Owns one reference.
+     */
+    mutable std::atomic<const OlsonFinalTransitions *> finalTransitions {};
+
     /*
      * Canonical (CLDR) ID of this zone
      */
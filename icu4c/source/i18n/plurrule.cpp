@@ -79,6 +79,7 @@ PluralRules::PluralRules(UErrorCode& /*status*/)
 :   UObject(),
     mRules(nullptr),
     mStandardPluralRanges(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
 }
@@ -87,6 +88,7 @@ PluralRules::PluralRules(const PluralRules& other)
 : UObject(other),
     mRules(nullptr),
     mStandardPluralRanges(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
     *this=other;
@@ -95,6 +97,7 @@ PluralRules::PluralRules(const PluralRules& other)
 PluralRules::~PluralRules() {
     delete mRules;
     delete mStandardPluralRanges;
+    SharedObject::clearPtr(mProgram);
 }
 
 SharedPluralRules::~SharedPluralRules() {
@@ -126,6 +129,7 @@ PluralRules::operator=(const PluralRules& other) {
         mRules = nullptr;
         delete mStandardPluralRanges;
         mStandardPluralRanges = nullptr;
+        SharedObject::clearPtr(mProgram);
         mInternalStatus = other.mInternalStatus;
         if (U_FAILURE(mInternalStatus)) {
             // bail out early if the object we were copying from was already 'invalid'.
@@ -141,6 +145,8 @@ PluralRules::operator=(const PluralRules& other) {
                 mInternalStatus = mRules->fInternalStatus;
             }
         }
+        // The program is immutable, so the copy shares it.
+        SharedObject::copyPtr(other.mProgram, mProgram);
         if (other.mStandardPluralRanges != nullptr) {
             mStandardPluralRanges = other.mStandardPluralRanges->copy(mInternalStatus)
                 .toPointer(mInternalStatus)
@@ -285,11 +291,17 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
 
 UnicodeString
 PluralRules::select(int32_t number) const {
+    if (mRules != nullptr && mProgram != nullptr) {
+        return mProgram->select(static_cast<int64_t>(number));
+    }
     return select(FixedDecimal(number));
 }
 
 UnicodeString
 PluralRules::select(double number) const {
+    if (mRules != nullptr && mProgram != nullptr) {
+        return mProgram->select(number);
+    }
     return select(FixedDecimal(number));
 }
 
@@ -312,6 +324,9 @@ PluralRules::select(const IFixedDecimal &number) const {
     if (mRules == nullptr) {
         return UnicodeString(true, PLURAL_DEFAULT_RULE, -1);
     }
+    else if (mProgram != nullptr) {
+        return mProgram->select(number);
+    }
     else {
         return mRules->select(number);
     }
@@ -818,6 +833,10 @@ PluralRuleParser::parse(const UnicodeString& ruleData, PluralRules *prules, UErr
             break;
         }
     }
+    if (U_SUCCESS(status)) {
+        SharedObject::clearPtr(prules->mProgram);
+        prules->mProgram = PluralRulesProgram::create(prules->mRules, status);
+    }
 }
 
 UnicodeString
@@ -1268,6 +1287,307 @@ RuleChain::isKeyword(const UnicodeString& keywordParam) const {
 }
 
 
+namespace {
+
+// Doubles up to this magnitude convert exactly to and from int64_t.
+constexpr double MAX_EXACT_INTEGER = 9007199254740992.0;  // 2^53
+
+inline bool isIntegral(double n) { return n == uprv_floor(n); }
+inline bool isIntegral(int64_t /*n*/) { return true; }
+
+inline double mod(double n, int32_t m) {
+    // Same result as fmod(n, m), which is slow, for the common case of an integer n.
+    if (m != 0 && isIntegral(n) && uprv_fabs(n) <= MAX_EXACT_INTEGER) {
+        return static_cast<double>(static_cast<int64_t>(n) % m);
+    }
+    return fmod(n, m);
+}
+inline int64_t mod(int64_t n, int32_t m) { return n % m; }
+
+// The operands of an integer number: n and i are its absolute value, all others are 0.
+class IntegerOperands {
+public:
+    explicit IntegerOperands(int64_t absolute) : fAbsolute(absolute) {}
+    int64_t get(int32_t operand) const {
+        return operand == PLURAL_OPERAND_N || operand == PLURAL_OPERAND_I ? fAbsolute : 0;
+    }
+private:
+    int64_t fAbsolute;
+};
+
+// The operands of an IFixedDecimal, each computed when it is first needed.
+class LazyOperands {
+public:
+    explicit LazyOperands(const IFixedDecimal &number) : fNumber(number) {}
+    double get(int32_t operand) {
+        if ((fFetched & (1 << operand)) == 0) {
+            fValues[operand] = fNumber.getPluralOperand(static_cast<PluralOperand>(operand));
+            fFetched |= 1 << operand;
+        }
+        return fValues[operand];
+    }
+private:
+    const IFixedDecimal &fNumber;
+    uint32_t fFetched = 0;
+    double fValues[PLURAL_OPERAND_J + 1];
+};
+
+// The operands of FixedDecimal(n), each computed when it is first needed.
+// The visible fraction digits in particular are expensive and often not needed.
+class DoubleOperands {
+public:
+    explicit DoubleOperands(double n) : fSource(uprv_fabs(n)) {
+        // Same as FixedDecimal::init(), which zeroes the integer and fraction digits
+        // of numbers beyond the int64_t range.
+        fInRange = fSource <= static_cast<double>(U_INT64_MAX);
+    }
+    double get(int32_t operand) {
+        switch (operand) {
+            case PLURAL_OPERAND_N: return fSource;
+            case PLURAL_OPERAND_I: return fInRange ? static_cast<double>(static_cast<int64_t>(fSource)) : 0;
+            case PLURAL_OPERAND_V: return getVisibleFractionDigitCount();
+            case PLURAL_OPERAND_F: return static_cast<double>(getFractionDigits());
+            case PLURAL_OPERAND_T: {
+                int64_t t = getFractionDigits();
+                while (t != 0 && t % 10 == 0) {
+                    t /= 10;
+                }
+                return static_cast<double>(t);
+            }
+            default: return 0;  // e and c
+        }
+    }
+private:
+    int32_t getVisibleFractionDigitCount() {
+        if (fVisibleFractionDigitCount < 0) {
+            fVisibleFractionDigitCount = fInRange ? FixedDecimal::decimals(fSource) : 0;
+        }
+        return fVisibleFractionDigitCount;
+    }
+    int64_t getFractionDigits() {
+        if (fFractionDigits < 0) {
+            fFractionDigits = fInRange ?
+                FixedDecimal::getFractionalDigits(fSource, getVisibleFractionDigitCount()) : 0;
+        }
+        return fFractionDigits;
+    }
+
+    double fSource;
+    bool fInRange;
+    int32_t fVisibleFractionDigitCount = -1;
+    int64_t fFractionDigits = -1;
+};
+
+}  // namespace
+
+const PluralRulesProgram *
+PluralRulesProgram::create(const RuleChain *rules, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    int32_t rulesCount = 0;
+    int32_t conditionsCount = 0;
+    int32_t rangesCount = 0;
+    for (const RuleChain *rc = rules; rc != nullptr; rc = rc->fNext) {
+        rulesCount++;
+        for (const OrConstraint *orRule = rc->ruleHeader; orRule != nullptr; orRule = orRule->next) {
+            if (orRule->childNode == nullptr) {
+                conditionsCount++;
+            }
+            for (const AndConstraint *andRule = orRule->childNode; andRule != nullptr; andRule = andRule->next) {
+                conditionsCount++;
+                if (andRule->rangeList != nullptr) {
+                    rangesCount += andRule->rangeList->size();
+                }
+            }
+        }
+    }
+
+    LocalPointer<PluralRulesProgram> program(new PluralRulesProgram(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    if ((conditionsCount > program->fConditions.getCapacity() &&
+            program->fConditions.resize(conditionsCount) == nullptr) ||
+            (rangesCount > program->fRanges.getCapacity() &&
+            program->fRanges.resize(rangesCount) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    program->fKeywords.adoptInsteadAndCheckErrorCode(new UnicodeString[rulesCount + 1], status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    program->fOtherIndex = rulesCount;
+    program->fKeywords[rulesCount].setTo(true, PLURAL_KEYWORD_OTHER, 5);
+
+    int32_t keywordIndex = 0;
+    int32_t &c = program->fConditionsCount;
+    int32_t &r = program->fRangesCount;
+    for (const RuleChain *rc = rules; rc != nullptr; rc = rc->fNext, keywordIndex++) {
+        program->fKeywords[keywordIndex] = rc->fKeyword;
+        for (const OrConstraint *orRule = rc->ruleHeader; orRule != nullptr; orRule = orRule->next) {
+            int32_t branchStart = c;
+            if (orRule->childNode == nullptr) {
+                // An "or" branch with no constraints is always fulfilled.
+                program->fConditions[c++] = {-1, false, false, false, 0, -1, -1, -1, -1, 0};
+            }
+            for (const AndConstraint *andRule = orRule->childNode; andRule != nullptr; andRule = andRule->next) {
+                Condition &condition = program->fConditions[c++];
+                condition = {-1, false, false, false, 0, -1, -1, -1, -1, 0};
+                if (andRule->digitsType == none) {
+                    // An empty AndConstraint, created by a rule with a keyword but no following expression.
+                    continue;
+                }
+                PluralOperand operand = tokenTypeToPluralOperand(andRule->digitsType);
+                condition.operand = operand;
+                program->fOperandsMask |= 1 << operand;
+                condition.negated = andRule->negated;
+                condition.integerOnly = andRule->integerOnly;
+                if (andRule->op == AndConstraint::MOD) {
+                    condition.hasMod = true;
+                    condition.mod = andRule->opNum;
+                    if (andRule->opNum == 0) {
+                        // fmod(n, 0) is NaN, but n % 0 is undefined.
+                        program->fIntegerSafe = false;
+                    }
+                }
+                condition.value = andRule->value;
+                if (andRule->rangeList != nullptr) {
+                    condition.rangeStart = r;
+                    for (int32_t i = 0; i < andRule->rangeList->size(); i++) {
+                        program->fRanges[r++] = andRule->rangeList->elementAti(i);
+                    }
+                    condition.rangeLimit = r;
+                }
+            }
+            program->fConditions[c - 1].keywordIfTrue = keywordIndex;
+            for (int32_t i = branchStart; i < c; i++) {
+                program->fConditions[i].nextIfFalse = c;
+            }
+        }
+    }
+
+    if (program->fIntegerSafe && program->fOtherIndex <= UINT8_MAX) {
+        for (int32_t i = 0; i < INTEGER_TABLE_SIZE; i++) {
+            IntegerOperands operands(i);
+            program->fIntegerTable[i] = static_cast<uint8_t>(program->evaluate(operands));
+        }
+        program->fHasIntegerTable = true;
+    }
+    program->addRef();
+    return program.orphan();
+}
+
+PluralRulesProgram::~PluralRulesProgram() {}
+
+template<typename Operands>
+int32_t
+PluralRulesProgram::evaluate(Operands &operands) const {
+    // Same logic as AndConstraint::isFulfilled() and OrConstraint::isFulfilled().
+    for (int32_t i = 0; i < fConditionsCount;) {
+        const Condition &condition = fConditions[i];
+        bool result = true;
+        if (condition.operand >= 0) {
+            auto n = operands.get(condition.operand);
+            if (condition.integerOnly && !isIntegral(n)) {
+                result = false;
+            } else {
+                if (condition.hasMod) {
+                    n = mod(n, condition.mod);
+                }
+                if (condition.rangeStart < 0) {
+                    result = condition.value == -1 || n == condition.value;
+                } else {
+                    result = false;
+                    for (int32_t r = condition.rangeStart; r < condition.rangeLimit; r += 2) {
+                        if (fRanges[r] <= n && n <= fRanges[r + 1]) {
+                            result = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (condition.negated) {
+                result = !result;
+            }
+        }
+        if (!result) {
+            i = condition.nextIfFalse;
+        } else if (condition.keywordIfTrue >= 0) {
+            return condition.keywordIfTrue;
+        } else {
+            i++;
+        }
+    }
+    return fOtherIndex;
+}
+
+int32_t
+PluralRulesProgram::selectIndex(const IFixedDecimal &number) const {
+    if (number.isNaN() || number.isInfinite()) {
+        return fOtherIndex;
+    }
+    LazyOperands operands(number);
+    if (fHasIntegerTable) {
+        // The table applies if the number is an integer as far as the rules can tell:
+        // the fraction and exponent operands are 0 and n equals i.
+        static constexpr PluralOperand zeroOperands[] = {
+            PLURAL_OPERAND_V, PLURAL_OPERAND_E, PLURAL_OPERAND_F, PLURAL_OPERAND_T
+        };
+        bool isInteger = true;
+        for (PluralOperand operand : zeroOperands) {
+            if ((fOperandsMask & (1 << operand)) != 0 && operands.get(operand) != 0) {
+                isInteger = false;
+                break;
+            }
+        }
+        if (isInteger) {
+            bool hasN = (fOperandsMask & (1 << PLURAL_OPERAND_N)) != 0;
+            bool hasI = (fOperandsMask & (1 << PLURAL_OPERAND_I)) != 0;
+            double key = hasN ? operands.get(PLURAL_OPERAND_N) : hasI ? operands.get(PLURAL_OPERAND_I) : 0;
+            if ((!hasN || !hasI || operands.get(PLURAL_OPERAND_I) == key) &&
+                    0 <= key && key < INTEGER_TABLE_SIZE && isIntegral(key)) {
+                return fIntegerTable[static_cast<int32_t>(key)];
+            }
+        }
+    }
+    return evaluate(operands);
+}
+
+UnicodeString
+PluralRulesProgram::select(const IFixedDecimal &number) const {
+    return fKeywords[selectIndex(number)];
+}
+
+UnicodeString
+PluralRulesProgram::select(double number) const {
+    if (uprv_isNaN(number) || uprv_isInfinite(number)) {
+        return fKeywords[fOtherIndex];
+    }
+    if (uprv_fabs(number) <= MAX_EXACT_INTEGER && isIntegral(number)) {
+        return select(static_cast<int64_t>(number));
+    }
+    DoubleOperands operands(number);
+    return fKeywords[evaluate(operands)];
+}
+
+UnicodeString
+PluralRulesProgram::select(int64_t number) const {
+    // Same as selecting FixedDecimal(number).
+    constexpr int64_t maxExact = static_cast<int64_t>(MAX_EXACT_INTEGER);
+    if (!fIntegerSafe || number > maxExact || number < -maxExact) {
+        return select(FixedDecimal(static_cast<double>(number)));
+    }
+    int64_t absolute = number < 0 ? -number : number;
+    if (fHasIntegerTable && absolute < INTEGER_TABLE_SIZE) {
+        return fKeywords[fIntegerTable[absolute]];
+    }
+    IntegerOperands operands(absolute);
+    return fKeywords[evaluate(operands)];
+}
+
+
 PluralRuleParser::PluralRuleParser() :
         ruleIndex(0), token(), type(none), prevType(none),
         curAndConstraint(nullptr), currentChain(nullptr), rangeLowIdx(-1), rangeHiIdx(-1)
@@ -29,6 +29,8 @@
 #include "uvector.h"
 #include "hash.h"
 #include "uassert.h"
+#include "cmemory.h"
+#include "sharedobject.h"
 
 /**
  * A FixedDecimal version of UPLRULES_NO_UNIQUE_VALUE used in PluralRulesTest
@@ -406,6 +408,71 @@ class RuleChain : public UMemory  {
     UBool         isKeyword(const UnicodeString& keyword) const;
 };
 
+/**
+ * The rules of a RuleChain compiled into a flat list of conditions, for fast selection.
+ *
+ * Each condition tests one operand. When it is true, it either ends its "or" branch,
+ * selecting that branch's keyword, or falls through to the next condition of the same
+ * "and" chain. When it is false, evaluation jumps to the first condition of the next
+ * "or" branch. Falling off the end selects "other".
+ *
+ * Integers below INTEGER_TABLE_SIZE are looked up in a table built at compile time.
+ * Other integers are evaluated with integer arithmetic, and other numbers with their
+ * operands computed only as the conditions need them, which for doubles often avoids
+ * counting their visible fraction digits.
+ *
+ * A program is immutable once built and is shared by a PluralRules and its clones,
+ * which includes all of the PluralRules handed out from the cache for one locale.
+ */
+class PluralRulesProgram : public SharedObject {
+public:
+    /** Compiles the rule chain; the result has a reference count of 1. */
+    static const PluralRulesProgram *create(const RuleChain *rules, UErrorCode &status);
+    virtual ~PluralRulesProgram();
+
+    /** Returns the keyword for the number, like RuleChain::select(). */
+    UnicodeString select(const IFixedDecimal &number) const;
+    /** Returns the keyword for the double, like RuleChain::select(FixedDecimal(number)). */
+    UnicodeString select(double number) const;
+    /** Returns the keyword for the integer, like RuleChain::select(FixedDecimal(number)). */
+    UnicodeString select(int64_t number) const;
+
+    /** Integers in [0, INTEGER_TABLE_SIZE) are selected through a lookup table. */
+    static constexpr int32_t INTEGER_TABLE_SIZE = 1000;
+
+private:
+    struct Condition {
+        int32_t operand;       // PluralOperand, or -1 if the condition is always true.
+        UBool negated;
+        UBool integerOnly;     // 'within' rules.
+        UBool hasMod;
+        int32_t mod;           // The right operand of the mod.
+        int32_t value;         // For 'is' rules, or -1 for an empty rule.
+        int32_t rangeStart;    // Range pairs [rangeStart, rangeLimit) in fRanges for 'in' and
+        int32_t rangeLimit;    //   'within' rules; rangeStart is -1 for 'is' and empty rules.
+        int32_t keywordIfTrue; // Ends an "or" branch if >= 0; otherwise continue with the next condition.
+        int32_t nextIfFalse;   // Index of the first condition of the next "or" branch.
+    };
+
+    PluralRulesProgram() = default;
+
+    int32_t selectIndex(const IFixedDecimal &number) const;
+    template<typename Operands>
+    int32_t evaluate(Operands &operands) const;
+
+    MaybeStackArray<Condition, 16> fConditions;
+    int32_t fConditionsCount = 0;
+    MaybeStackArray<int32_t, 16> fRanges;
+    int32_t fRangesCount = 0;
+    LocalArray<UnicodeString> fKeywords;   // One per rule, then "other".
+    int32_t fOtherIndex = 0;
+    uint32_t fOperandsMask = 0;            // Bit (1 << operand) for each operand that is tested.
+    // False when the integer arithmetic could differ from the double arithmetic, e.g. for "mod 0".
+    UBool fIntegerSafe = true;
+    UBool fHasIntegerTable = false;
+    uint8_t fIntegerTable[INTEGER_TABLE_SIZE];
+};
+
 class PluralKeywordEnumeration : public StringEnumeration {
 public:
     PluralKeywordEnumeration(RuleChain *header, UErrorCode& status);
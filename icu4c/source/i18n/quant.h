@@ -112,6 +112,9 @@ class Quantifier : public UnicodeFunctor, public UnicodeMatcher {
 
  private:
 
+    friend class TransliterationRuleBinary; // reads and writes the private data
+    friend class TransliterationRule; // for mayMatchEmpty()
+
     UnicodeFunctor* matcher; // owned
 
     uint32_t minCount;
@@ -0,0 +1,671 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+* rbt_bin.cpp
+*
+* Precompiled (binary) form of transliteration rules.
+**********************************************************************
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/translit.h"
+#include "unicode/uniset.h"
+#include "unicode/usetiter.h"
+#include "cmemory.h"
+#include "funcrepl.h"
+#include "quant.h"
+#include "rbt_bin.h"
+#include "rbt_data.h"
+#include "rbt_pars.h"
+#include "rbt_rule.h"
+#include "strmatch.h"
+#include "strrepl.h"
+#include "tridpars.h"
+#include "uvector.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr char16_t kSignature = 0x5472;  // "Tr"
+constexpr char16_t kFormatVersion = 1;
+
+enum FunctorType {
+    FUNCTOR_NULL,
+    FUNCTOR_SET,
+    FUNCTOR_STRING_MATCHER,
+    FUNCTOR_STRING_REPLACER,
+    FUNCTOR_QUANTIFIER,
+    FUNCTOR_FUNCTION_REPLACER
+};
+
+void appendInt(UnicodeString& out, int32_t value) {
+    out.append(static_cast<char16_t>(static_cast<uint32_t>(value) >> 16));
+    out.append(static_cast<char16_t>(value));
+}
+
+/**
+ * Appends a string with its length: one unit for lengths below 0x8000,
+ * otherwise two units with the high bit set in the first.
+ */
+void appendString(UnicodeString& out, const UnicodeString& s) {
+    int32_t length = s.length();
+    if (length < 0x8000) {
+        out.append(static_cast<char16_t>(length));
+    } else {
+        appendInt(out, length | 0x80000000);
+    }
+    out.append(s);
+}
+
+/**
+ * Appends the UnicodeSet::serialize() form of the set's code points,
+ * followed by its strings.
+ */
+void appendSet(UnicodeString& out, const UnicodeSet& set, UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    UErrorCode preflightCode = U_ZERO_ERROR;
+    int32_t length = set.serialize(nullptr, 0, preflightCode);
+    if (preflightCode != U_BUFFER_OVERFLOW_ERROR) {
+        // Too many ranges for the serialized form.
+        errorCode = U_FAILURE(preflightCode) ? U_UNSUPPORTED_ERROR : U_INTERNAL_PROGRAM_ERROR;
+        return;
+    }
+    MaybeStackArray<uint16_t, 64> units;
+    if (units.resize(length) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    set.serialize(units.getAlias(), length, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    appendInt(out, length);
+    out.append(reinterpret_cast<const char16_t*>(units.getAlias()), length);
+
+    UnicodeString strings;
+    int32_t stringCount = 0;
+    if (set.hasStrings()) {
+        UnicodeSetIterator iter(set);
+        while (iter.nextRange()) {
+            if (iter.isString()) {
+                appendString(strings, iter.getString());
+                ++stringCount;
+            }
+        }
+    }
+    appendInt(out, stringCount);
+    out.append(strings);
+}
+
+}  // namespace
+
+/**
+ * Bounds-checked sequential access to the 16-bit units of the binary form.
+ * Any attempt to read past the end sets U_INVALID_FORMAT_ERROR.
+ */
+class TransliterationRuleBinary::Reader : public UMemory {
+public:
+    Reader(const char16_t* units, int32_t length) : p(units), limit(units + length) {}
+
+    UBool atEnd() const { return p == limit; }
+
+    char16_t readUnit(UErrorCode& errorCode) {
+        const char16_t* s = readUnits(1, errorCode);
+        return s != nullptr ? *s : 0;
+    }
+
+    int32_t readInt(UErrorCode& errorCode) {
+        const char16_t* s = readUnits(2, errorCode);
+        return s != nullptr ? static_cast<int32_t>((static_cast<uint32_t>(s[0]) << 16) | s[1]) : 0;
+    }
+
+    /** Reads a non-negative count of items which each take at least minUnits. */
+    int32_t readCount(int32_t minUnits, UErrorCode& errorCode) {
+        int32_t count = readInt(errorCode);
+        if (U_SUCCESS(errorCode) && (count < 0 || count > (limit - p) / minUnits)) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return 0;
+        }
+        return count;
+    }
+
+    const char16_t* readUnits(int32_t length, UErrorCode& errorCode) {
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        if (length < 0 || length > limit - p) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return nullptr;
+        }
+        const char16_t* s = p;
+        p += length;
+        return s;
+    }
+
+    /** Returns a read-only alias of the string's units in the binary data. */
+    UnicodeString readString(UErrorCode& errorCode) {
+        int32_t length = readUnit(errorCode);
+        if (length >= 0x8000) {
+            length = ((length & 0x7fff) << 16) | readUnit(errorCode);
+        }
+        const char16_t* s = readUnits(length, errorCode);
+        return U_SUCCESS(errorCode) ? UnicodeString(false, s, length) : UnicodeString();
+    }
+
+    UnicodeSet* readSet(UErrorCode& errorCode) {
+        int32_t length = readCount(1, errorCode);
+        const char16_t* s = readUnits(length, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        // The UnicodeSet deserializing constructor trusts its input;
+        // check that the header agrees with the stored length.
+        int32_t headerSize = (length > 0 && (s[0] & 0x8000) != 0) ? 2 : 1;
+        if (length < headerSize || headerSize + (s[0] & 0x7fff) != length ||
+                (headerSize == 2 && s[1] > (s[0] & 0x7fff))) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return nullptr;
+        }
+        LocalPointer<UnicodeSet> set(
+            new UnicodeSet(reinterpret_cast<const uint16_t*>(s), length,
+                           UnicodeSet::kSerialized, errorCode),
+            errorCode);
+        int32_t stringCount = readCount(1, errorCode);
+        for (int32_t i = 0; i < stringCount && U_SUCCESS(errorCode); ++i) {
+            set->add(readString(errorCode));
+        }
+        if (U_SUCCESS(errorCode) && set->isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return U_SUCCESS(errorCode) ? set.orphan() : nullptr;
+    }
+
+private:
+    const char16_t* p;
+    const char16_t* limit;
+};
+
+//----------------------------------------------------------------------
+// Writing
+//----------------------------------------------------------------------
+
+int32_t TransliterationRuleBinary::compileRules(const UnicodeString& rules,
+                                                UTransDirection direction,
+                                                uint8_t* dest, int32_t capacity,
+                                                UParseError& parseError,
+                                                UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    TransliteratorParser parser(errorCode);
+    parser.parse(rules, direction, parseError, errorCode);
+    return write(parser, direction, dest, capacity, errorCode);
+}
+
+int32_t TransliterationRuleBinary::write(const TransliteratorParser& parser,
+                                         UTransDirection direction,
+                                         uint8_t* dest, int32_t capacity,
+                                         UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString out;
+    out.append(kSignature).append(kFormatVersion);
+    out.append(static_cast<char16_t>(direction)).append(static_cast<char16_t>(0));
+
+    appendInt(out, parser.idBlockVector.size());
+    for (int32_t i = 0; i < parser.idBlockVector.size(); ++i) {
+        appendString(out, *static_cast<const UnicodeString*>(parser.idBlockVector.elementAt(i)));
+    }
+
+    if (parser.compoundFilter != nullptr) {
+        out.append(static_cast<char16_t>(FUNCTOR_SET));
+        appendSet(out, *parser.compoundFilter, errorCode);
+    } else {
+        out.append(static_cast<char16_t>(FUNCTOR_NULL));
+    }
+
+    // The parser gives every data object the same variables array;
+    // data[0] owns the variables.
+    const UVector& dataVector = parser.dataVector;
+    int32_t dataCount = dataVector.size();
+    appendInt(out, dataCount);
+    const TransliterationRuleData* first =
+        dataCount > 0 ? static_cast<const TransliterationRuleData*>(dataVector.elementAt(0)) : nullptr;
+    int32_t variablesLength = first != nullptr ? first->variablesLength : 0;
+    for (int32_t i = 1; i < dataCount; ++i) {
+        const TransliterationRuleData* data =
+            static_cast<const TransliterationRuleData*>(dataVector.elementAt(i));
+        if (data->variablesLength != variablesLength ||
+                (variablesLength > 0 &&
+                 uprv_memcmp(data->variables, first->variables,
+                             variablesLength * sizeof(UnicodeFunctor*)) != 0)) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return 0;
+        }
+    }
+    appendInt(out, variablesLength);
+    for (int32_t i = 0; i < variablesLength; ++i) {
+        writeFunctor(first->variables[i], dataVector, out, errorCode);
+    }
+
+    for (int32_t i = 0; i < dataCount; ++i) {
+        writeData(*static_cast<const TransliterationRuleData*>(dataVector.elementAt(i)), out, errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (out.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+
+    int32_t length = out.length() * U_SIZEOF_UCHAR;
+    if (length > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    } else {
+        uprv_memcpy(dest, out.getBuffer(), length);
+    }
+    return length;
+}
+
+void TransliterationRuleBinary::writeFunctor(const UnicodeFunctor* f, const UVector& dataVector,
+                                             UnicodeString& out, UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (f == nullptr) {
+        out.append(static_cast<char16_t>(FUNCTOR_NULL));
+        return;
+    }
+    UClassID type = f->getDynamicClassID();
+    if (type == UnicodeSet::getStaticClassID()) {
+        out.append(static_cast<char16_t>(FUNCTOR_SET));
+        appendSet(out, *static_cast<const UnicodeSet*>(f), errorCode);
+    } else if (type == StringMatcher::getStaticClassID()) {
+        const StringMatcher* m = static_cast<const StringMatcher*>(f);
+        int32_t dataIndex = dataVector.indexOf(const_cast<TransliterationRuleData*>(m->data));
+        if (dataIndex < 0) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        out.append(static_cast<char16_t>(FUNCTOR_STRING_MATCHER));
+        appendString(out, m->pattern);
+        appendInt(out, m->segmentNumber);
+        appendInt(out, dataIndex);
+    } else if (type == StringReplacer::getStaticClassID()) {
+        const StringReplacer* r = static_cast<const StringReplacer*>(f);
+        int32_t dataIndex = dataVector.indexOf(const_cast<TransliterationRuleData*>(r->data));
+        if (dataIndex < 0) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        out.append(static_cast<char16_t>(FUNCTOR_STRING_REPLACER));
+        appendString(out, r->output);
+        out.append(static_cast<char16_t>(r->hasCursor));
+        appendInt(out, r->cursorPos);
+        appendInt(out, dataIndex);
+    } else if (type == Quantifier::getStaticClassID()) {
+        const Quantifier* q = static_cast<const Quantifier*>(f);
+        out.append(static_cast<char16_t>(FUNCTOR_QUANTIFIER));
+        appendInt(out, static_cast<int32_t>(q->minCount));
+        appendInt(out, static_cast<int32_t>(q->maxCount));
+        writeFunctor(q->matcher, dataVector, out, errorCode);
+    } else if (type == FunctionReplacer::getStaticClassID()) {
+        const FunctionReplacer* r = static_cast<const FunctionReplacer*>(f);
+        const UnicodeFilter* filter = r->translit->getFilter();
+        if (filter != nullptr && filter->getDynamicClassID() != UnicodeSet::getStaticClassID()) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        out.append(static_cast<char16_t>(FUNCTOR_FUNCTION_REPLACER));
+        appendString(out, r->translit->getID());
+        if (filter != nullptr) {
+            out.append(static_cast<char16_t>(FUNCTOR_SET));
+            appendSet(out, *static_cast<const UnicodeSet*>(filter), errorCode);
+        } else {
+            out.append(static_cast<char16_t>(FUNCTOR_NULL));
+        }
+        writeFunctor(r->replacer, dataVector, out, errorCode);
+    } else {
+        errorCode = U_UNSUPPORTED_ERROR;
+    }
+}
+
+void TransliterationRuleBinary::writeData(const TransliterationRuleData& data,
+                                          UnicodeString& out, UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    // The variable names are only needed while parsing, and are not stored.
+    out.append(data.variablesBase);
+
+    const TransliterationRuleSet& ruleSet = data.ruleSet;
+    const UVector& ruleVector = *ruleSet.ruleVector;
+    appendInt(out, ruleVector.size());
+    for (int32_t i = 0; i < ruleVector.size(); ++i) {
+        const TransliterationRule* rule = static_cast<const TransliterationRule*>(ruleVector.elementAt(i));
+        // The rule constructor always makes a StringReplacer with a cursor.
+        if (rule->output->getDynamicClassID() != StringReplacer::getStaticClassID()) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        const StringReplacer* output = static_cast<const StringReplacer*>(rule->output);
+        appendString(out, rule->pattern);
+        appendInt(out, rule->anteContextLength);
+        appendInt(out, rule->keyLength);
+        out.append(static_cast<char16_t>(rule->flags));
+        appendString(out, output->output);
+        appendInt(out, output->cursorPos);
+        appendInt(out, rule->segmentsCount);
+        for (int32_t j = 0; j < rule->segmentsCount; ++j) {
+            int32_t k = 0;
+            while (k < data.variablesLength && data.variables[k] != rule->segments[j]) {
+                ++k;
+            }
+            if (k == data.variablesLength) {
+                errorCode = U_UNSUPPORTED_ERROR;
+                return;
+            }
+            appendInt(out, k);
+        }
+    }
+}
+
+//----------------------------------------------------------------------
+// Reading
+//----------------------------------------------------------------------
+
+void TransliterationRuleBinary::read(const uint8_t* bytes, int32_t length,
+                                     UTransDirection direction,
+                                     TransliteratorParser& parser,
+                                     UErrorCode& errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (bytes == nullptr || length < 8 || (length & 1) != 0 ||
+            (reinterpret_cast<uintptr_t>(bytes) & 1) != 0) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    U_ASSERT(parser.dataVector.isEmpty() && parser.idBlockVector.isEmpty());
+    Reader in(reinterpret_cast<const char16_t*>(bytes), length / U_SIZEOF_UCHAR);
+    const char16_t* header = in.readUnits(4, errorCode);
+    if (header[0] != kSignature || header[1] != kFormatVersion ||
+            header[2] != static_cast<char16_t>(direction)) {
+        // Wrong endianness, a different format version,
+        // or compiled for the other direction.
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+
+    UVector idBlocks(uprv_deleteUObject, nullptr, errorCode);
+    int32_t idBlockCount = in.readCount(1, errorCode);
+    for (int32_t i = 0; i < idBlockCount && U_SUCCESS(errorCode); ++i) {
+        LocalPointer<UnicodeString> idBlock(new UnicodeString(in.readString(errorCode)), errorCode);
+        idBlocks.adoptElement(idBlock.orphan(), errorCode);
+    }
+
+    LocalPointer<UnicodeSet> compoundFilter;
+    char16_t filterType = in.readUnit(errorCode);
+    if (filterType == FUNCTOR_SET) {
+        compoundFilter.adoptInstead(in.readSet(errorCode));
+        if (compoundFilter.isValid()) {
+            compoundFilter->freeze();  // as parsed by TransliteratorIDParser
+        }
+    } else if (filterType != FUNCTOR_NULL) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+    }
+
+    // Create the data objects first, since the variables point to them.
+    UVector dataVector(uprv_deleteUObject, nullptr, errorCode);
+    int32_t dataCount = in.readCount(1, errorCode);
+    for (int32_t i = 0; i < dataCount && U_SUCCESS(errorCode); ++i) {
+        LocalPointer<TransliterationRuleData> data(new TransliterationRuleData(errorCode), errorCode);
+        dataVector.adoptElement(data.orphan(), errorCode);
+    }
+
+    UVector variables(uprv_deleteUObject, nullptr, errorCode);
+    int32_t variablesLength = in.readCount(1, errorCode);
+    for (int32_t i = 0; i < variablesLength && U_SUCCESS(errorCode); ++i) {
+        UnicodeFunctor* f = readFunctor(in, dataVector, errorCode);
+        if (U_SUCCESS(errorCode)) {
+            variables.adoptElement(f, errorCode);
+        } else {
+            delete f;
+        }
+    }
+
+    // Hand the variables to the data objects, as the parser does:
+    // every data object gets the same array, and data[0] owns them.
+    for (int32_t i = 0; i < dataCount && U_SUCCESS(errorCode); ++i) {
+        TransliterationRuleData* data = static_cast<TransliterationRuleData*>(dataVector.elementAt(i));
+        data->variablesLength = variablesLength;
+        if (variablesLength > 0) {
+            data->variables = static_cast<UnicodeFunctor**>(
+                uprv_malloc(variablesLength * sizeof(UnicodeFunctor*)));
+            if (data->variables == nullptr) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                break;
+            }
+            for (int32_t j = 0; j < variablesLength; ++j) {
+                data->variables[j] = static_cast<UnicodeFunctor*>(variables.elementAt(j));
+            }
+        }
+        data->variablesAreOwned = false;
+    }
+    if (U_SUCCESS(errorCode) && dataCount > 0) {
+        static_cast<TransliterationRuleData*>(dataVector.elementAt(0))->variablesAreOwned = true;
+        variables.setDeleter(nullptr);
+        variables.removeAllElements();
+    }
+
+    for (int32_t i = 0; i < dataCount && U_SUCCESS(errorCode); ++i) {
+        readData(in, *static_cast<TransliterationRuleData*>(dataVector.elementAt(i)), errorCode);
+    }
+    if (U_SUCCESS(errorCode) && !in.atEnd()) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+    }
+    if (U_FAILURE(errorCode)) {
+        return;  // The local vectors delete what was read so far.
+    }
+
+    while (!idBlocks.isEmpty()) {
+        parser.idBlockVector.adoptElement(idBlocks.orphanElementAt(0), errorCode);
+    }
+    while (!dataVector.isEmpty()) {
+        parser.dataVector.addElement(dataVector.orphanElementAt(0), errorCode);
+    }
+    delete parser.compoundFilter;
+    parser.compoundFilter = compoundFilter.orphan();
+}
+
+UnicodeFunctor* TransliterationRuleBinary::readFunctor(Reader& in, const UVector& dataVector,
+                                                       UErrorCode& errorCode) {
+    char16_t type = in.readUnit(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    UnicodeFunctor* f = nullptr;
+    switch (type) {
+    case FUNCTOR_NULL:
+        return nullptr;
+    case FUNCTOR_SET:
+        return in.readSet(errorCode);
+    case FUNCTOR_STRING_MATCHER: {
+        UnicodeString pattern = in.readString(errorCode);
+        int32_t segmentNumber = in.readInt(errorCode);
+        int32_t dataIndex = in.readInt(errorCode);
+        if (U_SUCCESS(errorCode) && (dataIndex < 0 || dataIndex >= dataVector.size())) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        f = new StringMatcher(pattern, 0, pattern.length(), segmentNumber,
+                              *static_cast<const TransliterationRuleData*>(dataVector.elementAt(dataIndex)));
+        break;
+    }
+    case FUNCTOR_STRING_REPLACER: {
+        UnicodeString output = in.readString(errorCode);
+        UBool hasCursor = in.readUnit(errorCode) != 0;
+        int32_t cursorPos = in.readInt(errorCode);
+        int32_t dataIndex = in.readInt(errorCode);
+        if (U_SUCCESS(errorCode) && (dataIndex < 0 || dataIndex >= dataVector.size())) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        const TransliterationRuleData* data =
+            static_cast<const TransliterationRuleData*>(dataVector.elementAt(dataIndex));
+        f = hasCursor ? new StringReplacer(output, cursorPos, data)
+                      : new StringReplacer(output, data);
+        break;
+    }
+    case FUNCTOR_QUANTIFIER: {
+        int32_t minCount = in.readInt(errorCode);
+        int32_t maxCount = in.readInt(errorCode);
+        LocalPointer<UnicodeFunctor> matcher(readFunctor(in, dataVector, errorCode));
+        if (U_SUCCESS(errorCode) && (matcher.isNull() || matcher->toMatcher() == nullptr)) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        f = new Quantifier(matcher.getAlias(),
+                           static_cast<uint32_t>(minCount), static_cast<uint32_t>(maxCount));
+        if (f != nullptr) {
+            matcher.orphan();
+        }
+        break;
+    }
+    case FUNCTOR_FUNCTION_REPLACER: {
+        UnicodeString id = in.readString(errorCode);
+        LocalPointer<UnicodeSet> filter;
+        char16_t filterType = in.readUnit(errorCode);
+        if (filterType == FUNCTOR_SET) {
+            filter.adoptInstead(in.readSet(errorCode));
+        } else if (filterType != FUNCTOR_NULL) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        LocalPointer<UnicodeFunctor> replacer(readFunctor(in, dataVector, errorCode));
+        if (U_SUCCESS(errorCode) && (replacer.isNull() || replacer->toReplacer() == nullptr)) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        // Instantiate the function the same way the rule parser does.
+        int32_t pos = 0;
+        LocalPointer<TransliteratorIDParser::SingleID> single(
+            TransliteratorIDParser::parseSingleID(id, pos, UTRANS_FORWARD, errorCode));
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        if (single.isNull() || pos != id.length()) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return nullptr;
+        }
+        LocalPointer<Transliterator> t(single->createInstance());
+        if (t.isNull()) {
+            errorCode = U_INVALID_ID;
+            return nullptr;
+        }
+        if (filter.isValid()) {
+            t->adoptFilter(filter.orphan());
+        }
+        f = new FunctionReplacer(t.getAlias(), replacer.getAlias());
+        if (f != nullptr) {
+            t.orphan();
+            replacer.orphan();
+        }
+        break;
+    }
+    default:
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return nullptr;
+    }
+    if (f == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return f;
+}
+
+void TransliterationRuleBinary::readData(Reader& in, TransliterationRuleData& data,
+                                         UErrorCode& errorCode) {
+    data.variablesBase = in.readUnit(errorCode);
+
+    TransliterationRuleSet& ruleSet = data.ruleSet;
+    int32_t ruleCount = in.readCount(11, errorCode);
+    for (int32_t i = 0; i < ruleCount && U_SUCCESS(errorCode); ++i) {
+        UnicodeString pattern = in.readString(errorCode);
+        int32_t anteContextLength = in.readInt(errorCode);
+        int32_t keyLength = in.readInt(errorCode);
+        char16_t flags = in.readUnit(errorCode);
+        UnicodeString output = in.readString(errorCode);
+        int32_t cursorPos = in.readInt(errorCode);
+        int32_t segmentsCount = in.readCount(2, errorCode);
+        if (U_SUCCESS(errorCode) &&
+                (anteContextLength < 0 || keyLength < 0 ||
+                 anteContextLength + keyLength > pattern.length())) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        UnicodeFunctor** segments = nullptr;
+        if (segmentsCount > 0) {
+            segments = static_cast<UnicodeFunctor**>(uprv_malloc(segmentsCount * sizeof(UnicodeFunctor*)));
+            if (segments == nullptr) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            for (int32_t j = 0; j < segmentsCount; ++j) {
+                int32_t k = in.readInt(errorCode);
+                if (U_SUCCESS(errorCode) && (k < 0 || k >= data.variablesLength)) {
+                    errorCode = U_INVALID_FORMAT_ERROR;
+                }
+                if (U_FAILURE(errorCode)) {
+                    uprv_free(segments);
+                    return;
+                }
+                segments[j] = data.variables[k];
+            }
+        }
+        // The cursor offset carries the whole cursor position,
+        // which may lie outside the output text.
+        TransliterationRule* rule = new TransliterationRule(
+            pattern, anteContextLength, anteContextLength + keyLength,
+            output, 0, cursorPos,
+            segments, segmentsCount,
+            (flags & TransliterationRule::ANCHOR_START) != 0,
+            (flags & TransliterationRule::ANCHOR_END) != 0,
+            &data, errorCode);
+        if (rule == nullptr) {
+            uprv_free(segments);
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        ruleSet.addRule(rule, errorCode);
+    }
+
+    // The rules were checked for masking when they were compiled;
+    // only the index needs to be rebuilt.
+    ruleSet.buildIndex(errorCode);
+}
+
+U_NAMESPACE_END
+
+#endif /* #if !UCONFIG_NO_TRANSLITERATION */
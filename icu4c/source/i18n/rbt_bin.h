@@ -0,0 +1,115 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+* rbt_bin.h
+*
+* Precompiled (binary) form of transliteration rules.
+**********************************************************************
+*/
+#ifndef RBT_BIN_H
+#define RBT_BIN_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/parseerr.h"
+#include "unicode/utrans.h"
+
+U_NAMESPACE_BEGIN
+
+class TransliterationRuleData;
+class TransliteratorParser;
+class UnicodeFunctor;
+class UnicodeString;
+class UVector;
+
+/**
+ * Reads and writes the binary form of the output of TransliteratorParser:
+ * the ::ID blocks, the compound filter, the shared variables (sets,
+ * matchers, quantifiers, replacers and functions) and, for each
+ * TransliterationRuleData, its rules.
+ *
+ * genrb stores this form next to the rule text of each
+ * RuleBasedTransliteratorIDs/<ID>/file table, so that the registry can
+ * build the rule data without running the rule parser.  The data is only
+ * valid for the ICU version and platform endianness that wrote it; read()
+ * fails with U_INVALID_FORMAT_ERROR for anything it does not recognize, and
+ * callers then fall back to parsing the rule text.
+ *
+ * The binary form is an array of 16-bit units in platform endianness:
+ * <pre>
+ *   signature (0x5472), format version, direction, reserved
+ *   int32 idBlockCount, idBlockCount strings
+ *   optional UnicodeSet compoundFilter
+ *   int32 dataCount
+ *   int32 variableCount, variableCount functors
+ *   dataCount rule data items
+ * </pre>
+ * where an int32 is two units (high unit first), a string is its length
+ * followed by its code units, and each functor starts with a type unit.
+ * See rbt_bin.cpp for the details.
+ */
+class U_I18N_API TransliterationRuleBinary /* all static */ {
+public:
+    /**
+     * Parses the rules and writes their binary form to dest.
+     * @param rules the rule text, as passed to TransliteratorParser::parse()
+     * @param direction the direction in which the rules will be used
+     * @param dest destination buffer; may be nullptr if capacity is 0
+     * @param capacity size of dest in bytes
+     * @param parseError receives parse error details
+     * @param errorCode ICU error code; U_BUFFER_OVERFLOW_ERROR if the
+     *        binary form does not fit, U_UNSUPPORTED_ERROR if the rules
+     *        contain something that has no binary form
+     * @return the length of the binary form in bytes
+     */
+    static int32_t compileRules(const UnicodeString& rules,
+                                UTransDirection direction,
+                                uint8_t* dest, int32_t capacity,
+                                UParseError& parseError,
+                                UErrorCode& errorCode);
+
+    /**
+     * Writes the binary form of the parser's current output.
+     * @return the length of the binary form in bytes
+     * @see compileRules
+     */
+    static int32_t write(const TransliteratorParser& parser,
+                         UTransDirection direction,
+                         uint8_t* dest, int32_t capacity,
+                         UErrorCode& errorCode);
+
+    /**
+     * Populates a newly constructed parser from the binary form, as if
+     * TransliteratorParser::parse() had been called on the original rules.
+     * The bytes need to be 16-bit aligned.  On failure, the parser is left
+     * empty and can still be used to parse the rule text.
+     */
+    static void read(const uint8_t* bytes, int32_t length,
+                     UTransDirection direction,
+                     TransliteratorParser& parser,
+                     UErrorCode& errorCode);
+
+private:
+    TransliterationRuleBinary() = delete;  // no constructor
+
+    class Reader;  // defined in rbt_bin.cpp
+
+    static void writeFunctor(const UnicodeFunctor* f, const UVector& dataVector,
+                             UnicodeString& out, UErrorCode& errorCode);
+    static void writeData(const TransliterationRuleData& data,
+                          UnicodeString& out, UErrorCode& errorCode);
+
+    static UnicodeFunctor* readFunctor(Reader& in, const UVector& dataVector,
+                                       UErrorCode& errorCode);
+    static void readData(Reader& in, TransliterationRuleData& data,
+                         UErrorCode& errorCode);
+};
+
+U_NAMESPACE_END
+
+#endif /* #if !UCONFIG_NO_TRANSLITERATION */
+
+#endif
@@ -17,10 +17,12 @@
 #include "unicode/rep.h"
 #include "unicode/unifilt.h"
 #include "unicode/uniset.h"
+#include "unicode/usetiter.h"
 #include "unicode/utf16.h"
 #include "rbt_rule.h"
 #include "rbt_data.h"
 #include "cmemory.h"
+#include "quant.h"
 #include "strmatch.h"
 #include "strrepl.h"
 #include "util.h"
@@ -544,6 +546,67 @@ void TransliterationRule::addSourceSetTo(UnicodeSet& toUnionTo) const {
     }
 }
 
+/**
+ * Return true if the given matcher functor may match the empty string
+ * in front of a character.
+ */
+UBool TransliterationRule::mayMatchEmpty(const UnicodeFunctor& matcher) {
+    UClassID type = matcher.getDynamicClassID();
+    if (type == UnicodeSet::getStaticClassID()) {
+        // Sets never match the empty string, and U_ETHER only matches
+        // at the limit.
+        return false;
+    } else if (type == Quantifier::getStaticClassID()) {
+        const Quantifier& q = static_cast<const Quantifier&>(matcher);
+        return q.minCount == 0 || mayMatchEmpty(*q.matcher);
+    } else if (type == StringMatcher::getStaticClassID()) {
+        const StringMatcher& m = static_cast<const StringMatcher&>(matcher);
+        for (int32_t i=0; i<m.pattern.length(); ++i) {
+            const UnicodeFunctor* f = m.data->lookup(m.pattern.charAt(i));
+            if (f == nullptr || !mayMatchEmpty(*f)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return true;
+}
+
+/**
+ * Union the set of all characters at which a match of this rule may
+ * start into the given set.
+ */
+void TransliterationRule::addMatchStartSetTo(UnicodeSet& toUnionTo) const {
+    // Walk the key and post context until an element is found that
+    // must consume at least one character.
+    int32_t limit = pattern.length();
+    for (int32_t i=anteContextLength; i<limit; ) {
+        UChar32 ch = pattern.char32At(i);
+        i += U16_LENGTH(ch);
+        const UnicodeMatcher* matcher = data->lookupMatcher(ch);
+        if (matcher == nullptr) {
+            toUnionTo.add(ch);
+            return;
+        }
+        UnicodeSet matchSet;
+        matcher->addMatchSetTo(matchSet);
+        for (UnicodeSetIterator it(matchSet); it.nextRange();) {
+            if (!it.isString()) {
+                toUnionTo.add(it.getCodepoint(), it.getCodepointEnd());
+            } else if (!it.getString().isEmpty()) {
+                toUnionTo.add(it.getString().char32At(0));
+            }
+        }
+        // Only if this element may match the empty string, such as x*,
+        // can the next element start the match.
+        if (!mayMatchEmpty(*data->lookup(ch))) {
+            return;
+        }
+    }
+    // The rule may match without consuming any text.
+    toUnionTo.add(0, 0x10FFFF);
+}
+
 /**
  * Union the set of all characters that may be emitted by this rule
  * into the given set.
@@ -296,9 +296,24 @@ class TransliterationRule : public UMemory {
      */
     void addTargetSetTo(UnicodeSet& toUnionTo) const;
 
+    /**
+     * Union the set of all characters at which a match of this rule
+     * may start, that is, that may appear at the start of the key,
+     * into the given set.  If the key and post context may match
+     * without consuming any text, this is all code points.
+     */
+    void addMatchStartSetTo(UnicodeSet& toUnionTo) const;
+
  private:
 
+    /**
+     * Return true if the given matcher functor, a stand-in in a rule
+     * pattern, may match the empty string in front of a character.
+     */
+    static UBool mayMatchEmpty(const UnicodeFunctor& matcher);
+
     friend class StringMatcher;
+    friend class TransliterationRuleBinary;
 
     TransliterationRule &operator=(const TransliterationRule &other); // forbid copying of this class
 };
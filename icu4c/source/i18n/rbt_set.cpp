@@ -164,7 +164,8 @@ U_NAMESPACE_BEGIN
  * Construct a new empty rule set.
  */
 TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) :
-        UMemory(), ruleVector(nullptr), rules(nullptr), index {}, maxContextLength(0) {
+        UMemory(), ruleVector(nullptr), rules(nullptr), index {}, matchStartSet(nullptr),
+        maxContextLength(0) {
     LocalPointer<UVector> lpRuleVector(new UVector(_deleteRule, nullptr, status), status);
     if (U_FAILURE(status)) {
         return;
@@ -179,6 +180,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(nullptr),
     rules(nullptr),
+    matchStartSet(nullptr),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
@@ -209,6 +211,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    delete matchStartSet;
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -254,6 +257,8 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = nullptr;
+    delete matchStartSet;
+    matchStartSet = nullptr;
 }
 
 /**
@@ -267,6 +272,55 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
  * although for optimal performance it shouldn't be.
  */
 void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status) {
+    buildIndex(status);
+    if (U_FAILURE(status) || rules == nullptr) {
+        return;
+    }
+
+    int32_t j;
+    int16_t x;
+
+    // TODO Add error reporting that indicates the rules that
+    //      are being masked.
+    //UnicodeString errors;
+
+    /* Check for masking.  This is MUCH faster than our old check,
+     * which was each rule against each following rule, since we
+     * only have to check for masking within each bin now.  It's
+     * 256*O(n2^2) instead of O(n1^2), where n1 is the total rule
+     * count, and n2 is the per-bin rule count.  But n2<<n1, so
+     * it's a big win.
+     */
+    for (x=0; x<256; ++x) {
+        for (j=index[x]; j<index[x+1]-1; ++j) {
+            TransliterationRule* r1 = rules[j];
+            for (int32_t k=j+1; k<index[x+1]; ++k) {
+                TransliterationRule* r2 = rules[k];
+                if (r1->masks(*r2)) {
+//|                 if (errors == null) {
+//|                     errors = new StringBuffer();
+//|                 } else {
+//|                     errors.append("\n");
+//|                 }
+//|                 errors.append("Rule " + r1 + " masks " + r2);
+                    status = U_RULE_MASK_ERROR;
+                    maskingError(*r1, *r2, parseError);
+                    return;
+                }
+            }
+        }
+    }
+
+    //if (errors != null) {
+    //    throw new IllegalArgumentException(errors.toString());
+    //}
+}
+
+/**
+ * Build the rule array and index table from the rule vector,
+ * without checking for masked rules.
+ */
+void TransliterationRuleSet::buildIndex(UErrorCode& status) {
     /* Construct the rule array and index table.  We reorder the
      * rules by sorting them into 256 bins.  Each bin contains all
      * rules matching the index value for that bin.  A rule
@@ -330,6 +384,20 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
         return;
     }
 
+    /* Collect the characters at which a rule may match, so that
+     * transliterate() can skip over text that no rule can change.
+     */
+    delete matchStartSet;
+    matchStartSet = new UnicodeSet();
+    if (matchStartSet == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (j=0; j<n; ++j) {
+        static_cast<TransliterationRule*>(ruleVector->elementAt(j))->addMatchStartSetTo(*matchStartSet);
+    }
+    matchStartSet->freeze();
+
     /* Freeze things into an array.
      */
     uprv_free(rules); // Contains alias pointers
@@ -348,41 +416,6 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     for (j=0; j<v.size(); ++j) {
         rules[j] = static_cast<TransliterationRule*>(v.elementAt(j));
     }
-
-    // TODO Add error reporting that indicates the rules that
-    //      are being masked.
-    //UnicodeString errors;
-
-    /* Check for masking.  This is MUCH faster than our old check,
-     * which was each rule against each following rule, since we
-     * only have to check for masking within each bin now.  It's
-     * 256*O(n2^2) instead of O(n1^2), where n1 is the total rule
-     * count, and n2 is the per-bin rule count.  But n2<<n1, so
-     * it's a big win.
-     */
-    for (x=0; x<256; ++x) {
-        for (j=index[x]; j<index[x+1]-1; ++j) {
-            TransliterationRule* r1 = rules[j];
-            for (int32_t k=j+1; k<index[x+1]; ++k) {
-                TransliterationRule* r2 = rules[k];
-                if (r1->masks(*r2)) {
-//|                 if (errors == null) {
-//|                     errors = new StringBuffer();
-//|                 } else {
-//|                     errors.append("\n");
-//|                 }
-//|                 errors.append("Rule " + r1 + " masks " + r2);
-                    status = U_RULE_MASK_ERROR;
-                    maskingError(*r1, *r2, parseError);
-                    return;
-                }
-            }
-        }
-    }
-
-    //if (errors != null) {
-    //    throw new IllegalArgumentException(errors.toString());
-    //}
 }
 
 /**
@@ -401,7 +434,28 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = static_cast<int16_t>(text.char32At(pos.start) & 0xFF);
+    UChar32 c = text.char32At(pos.start);
+    if (matchStartSet != nullptr && !matchStartSet->contains(c)) {
+        // No rule can match here.  Skip the run of characters at which
+        // no rule can match, spanning the buffer directly if possible.
+        const UnicodeString* str = dynamic_cast<const UnicodeString*>(&text);
+        const char16_t* buffer = str != nullptr ? str->getBuffer() : nullptr;
+        if (buffer != nullptr) {
+            int32_t length = matchStartSet->span(buffer + pos.start, pos.limit - pos.start,
+                                                 USET_SPAN_NOT_CONTAINED);
+            // An unpaired lead surrogate at pos.limit - 1 may be in the set
+            // even though its code point is not; always make progress.
+            pos.start += length > 0 ? length : U16_LENGTH(c);
+        } else {
+            do {
+                pos.start += U16_LENGTH(c);
+            } while (pos.start < pos.limit &&
+                     !matchStartSet->contains(c = text.char32At(pos.start)));
+        }
+        _debugOut("no match", nullptr, text, pos);
+        return true;
+    }
+    int16_t indexByte = static_cast<int16_t>(c & 0xFF);
     for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
         UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
         switch (m) {
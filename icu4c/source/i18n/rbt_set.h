@@ -58,6 +58,14 @@ class TransliterationRuleSet : public UMemory {
      */
     int32_t index[257];
 
+    /**
+     * Frozen set of all characters at which some rule may start to
+     * match.  transliterate() skips runs of other characters without
+     * trying any rules.  This is created by freeze(), together with
+     * rules[].
+     */
+    UnicodeSet* matchStartSet;
+
     /**
      * Length of the longest preceding context
      */
@@ -157,6 +165,15 @@ class TransliterationRuleSet : public UMemory {
 
 private:
 
+    /**
+     * Build rules[], index[] and matchStartSet from ruleVector.  This
+     * is freeze() without its check for masked rules.
+     * @param status     Output parameter filled in with success or failure status.
+     */
+    void buildIndex(UErrorCode& status);
+
+    friend class TransliterationRuleBinary; // reads and writes the private data
+
     TransliterationRuleSet &operator=(const TransliterationRuleSet &other); // forbid copying of this class
 };
 
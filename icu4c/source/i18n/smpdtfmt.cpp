@@ -69,6 +69,7 @@
 #include <float.h>
 #include "smpdtfst.h"
 #include "sharednumberformat.h"
+#include "unifiedcache.h"
 #include "ucasemap_imp.h"
 #include "ustr_imp.h"
 #include "charstr.h"
@@ -80,6 +81,8 @@
 #include "chnsecal.h"
 #include "dangical.h"
 #include "japancal.h"
+#include "gregoimp.h"
+#include "iso8601cal.h"
 #include <typeinfo>
 
 #if defined( U_DEBUG_CALSVC ) || defined (U_DEBUG_CAL)
@@ -330,6 +333,253 @@ const NumberFormat *SimpleDateFormat::getNumberFormatByIndex(
 
 //----------------------------------------------------------------------
 
+/**
+ * A pattern split into literal text and fields, as SimpleDateFormat::_format()
+ * and SimpleDateFormat::parse() process it, so that they need not scan the
+ * pattern string on every call.  See SimpleDateFormat::compilePattern().
+ * Compiled patterns only depend on the pattern string, and they are shared
+ * through the UnifiedCache.
+ */
+class CompiledDatePattern : public SharedObject {
+public:
+    struct Item {
+        /** The pattern character, or 0 for literal text. */
+        char16_t patternChar;
+        /** The field of the pattern character, UDAT_FIELD_COUNT for literal text. */
+        UDateFormatField field;
+        /** The number of pattern characters, or the length of the literal text. */
+        int32_t count;
+        /** The start of the literal text in literals. */
+        int32_t literalStart;
+        /** The start of this item in the pattern, including any quotes. */
+        int32_t patternStart;
+        /** The limit of this item in the pattern. */
+        int32_t patternLimit;
+        /** true if this is a numeric field. */
+        UBool numeric;
+        /** true if this is a field immediately followed by a numeric field. */
+        UBool abutsNumeric;
+    };
+
+    MaybeStackArray<Item, 8> items;
+    int32_t itemCount = 0;
+    /** The unquoted literal text of all items. */
+    UnicodeString literals;
+    /**
+     * true if all fields are numeric Gregorian calendar fields, which
+     * SimpleDateFormat::fastFormat() can compute without a Calendar.
+     */
+    UBool numericOnly = true;
+    /** The maximum length of the output of fastFormat(). */
+    int32_t maxLength = 0;
+
+    virtual ~CompiledDatePattern();
+
+    UBool addItem(char16_t patternChar, UDateFormatField field, int32_t count,
+                  int32_t patternStart, int32_t patternLimit, UBool numeric);
+};
+
+CompiledDatePattern::~CompiledDatePattern() {}
+
+UBool CompiledDatePattern::addItem(char16_t patternChar, UDateFormatField field, int32_t count,
+                                   int32_t patternStart, int32_t patternLimit, UBool numeric) {
+    if (itemCount == items.getCapacity() && items.resize(2 * itemCount, itemCount) == nullptr) {
+        return false;
+    }
+    Item &item = items[itemCount++];
+    item.patternChar = patternChar;
+    item.field = field;
+    item.count = count;
+    item.literalStart = literals.length() - (patternChar == 0 ? count : 0);
+    item.patternStart = patternStart;
+    item.patternLimit = patternLimit;
+    item.numeric = numeric;
+    item.abutsNumeric = false;
+    if (itemCount >= 2 && items[itemCount - 2].patternChar != 0) {
+        items[itemCount - 2].abutsNumeric = numeric;
+    }
+    // At most maxIntCount digits for a field, or count digits if that is more.
+    maxLength += (patternChar == 0) ? count : count + 10;
+    return true;
+}
+
+/**
+ * Cache key for SimpleDateFormat::compilePattern(): the pattern string.
+ */
+class CompiledDatePatternKey : public CacheKey<CompiledDatePattern> {
+private:
+    UnicodeString fPattern;
+protected:
+    virtual bool equals(const CacheKeyBase &other) const override {
+        if (!CacheKey<CompiledDatePattern>::equals(other)) {
+            return false;
+        }
+        // We know that this and other are of same class if we get this far.
+        return fPattern == static_cast<const CompiledDatePatternKey &>(other).fPattern;
+    }
+public:
+    CompiledDatePatternKey(const UnicodeString &pattern) : fPattern(pattern) {}
+    CompiledDatePatternKey(const CompiledDatePatternKey &other)
+            : CacheKey<CompiledDatePattern>(other), fPattern(other.fPattern) {}
+    virtual ~CompiledDatePatternKey();
+    virtual int32_t hashCode() const override {
+        return static_cast<int32_t>(37u * static_cast<uint32_t>(CacheKey<CompiledDatePattern>::hashCode()) +
+                                    static_cast<uint32_t>(fPattern.hashCode()));
+    }
+    virtual CacheKeyBase *clone() const override {
+        return new CompiledDatePatternKey(*this);
+    }
+    virtual const CompiledDatePattern *createObject(
+            const void * /*unused*/, UErrorCode &status) const override {
+        CompiledDatePattern *result = SimpleDateFormat::compilePattern(fPattern, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        result->addRef();
+        return result;
+    }
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const override {
+        int32_t length = fPattern.extract(0, fPattern.length(), buffer, bufLen - 1, US_INV);
+        buffer[length < bufLen ? length : bufLen - 1] = 0;
+        return buffer;
+    }
+};
+
+CompiledDatePatternKey::~CompiledDatePatternKey() {}
+
+CompiledDatePattern *SimpleDateFormat::compilePattern(const UnicodeString &pattern, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<CompiledDatePattern> compiled(new CompiledDatePattern(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    // A run of literal text, with any quotes, ends at the next unquoted
+    // pattern character; a field is a run of the same pattern character.
+    UBool inQuote = false;
+    int32_t literalPatternStart = -1;
+    int32_t literalStart = 0;
+    int32_t patternLength = pattern.length();
+    for (int32_t i = 0; i <= patternLength;) {
+        char16_t ch = i < patternLength ? pattern[i] : 0;
+        if (i < patternLength && (ch == QUOTE || inQuote || !isSyntaxChar(ch))) {
+            if (literalPatternStart < 0) {
+                literalPatternStart = i;
+                literalStart = compiled->literals.length();
+            }
+            if (ch != QUOTE) {
+                compiled->literals.append(ch);
+            } else if ((i+1) < patternLength && pattern[i+1] == QUOTE) {
+                // Consecutive single quotes are a single quote literal,
+                // either outside of quotes or between quotes
+                compiled->literals.append(QUOTE);
+                ++i;
+            } else {
+                inQuote = !inQuote;
+            }
+            ++i;
+            continue;
+        }
+        // The literal text may be empty, as for "yyyy''", but parse()
+        // still matches it.
+        if (literalPatternStart >= 0) {
+            if (!compiled->addItem(0, UDAT_FIELD_COUNT, compiled->literals.length() - literalStart,
+                                   literalPatternStart, i, false)) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return nullptr;
+            }
+            literalPatternStart = -1;
+        }
+        if (i == patternLength) {
+            break;
+        }
+        int32_t count = 1;
+        while ((i + count) < patternLength && pattern[i + count] == ch) {
+            ++count;
+        }
+        UDateFormatField field = DateFormatSymbols::getPatternCharIndex(ch);
+        if (!compiled->addItem(ch, field, count, i, i + count,
+                               DateFormatSymbols::isNumericField(field, count))) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return nullptr;
+        }
+        i += count;
+        switch (field) {
+        case UDAT_MONTH_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+            if (count > 2) {
+                compiled->numericOnly = false;  // month names
+            }
+            U_FALLTHROUGH;
+        case UDAT_YEAR_FIELD:
+        case UDAT_EXTENDED_YEAR_FIELD:
+        case UDAT_DATE_FIELD:
+        case UDAT_DAY_OF_YEAR_FIELD:
+        case UDAT_HOUR_OF_DAY0_FIELD:
+        case UDAT_HOUR_OF_DAY1_FIELD:
+        case UDAT_HOUR0_FIELD:
+        case UDAT_HOUR1_FIELD:
+        case UDAT_MINUTE_FIELD:
+        case UDAT_SECOND_FIELD:
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            // fastFormat() writes up to maxIntCount digits,
+            // so that the minimum never exceeds the maximum.
+            if (count > 10) {
+                compiled->numericOnly = false;
+            }
+            break;
+        default:
+            compiled->numericOnly = false;
+            break;
+        }
+    }
+    if (compiled->literals.isBogus()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    return compiled.orphan();
+}
+
+const CompiledDatePattern *SimpleDateFormat::getCompiledPattern(const UnicodeString &pattern,
+                                                                UErrorCode &status) {
+    const CompiledDatePattern *compiled = nullptr;
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    cache->get(CompiledDatePatternKey(pattern), compiled, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return compiled;
+}
+
+/**
+ * Writes value with minDigits to maxDigits digits, as zeroPaddingNumber()
+ * does with fSimpleNumberFormatter: Higher digits beyond maxDigits are
+ * dropped.  The value must not be negative.
+ */
+static int32_t writeFastDigits(char16_t *dest, int32_t value,
+                               int32_t minDigits, int32_t maxDigits, char16_t zero) {
+    char16_t digits[10];
+    int32_t length = 0;
+    do {
+        digits[length++] = static_cast<char16_t>(zero + value % 10);
+        value /= 10;
+    } while (value != 0 && length < maxDigits);
+    int32_t destLength = 0;
+    while (destLength < minDigits - length) {
+        dest[destLength++] = zero;
+    }
+    while (length > 0) {
+        dest[destLength++] = digits[--length];
+    }
+    return destLength;
+}
+
+//----------------------------------------------------------------------
+
 SimpleDateFormat::~SimpleDateFormat()
 {
     delete fSymbols;
@@ -338,6 +588,8 @@ SimpleDateFormat::~SimpleDateFormat()
     }
     delete fTimeZoneFormat;
     delete fSimpleNumberFormatter;
+    delete fNonNegativeNumberFormat;
+    SharedObject::clearPtr(fCompiledPattern);
 
 #if !UCONFIG_NO_BREAK_ITERATION
     delete fCapitalizationBrkIter;
@@ -564,6 +816,7 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fPattern = other.fPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    SharedObject::copyPtr(other.fCompiledPattern, fCompiledPattern);
 
     fLocale = other.fLocale;
 
@@ -1071,52 +1324,26 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
         }
     }
 
-    UBool inQuote = false;
-    char16_t prevCh = 0;
-    int32_t count = 0;
+    if (fCompiledPattern == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        delete calClone;
+        return appendTo;
+    }
+
     int32_t fieldNum = 0;
     UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
 
-    // loop through the pattern string character by character
-    int32_t patternLength = fPattern.length();
-    for (int32_t i = 0; i < patternLength && U_SUCCESS(status); ++i) {
-        char16_t ch = fPattern[i];
-
-        // Use subFormat() to format a repeated pattern character
-        // when a different pattern or non-pattern character is seen
-        if (ch != prevCh && count > 0) {
-            subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++,
-                      prevCh, handler, *workCal, status);
-            count = 0;
-        }
-        if (ch == QUOTE) {
-            // Consecutive single quotes are a single quote literal,
-            // either outside of quotes or between quotes
-            if ((i+1) < patternLength && fPattern[i+1] == QUOTE) {
-                appendTo += QUOTE;
-                ++i;
-            } else {
-                inQuote = ! inQuote;
-            }
-        }
-        else if (!inQuote && isSyntaxChar(ch)) {
-            // ch is a date-time pattern character to be interpreted
-            // by subFormat(); count the number of times it is repeated
-            prevCh = ch;
-            ++count;
-        }
-        else {
-            // Append quoted characters and unquoted non-pattern characters
-            appendTo += ch;
+    // Append the literal text, and use subFormat() to format each field
+    for (int32_t i = 0; i < fCompiledPattern->itemCount && U_SUCCESS(status); ++i) {
+        const CompiledDatePattern::Item &item = fCompiledPattern->items[i];
+        if (item.patternChar == 0) {
+            appendTo.append(fCompiledPattern->literals, item.literalStart, item.count);
+        } else {
+            subFormat(appendTo, item.patternChar, item.count, capitalizationContext, fieldNum++,
+                      item.patternChar, handler, *workCal, status);
         }
     }
 
-    // Format the last item in the pattern, if any
-    if (count > 0) {
-        subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++,
-                  prevCh, handler, *workCal, status);
-    }
-
     delete calClone;
 
     return appendTo;
@@ -1124,6 +1351,154 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
 
 //----------------------------------------------------------------------
 
+UBool
+SimpleDateFormat::fastFormat(UDate date, UnicodeString& appendTo,
+                             FieldPositionHandler& handler,
+                             FastFormatDay* lastDay) const
+{
+    static const int32_t maxIntCount = 10;
+    // Dates within some 3000 years of 1970, so that all fields fit.
+    static const double kMaxFastMillis = 1.0e14;
+
+    if (fCompiledPattern == nullptr || !fCompiledPattern->numericOnly || fFastZeroDigit == 0 ||
+            fSharedNumberFormatters != nullptr || fCalendar == nullptr ||
+            (typeid(*fCalendar) != typeid(GregorianCalendar) &&
+             typeid(*fCalendar) != typeid(ISO8601Calendar)) ||
+            !(-kMaxFastMillis < date && date < kMaxFastMillis)) {
+        return false;
+    }
+
+    // Same computation as in Calendar::computeFields().
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t rawOffset, dstOffset;
+    fCalendar->getTimeZone().getOffset(date, false, rawOffset, dstOffset, status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    int32_t millisInDay;
+    int32_t day = static_cast<int32_t>(ClockMath::floorDivide(
+        date + (rawOffset + dstOffset), U_MILLIS_PER_DAY, &millisInDay));
+    // Leave the Julian calendar and the year of the Gregorian change,
+    // with its shorter day of year, to GregorianCalendar.
+    double cutoverDay = ClockMath::floorDivide(
+        static_cast<const GregorianCalendar*>(fCalendar)->getGregorianChange(),
+        static_cast<double>(U_MILLIS_PER_DAY));
+    if (day < cutoverDay + 366) {
+        return false;
+    }
+    FastFormatDay fields;
+    if (lastDay != nullptr && lastDay->valid && lastDay->day == day) {
+        fields = *lastDay;
+    } else {
+        int8_t dow;
+        Grego::dayToFields(day, fields.year, fields.month, fields.dayOfMonth, dow,
+                           fields.dayOfYear, status);
+        if (U_FAILURE(status)) {
+            return false;
+        }
+        fields.day = day;
+        fields.valid = true;
+        if (lastDay != nullptr) {
+            *lastDay = fields;
+        }
+    }
+    // With a proleptic Gregorian calendar, the cutover does not exclude
+    // extended years <= 0, which are years of the BC era.
+    if (fields.year <= 0) {
+        return false;
+    }
+    int32_t year = fields.year;
+    int32_t month = fields.month;
+    int32_t dom = fields.dayOfMonth;
+    int32_t doy = fields.dayOfYear;
+    int32_t hour = millisInDay / U_MILLIS_PER_HOUR;
+    int32_t minute = (millisInDay / U_MILLIS_PER_MINUTE) % 60;
+    int32_t second = (millisInDay / U_MILLIS_PER_SECOND) % 60;
+    int32_t millis = millisInDay % U_MILLIS_PER_SECOND;
+
+    MaybeStackArray<char16_t, 64> buffer;
+    if (fCompiledPattern->maxLength > buffer.getCapacity() &&
+            buffer.resize(fCompiledPattern->maxLength) == nullptr) {
+        return false;
+    }
+    char16_t *dest = buffer.getAlias();
+    char16_t zero = fFastZeroDigit;
+    int32_t offset = appendTo.length();
+    int32_t length = 0;
+    for (int32_t i = 0; i < fCompiledPattern->itemCount; ++i) {
+        const CompiledDatePattern::Item &item = fCompiledPattern->items[i];
+        int32_t count = item.count;
+        int32_t start = length;
+        if (item.patternChar == 0) {
+            fCompiledPattern->literals.extract(item.literalStart, count, dest + length);
+            length += count;
+            continue;
+        }
+        switch (item.field) {
+        case UDAT_YEAR_FIELD:
+            if (count == 2) {
+                length += writeFastDigits(dest + length, year, 2, 2, zero);
+            } else {
+                length += writeFastDigits(dest + length, year, count, maxIntCount, zero);
+            }
+            break;
+        case UDAT_EXTENDED_YEAR_FIELD:
+            length += writeFastDigits(dest + length, year, count, maxIntCount, zero);
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+            length += writeFastDigits(dest + length, month + 1, count, maxIntCount, zero);
+            break;
+        case UDAT_DATE_FIELD:
+            length += writeFastDigits(dest + length, dom, count, maxIntCount, zero);
+            break;
+        case UDAT_DAY_OF_YEAR_FIELD:
+            length += writeFastDigits(dest + length, doy, count, maxIntCount, zero);
+            break;
+        case UDAT_HOUR_OF_DAY0_FIELD:
+            length += writeFastDigits(dest + length, hour, count, maxIntCount, zero);
+            break;
+        case UDAT_HOUR_OF_DAY1_FIELD:
+            length += writeFastDigits(dest + length, hour == 0 ? 24 : hour, count, maxIntCount, zero);
+            break;
+        case UDAT_HOUR0_FIELD:
+            length += writeFastDigits(dest + length, hour % 12, count, maxIntCount, zero);
+            break;
+        case UDAT_HOUR1_FIELD:
+            length += writeFastDigits(dest + length, hour % 12 == 0 ? 12 : hour % 12, count, maxIntCount, zero);
+            break;
+        case UDAT_MINUTE_FIELD:
+            length += writeFastDigits(dest + length, minute, count, maxIntCount, zero);
+            break;
+        case UDAT_SECOND_FIELD:
+            length += writeFastDigits(dest + length, second, count, maxIntCount, zero);
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            // Fractional seconds left-justify, as in subFormat().
+            {
+                int32_t value = millis;
+                if (count == 1) {
+                    value /= 100;
+                } else if (count == 2) {
+                    value /= 10;
+                }
+                length += writeFastDigits(dest + length, value, count > 3 ? 3 : count, maxIntCount, zero);
+                for (int32_t j = 3; j < count; ++j) {
+                    dest[length++] = zero;
+                }
+            }
+            break;
+        default:
+            UPRV_UNREACHABLE_EXIT;
+        }
+        handler.addAttribute(item.field, offset + start, offset + length);
+    }
+    appendTo.append(dest, length);
+    return true;
+}
+
+//----------------------------------------------------------------------
+
 /* Map calendar field into calendar field level.
  * the larger the level, the smaller the field unit.
  * For example, UCAL_ERA level is 0, UCAL_YEAR level is 10,
@@ -1310,6 +1685,9 @@ _appendSymbolWithMonthPattern(UnicodeString& dst, int32_t value, const UnicodeSt
 
 void
 SimpleDateFormat::initSimpleNumberFormatter(UErrorCode &status) {
+    fFastZeroDigit = 0;
+    delete fNonNegativeNumberFormat;
+    fNonNegativeNumberFormat = nullptr;
     if (U_FAILURE(status)) {
         return;
     }
@@ -1328,6 +1706,11 @@ SimpleDateFormat::initSimpleNumberFormatter(UErrorCode &status) {
     );
     if (fSimpleNumberFormatter == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UChar32 zero = syms->getCodePointZero();
+    if (zero > 0 && zero <= 0xfff6) {
+        fFastZeroDigit = static_cast<char16_t>(zero);
     }
 }
 
@@ -2266,15 +2649,17 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
     int32_t count = 0;
     UTimeZoneFormatTimeType tzTimeType = UTZFMT_TIME_TYPE_UNKNOWN;
 
-    // For parsing abutting numeric fields. 'abutPat' is the
-    // offset into 'pattern' of the first of 2 or more abutting
-    // numeric fields.  'abutStart' is the offset into 'text'
+    // For parsing abutting numeric fields. 'abutItem' is the
+    // index of the first of 2 or more abutting numeric fields in
+    // fCompiledPattern.  'abutStart' is the offset into 'text'
     // where parsing the fields begins. 'abutPass' starts off as 0
     // and increments each time we try to parse the fields.
-    int32_t abutPat = -1; // If >=0, we are in a run of abutting numeric fields
+    int32_t abutItem = -1; // If >=0, we are in a run of abutting numeric fields
     int32_t abutStart = 0;
     int32_t abutPass = 0;
-    UBool inQuote = false;
+    // If >=0, the offset in fPattern from where to match the next literal
+    // text, after skipping whitespace that follows a missing era.
+    int32_t literalPatternStart = -1;
 
     MessageFormat * numericLeapMonthFormatter = nullptr;
 
@@ -2308,33 +2693,33 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
         }
     }
 
-    for (int32_t i=0; i<fPattern.length(); ++i) {
-        char16_t ch = fPattern.charAt(i);
+    if (fCompiledPattern == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        goto ExitParse;
+    }
 
-        // Handle alphabetic field characters.
-        if (!inQuote && isSyntaxChar(ch)) {
-            int32_t fieldPat = i;
+    for (int32_t itemIndex = 0; itemIndex < fCompiledPattern->itemCount; ++itemIndex) {
+        const CompiledDatePattern::Item &item = fCompiledPattern->items[itemIndex];
+        char16_t ch = item.patternChar;
+        // The offset of the last pattern character of the item
+        int32_t i = item.patternLimit - 1;
 
-            // Count the length of this field specifier
-            count = 1;
-            while ((i+1)<fPattern.length() &&
-                   fPattern.charAt(i+1) == ch) {
-                ++count;
-                ++i;
-            }
+        // Handle fields.
+        if (ch != 0) {
+            count = item.count;
 
-            if (isNumeric(ch, count)) {
-                if (abutPat < 0) {
+            if (item.numeric) {
+                if (abutItem < 0) {
                     // Determine if there is an abutting numeric field.
                     // Record the start of a set of abutting numeric fields.
-                    if (isAtNumericField(fPattern, i + 1)) {
-                        abutPat = fieldPat;
+                    if (item.abutsNumeric) {
+                        abutItem = itemIndex;
                         abutStart = pos;
                         abutPass = 0;
                     }
                 }
             } else {
-                abutPat = -1; // End of any abutting fields
+                abutItem = -1; // End of any abutting fields
             }
 
             // Handle fields within a run of abutting numeric fields.  Take
@@ -2344,12 +2729,12 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
             // others remain fixed.  This allows "123456" => 12:34:56, but
             // "12345" => 1:23:45.  Likewise, for the pattern "yyyyMMdd" we
             // try 4/2/2, 3/2/2, 2/2/2, and finally 1/2/2.
-            if (abutPat >= 0) {
+            if (abutItem >= 0) {
                 // If we are at the start of a run of abutting fields, then
                 // shorten this field in each pass.  If we can't shorten
                 // this field any more, then the parse of this set of
                 // abutting numeric fields has failed.
-                if (fieldPat == abutPat) {
+                if (itemIndex == abutItem) {
                     count -= abutPass++;
                     if (count == 0) {
                         status = U_PARSE_ERROR;
@@ -2363,7 +2748,7 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
                 // If the parse fails anywhere in the run, back up to the
                 // start of the run and retry.
                 if (pos < 0) {
-                    i = abutPat - 1;
+                    itemIndex = abutItem - 1;
                     pos = abutStart;
                     continue;
                 }
@@ -2380,20 +2765,13 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
                     // from the position where the era was expected
                     s = pos;
 
-                    if (i+1 < fPattern.length()) {
-                        // move to next pattern character
-                        char16_t c = fPattern.charAt(i+1);
-
-                        // check for whitespace
-                        if (PatternProps::isWhiteSpace(c)) {
-                            i++;
-                            // Advance over run in pattern
-                            while ((i+1)<fPattern.length() &&
-                                   PatternProps::isWhiteSpace(fPattern.charAt(i+1))) {
-                                ++i;
-                            }
-                        }
+                    // skip a run of whitespace in the pattern
+                    // that follows the field
+                    while ((i+1)<fPattern.length() &&
+                           PatternProps::isWhiteSpace(fPattern.charAt(i+1))) {
+                        ++i;
                     }
+                    literalPatternStart = i + 1;
                 }
                 else if (s <= 0) {
                     status = U_PARSE_ERROR;
@@ -2408,9 +2786,23 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
         // characters.
         else {
 
-            abutPat = -1; // End of any abutting fields
+            abutItem = -1; // End of any abutting fields
 
-            if (! matchLiterals(fPattern, i, text, pos, getBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, status), getBooleanAttribute(UDAT_PARSE_PARTIAL_LITERAL_MATCH, status), isLenient())) {
+            UBool matched;
+            if (literalPatternStart > item.patternStart) {
+                // Only match what is left after skipping whitespace.
+                if (literalPatternStart >= item.patternLimit) {
+                    literalPatternStart = -1;
+                    continue;
+                }
+                i = literalPatternStart;
+                matched = matchLiterals(fPattern, i, text, pos, getBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, status), getBooleanAttribute(UDAT_PARSE_PARTIAL_LITERAL_MATCH, status), isLenient());
+            } else {
+                UnicodeString literal(fCompiledPattern->literals, item.literalStart, item.count);
+                matched = matchLiterals(fPattern, item.patternStart, item.patternLimit, literal, text, pos, getBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, status), getBooleanAttribute(UDAT_PARSE_PARTIAL_LITERAL_MATCH, status), isLenient());
+            }
+            literalPatternStart = -1;
+            if (!matched) {
                 status = U_PARSE_ERROR;
                 goto ExitParse;
             }
@@ -2770,6 +3162,24 @@ UBool SimpleDateFormat::matchLiterals(const UnicodeString &pattern,
 
     // at this point, literal contains the literal text
     // and i is the index of the next non-literal pattern character.
+    if (!matchLiterals(pattern, patternOffset, i, literal, text, textOffset,
+                       whitespaceLenient, partialMatchLenient, oldLeniency)) {
+        return false;
+    }
+    patternOffset = i - 1;
+    return true;
+}
+
+UBool SimpleDateFormat::matchLiterals(const UnicodeString &pattern,
+                                      int32_t patternOffset,
+                                      int32_t patternLimit,
+                                      UnicodeString &literal,
+                                      const UnicodeString &text,
+                                      int32_t &textOffset,
+                                      UBool whitespaceLenient,
+                                      UBool partialMatchLenient,
+                                      UBool oldLeniency)
+{
     int32_t p;
     int32_t t = textOffset;
 
@@ -2858,7 +3268,7 @@ UBool SimpleDateFormat::matchLiterals(const UnicodeString &pattern,
         // no match. Pretend it matched a run of whitespace
         // and ignorables in the text.
         const  UnicodeSet *ignorables = nullptr;
-        UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(pattern.charAt(i));
+        UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(pattern.charAt(patternLimit));
         if (patternCharIndex != UDAT_FIELD_COUNT) {
             ignorables = SimpleDateFormatStaticSets::getIgnorables(patternCharIndex);
         }
@@ -2873,7 +3283,6 @@ UBool SimpleDateFormat::matchLiterals(const UnicodeString &pattern,
     }
 
     // if we get here, we've got a complete match.
-    patternOffset = i - 1;
     textOffset = t;
 
     return true;
@@ -3931,13 +4340,29 @@ void SimpleDateFormat::parseInt(const UnicodeString& text,
     const auto* fmtAsDF = dynamic_cast<const DecimalFormat*>(fmt);
     LocalPointer<DecimalFormat> df;
     if (!allowNegative && fmtAsDF != nullptr) {
-        df.adoptInstead(fmtAsDF->clone());
-        if (df.isNull()) {
-            // Memory allocation error
-            return;
+        // Keep the clone of fNumberFormat, which is used for every
+        // abutting numeric field without its own number format.
+        if (fmt == fNumberFormat) {
+            Mutex lock(&LOCK);
+            if (fNonNegativeNumberFormat == nullptr) {
+                DecimalFormat *nonNegative = fmtAsDF->clone();
+                if (nonNegative == nullptr) {
+                    // Memory allocation error
+                    return;
+                }
+                nonNegative->setNegativePrefix(UnicodeString(true, SUPPRESS_NEGATIVE_PREFIX, -1));
+                fNonNegativeNumberFormat = nonNegative;
+            }
+            fmt = fNonNegativeNumberFormat;
+        } else {
+            df.adoptInstead(fmtAsDF->clone());
+            if (df.isNull()) {
+                // Memory allocation error
+                return;
+            }
+            df->setNegativePrefix(UnicodeString(true, SUPPRESS_NEGATIVE_PREFIX, -1));
+            fmt = df.getAlias();
         }
-        df->setNegativePrefix(UnicodeString(true, SUPPRESS_NEGATIVE_PREFIX, -1));
-        fmt = df.getAlias();
     }
     int32_t oldPos = pos.getIndex();
     fmt->parse(text, number, pos);
@@ -4093,6 +4518,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4430,6 +4856,9 @@ void SimpleDateFormat::parsePattern() {
             }
         }
     }
+    UErrorCode status = U_ZERO_ERROR;
+    SharedObject::clearPtr(fCompiledPattern);
+    fCompiledPattern = getCompiledPattern(fPattern, status);
 }
 
 U_NAMESPACE_END
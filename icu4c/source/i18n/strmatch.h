@@ -215,6 +215,9 @@ class StringMatcher : public UnicodeFunctor, public UnicodeMatcher, public Unico
 
  private:
 
+    friend class TransliterationRuleBinary; // reads and writes the private data
+    friend class TransliterationRule; // for mayMatchEmpty()
+
     /**
      * The text to be matched.
      */
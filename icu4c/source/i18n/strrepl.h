@@ -38,6 +38,8 @@ class StringReplacer : public UnicodeFunctor, public UnicodeReplacer {
 
  private:
 
+    friend class TransliterationRuleBinary; // reads and writes the private data
+
     /**
      * Output text, possibly containing stand-in characters that
      * represent nested UnicodeReplacers.
@@ -49,6 +49,9 @@
 #include "hash.h"
 #include "mutex.h"
 #include "ucln_in.h"
+#include "umutex.h"
+#include "unifiedcache.h"
+#include "sharedobject.h"
 #include "uassert.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -102,8 +105,101 @@ static icu::TransliteratorRegistry* registry = nullptr;
 // MUTEX. Avoids function call when registry is initialized.
 #define HAVE_REGISTRY(status) (registry!=0 || initializeRegistry(status))
 
+/**
+ * Incremented whenever the registry changes.  Part of the key of every
+ * cached transliterator, so that entries built against an older registry
+ * are never handed out again.
+ */
+static icu::u_atomic_int32_t gRegistryGeneration {0};
+
+/**
+ * Statistics for the createInstance() cache.
+ */
+static icu::u_atomic_int32_t gCacheRequestCount {0};
+static icu::u_atomic_int32_t gCacheMissCount {0};
+
 U_NAMESPACE_BEGIN
 
+/**
+ * A fully instantiated transliterator held in the unified cache.
+ * The prototype is never handed out; createInstance() returns clones.
+ */
+class SharedTransliterator : public SharedObject {
+public:
+    SharedTransliterator(Transliterator *adopted) : ptr(adopted) {}
+    virtual ~SharedTransliterator();
+    const Transliterator *get() const { return ptr; }
+private:
+    Transliterator *ptr;
+    SharedTransliterator(const SharedTransliterator &) = delete;
+    SharedTransliterator &operator=(const SharedTransliterator &) = delete;
+};
+
+SharedTransliterator::~SharedTransliterator() {
+    delete ptr;
+}
+
+/**
+ * Cache key for createInstance(): the ID as given by the caller,
+ * the direction, and the registry generation.
+ */
+class TransliteratorCacheKey : public CacheKey<SharedTransliterator> {
+private:
+    UnicodeString fID;
+    UTransDirection fDir;
+    int32_t fGeneration;
+protected:
+    virtual bool equals(const CacheKeyBase &other) const override {
+        if (!CacheKey<SharedTransliterator>::equals(other)) {
+            return false;
+        }
+        // We know that this and other are of same class if we get this far.
+        const TransliteratorCacheKey &that = static_cast<const TransliteratorCacheKey &>(other);
+        return fDir == that.fDir && fGeneration == that.fGeneration && fID == that.fID;
+    }
+public:
+    TransliteratorCacheKey(const UnicodeString &id, UTransDirection dir, int32_t generation)
+            : fID(id), fDir(dir), fGeneration(generation) {}
+    TransliteratorCacheKey(const TransliteratorCacheKey &other)
+            : CacheKey<SharedTransliterator>(other),
+              fID(other.fID), fDir(other.fDir), fGeneration(other.fGeneration) {}
+    virtual ~TransliteratorCacheKey();
+    virtual int32_t hashCode() const override {
+        uint32_t hash = static_cast<uint32_t>(CacheKey<SharedTransliterator>::hashCode());
+        hash = 37u * hash + static_cast<uint32_t>(fID.hashCode());
+        hash = 37u * hash + static_cast<uint32_t>(fDir);
+        return static_cast<int32_t>(37u * hash + static_cast<uint32_t>(fGeneration));
+    }
+    virtual CacheKeyBase *clone() const override {
+        return new TransliteratorCacheKey(*this);
+    }
+    virtual const SharedTransliterator *createObject(
+            const void *creationContext, UErrorCode &status) const override {
+        umtx_atomic_inc(&gCacheMissCount);
+        // The context is the caller's UParseError.
+        UParseError *parseError = static_cast<UParseError *>(const_cast<void *>(creationContext));
+        LocalPointer<Transliterator> t(
+                Transliterator::createUncachedInstance(fID, fDir, *parseError, status), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        LocalPointer<SharedTransliterator> result(new SharedTransliterator(t.getAlias()), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        t.orphan();
+        result->addRef();
+        return result.orphan();
+    }
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const override {
+        int32_t length = fID.extract(0, fID.length(), buffer, bufLen - 1, US_INV);
+        buffer[length < bufLen ? length : bufLen - 1] = 0;
+        return buffer;
+    }
+};
+
+TransliteratorCacheKey::~TransliteratorCacheKey() {}
+
 UOBJECT_DEFINE_ABSTRACT_RTTI_IMPLEMENTATION(Transliterator)
 
 /**
@@ -459,6 +555,16 @@ void Transliterator::filteredTransliterate(Replaceable& text,
     // update globalLimit for insertions or deletions that have
     // happened.
     int32_t globalLimit = index.limit;
+
+    // Most filters are UnicodeSets without strings.  For those, and for
+    // text in a UnicodeString, find the runs by spanning the buffer
+    // instead of testing each character through the UnicodeFilter API.
+    const UnicodeSet* filterSet = dynamic_cast<const UnicodeSet*>(filter);
+    if (filterSet != nullptr && filterSet->hasStrings()) {
+        filterSet = nullptr;
+    }
+    const UnicodeString* textString =
+        filterSet != nullptr ? dynamic_cast<const UnicodeString*>(&text) : nullptr;
     
     // If there is a non-null filter, then break the input text up.  Say the
     // input text has the form:
@@ -476,18 +582,30 @@ void Transliterator::filteredTransliterate(Replaceable& text,
             // Narrow the range to be transliterated to the first segment
             // of unfiltered characters at or after index.start.
 
-            // Advance past filtered chars
-            UChar32 c;
-            while (index.start < globalLimit &&
-                   !filter->contains(c=text.char32At(index.start))) {
-                index.start += U16_LENGTH(c);
-            }
+            // The buffer may move when the text is modified, so get it
+            // for each run.
+            const char16_t* buffer =
+                textString != nullptr ? textString->getBuffer() : nullptr;
+            if (buffer != nullptr) {
+                index.start += filterSet->span(buffer + index.start, globalLimit - index.start,
+                                               USET_SPAN_NOT_CONTAINED);
+                index.limit = index.start +
+                    filterSet->span(buffer + index.start, globalLimit - index.start,
+                                    USET_SPAN_CONTAINED);
+            } else {
+                // Advance past filtered chars
+                UChar32 c;
+                while (index.start < globalLimit &&
+                       !filter->contains(c=text.char32At(index.start))) {
+                    index.start += U16_LENGTH(c);
+                }
 
-            // Find the end of this run of unfiltered chars
-            index.limit = index.start;
-            while (index.limit < globalLimit &&
-                   filter->contains(c=text.char32At(index.limit))) {
-                index.limit += U16_LENGTH(c);
+                // Find the end of this run of unfiltered chars
+                index.limit = index.start;
+                while (index.limit < globalLimit &&
+                       filter->contains(c=text.char32At(index.limit))) {
+                    index.limit += U16_LENGTH(c);
+                }
             }
         }
 
@@ -916,6 +1034,50 @@ Transliterator::createInstance(const UnicodeString& ID,
         return nullptr;
     }
 
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    umtx_atomic_inc(&gCacheRequestCount);
+    const SharedTransliterator *shared = nullptr;
+    cache->get(TransliteratorCacheKey(ID, dir, umtx_loadAcquire(gRegistryGeneration)),
+               &parseError, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    Transliterator *t = shared->get()->clone();
+    if (t == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        // Some clone() implementations reset the ID to the class default
+        // (e.g. NullTransliterator), so restore the one the prototype was given.
+        t->setID(shared->get()->getID());
+    }
+    shared->removeRef();
+    return t;
+}
+
+void U_EXPORT2
+Transliterator::getCacheStatistics(int32_t& hits, int32_t& misses) {
+    int32_t requests = umtx_loadAcquire(gCacheRequestCount);
+    misses = umtx_loadAcquire(gCacheMissCount);
+    hits = requests > misses ? requests - misses : 0;
+}
+
+/**
+ * Parse a compound ID and instantiate the transliterators it names,
+ * bypassing the cache.  Called by createInstance() on a cache miss.
+ */
+Transliterator*
+Transliterator::createUncachedInstance(const UnicodeString& ID,
+                                       UTransDirection dir,
+                                       UParseError& parseError,
+                                       UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+
     UnicodeString canonID;
     UVector list(status);
     if (U_FAILURE(status)) {
@@ -1237,6 +1399,7 @@ void U_EXPORT2 Transliterator::registerFactory(const UnicodeString& id,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerFactory(id, factory, context);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1276,6 +1439,7 @@ void U_EXPORT2 Transliterator::registerInstance(Transliterator* adoptedPrototype
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerInstance(adoptedPrototype);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1290,6 +1454,7 @@ void U_EXPORT2 Transliterator::registerAlias(const UnicodeString& aliasID,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerAlias(aliasID, realID);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1312,6 +1477,7 @@ void U_EXPORT2 Transliterator::unregister(const UnicodeString& ID) {
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         registry->remove(ID);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1565,7 +1731,19 @@ UBool Transliterator::initializeRegistry(UErrorCode &status) {
                                 (ures_getUnicodeStringByKey(res, "direction", &lstatus).charAt(0) ==
                                  0x0046 /*F*/) ?
                                 UTRANS_FORWARD : UTRANS_REVERSE;
-                            registry->put(id, UnicodeString(true, resString, len), dir, true, visible, lstatus);
+                            // Optional precompiled rules, written by genrb.
+                            // Like resString, they alias the resource data.
+                            UErrorCode compiledStatus = U_ZERO_ERROR;
+                            int32_t compiledLen = 0;
+                            UResourceBundle* compiledRes = ures_getByKey(res, "compiled", nullptr, &compiledStatus);
+                            const uint8_t* compiled = ures_getBinary(compiledRes, &compiledLen, &compiledStatus);
+                            ures_close(compiledRes);
+                            if (U_FAILURE(compiledStatus)) {
+                                compiled = nullptr;
+                                compiledLen = 0;
+                            }
+                            registry->put(id, UnicodeString(true, resString, len), dir,
+                                          compiled, compiledLen, true, visible, lstatus);
                         }
                         break;
                     case 0x61: // 'a'
@@ -1668,6 +1846,7 @@ U_CFUNC UBool utrans_transliterator_cleanup() {
         delete registry;
         registry = nullptr;
     }
+    umtx_atomic_inc(&gRegistryGeneration);
     return true;
 }
 
@@ -25,6 +25,7 @@
 #include "transreg.h"
 #include "rbt_data.h"
 #include "rbt_pars.h"
+#include "rbt_bin.h"
 #include "tridpars.h"
 #include "charstr.h"
 #include "uassert.h"
@@ -88,6 +89,8 @@ TransliteratorAlias::TransliteratorAlias(const UnicodeString& theAliasID,
     transes(nullptr),
     compoundFilter(cpdFilter),
     direction(UTRANS_FORWARD),
+    compiledRules(nullptr),
+    compiledRulesLength(0),
     type(TransliteratorAlias::SIMPLE) {
 }
 
@@ -100,17 +103,23 @@ TransliteratorAlias::TransliteratorAlias(const UnicodeString& theID,
     transes(adoptedTransliterators),
     compoundFilter(cpdFilter),
     direction(UTRANS_FORWARD),
+    compiledRules(nullptr),
+    compiledRulesLength(0),
     type(TransliteratorAlias::COMPOUND) {
 }
 
 TransliteratorAlias::TransliteratorAlias(const UnicodeString& theID,
                                          const UnicodeString& rules,
-                                         UTransDirection dir) :
+                                         UTransDirection dir,
+                                         const uint8_t* compiled,
+                                         int32_t compiledLength) :
     ID(theID),
     aliasesOrRules(rules),
     transes(nullptr),
     compoundFilter(nullptr),
     direction(dir),
+    compiledRules(compiled),
+    compiledRulesLength(compiledLength),
     type(TransliteratorAlias::RULES) {
 }
 
@@ -198,6 +207,16 @@ void TransliteratorAlias::parse(TransliteratorParser& parser,
         return;
     }
 
+    if (compiledRules != nullptr) {
+        UErrorCode readStatus = U_ZERO_ERROR;
+        TransliterationRuleBinary::read(compiledRules, compiledRulesLength,
+                                        direction, parser, readStatus);
+        if (U_SUCCESS(readStatus)) {
+            return;
+        }
+        // Unusable precompiled data (e.g., swapped to another
+        // endianness); fall back to parsing the rule text.
+    }
     parser.parse(aliasesOrRules, direction, pe, ec);
 }
 
@@ -456,6 +475,10 @@ class TransliteratorEntry : public UMemory {
         Transliterator* prototype; // For PROTOTYPE
         TransliterationRuleData* data; // For RBT_DATA
         UVector* dataVector;    // For COMPOUND_RBT
+        struct {
+            const uint8_t* bytes; // not owned
+            int32_t length;
+        } compiledRules; // For RULES_*, nullptr if none
         struct {
             Transliterator::Factory function;
             Transliterator::Token   context;
@@ -666,6 +689,8 @@ void TransliteratorRegistry::put(const UnicodeString& ID,
 void TransliteratorRegistry::put(const UnicodeString& ID,
                                  const UnicodeString& resourceName,
                                  UTransDirection dir,
+                                 const uint8_t* compiledRules,
+                                 int32_t compiledRulesLength,
                                  UBool readonlyResourceAlias,
                                  UBool visible,
                                  UErrorCode& ec) {
@@ -676,6 +701,8 @@ void TransliteratorRegistry::put(const UnicodeString& ID,
     }
     entry->entryType = (dir == UTRANS_FORWARD) ? TransliteratorEntry::RULES_FORWARD
         : TransliteratorEntry::RULES_REVERSE;
+    entry->u.compiledRules.bytes = compiledRules;
+    entry->u.compiledRules.length = compiledRulesLength;
     if (readonlyResourceAlias) {
         entry->stringArg.setTo(true, resourceName.getBuffer(), -1);
     }
@@ -1403,7 +1430,8 @@ Transliterator* TransliteratorRegistry::instantiateEntry(const UnicodeString& ID
                 // installed, we'll get an error from ResourceBundle.
                 aliasReturn = new TransliteratorAlias(ID, rules,
                     ((entry->entryType == TransliteratorEntry::RULES_REVERSE) ?
-                     UTRANS_REVERSE : UTRANS_FORWARD));
+                     UTRANS_REVERSE : UTRANS_FORWARD),
+                    entry->u.compiledRules.bytes, entry->u.compiledRules.length);
                 if (aliasReturn == nullptr) {
                     status = U_MEMORY_ALLOCATION_ERROR;
                 }
@@ -57,10 +57,15 @@ class TransliteratorAlias : public UMemory {
 
     /**
      * Construct a rules alias (type = RULES)
+     * @param compiledRules optional precompiled form of the rules
+     * (see TransliterationRuleBinary), or nullptr; not owned
+     * @param compiledRulesLength length of compiledRules in bytes
      */
     TransliteratorAlias(const UnicodeString& theID,
                         const UnicodeString& rules,
-                        UTransDirection dir);
+                        UTransDirection dir,
+                        const uint8_t* compiledRules = nullptr,
+                        int32_t compiledRulesLength = 0);
 
     ~TransliteratorAlias();
 
@@ -108,12 +113,15 @@ class TransliteratorAlias : public UMemory {
     //    compound filter, and it is _not_ owned.
     // 3. Rules
     //    Here ID is the ID, aliasID is the rules string.
-    //    idSplitPoint is the UTransDirection.
+    //    idSplitPoint is the UTransDirection.  compiledRules is the
+    //    precompiled form of the rules, if any, and it is _not_ owned.
     UnicodeString ID;
     UnicodeString aliasesOrRules;
     UVector* transes; // owned
     const UnicodeSet* compoundFilter; // alias
     UTransDirection direction;
+    const uint8_t* compiledRules; // alias
+    int32_t compiledRulesLength;
     enum { SIMPLE, COMPOUND, RULES } type;
 
     TransliteratorAlias(const TransliteratorAlias &other); // forbid copying of this class
@@ -222,10 +230,14 @@ class TransliteratorRegistry : public UMemory {
      * Register an ID and a resource name.  This adds an entry to the
      * dynamic store, or replaces an existing entry.  Any entry in the
      * underlying static locale resource store is masked.
+     * compiledRules, if not nullptr, is the precompiled form of the
+     * rules; it is not copied and must outlive the registry.
      */
     void put(const UnicodeString& ID,
              const UnicodeString& resourceName,
              UTransDirection dir,
+             const uint8_t* compiledRules,
+             int32_t compiledRulesLength,
              UBool readonlyResourceAlias,
              UBool visible,
              UErrorCode& ec);
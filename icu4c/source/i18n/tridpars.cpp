@@ -88,6 +88,7 @@ Transliterator* TransliteratorIDParser::SingleID::createInstance() {
             if (U_FAILURE(ec)) {
                 delete set;
             } else {
+                set->freeze();
                 t->adoptFilter(set);
             }
         }
@@ -299,6 +300,10 @@ UnicodeSet* TransliteratorIDParser::parseGlobalFilter(const UnicodeString& id, i
             return nullptr;
         }
 
+        // Filters are never modified; freezing them speeds up
+        // Transliterator::filteredTransliterate().
+        filter->freeze();
+
         // In the forward direction, append the pattern to the
         // canonID.  In the reverse, insert it at zero, and invert
         // the presence of parens ("A" <-> "(A)").
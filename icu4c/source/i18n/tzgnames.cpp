@@ -293,7 +293,9 @@ class TZGNCore : public UMemory {
     ZNStringPool fStringPool;
 
     TextTrieMap fGNamesTrie;
-    UBool fGNamesTrieFullyLoaded;
+    // Set once fGNamesTrie holds all names. After that the trie no longer
+    // changes, and findLocal() searches it without locking.
+    mutable u_atomic_int32_t fGNamesTrieFullyLoaded;
 
     FixedString fTargetRegion;
 
@@ -335,7 +337,7 @@ TZGNCore::TZGNCore(const Locale& locale, UErrorCode& status)
   fLocaleDisplayNames(nullptr),
   fStringPool(status),
   fGNamesTrie(true, deleteGNameInfo),
-  fGNamesTrieFullyLoaded(false),
+  fGNamesTrieFullyLoaded(0),
   fTargetRegion() {
     initialize(locale, status);
 }
@@ -572,8 +574,9 @@ TZGNCore::getGenericLocationName(const UnicodeString& tzCanonicalID) {
             if (U_FAILURE(status)) {
                 locname = nullptr;
             } else {
-                // put the name info into the trie
-                GNameInfo* nameinfo = static_cast<ZNameInfo*>(uprv_malloc(sizeof(GNameInfo)));
+                // put the name info into the trie, unless it is already complete
+                GNameInfo* nameinfo = umtx_loadAcquire(fGNamesTrieFullyLoaded) != 0 ? nullptr :
+                    static_cast<ZNameInfo*>(uprv_malloc(sizeof(GNameInfo)));
                 if (nameinfo != nullptr) {
                     nameinfo->type = UTZGNM_LOCATION;
                     nameinfo->tzID = cacheID;
@@ -821,8 +824,9 @@ TZGNCore::getPartialLocationName(const UnicodeString& tzCanonicalID,
             if (U_FAILURE(status)) {
                 uprv_free(cacheKey);
             } else {
-                // put the name to the local trie as well
-                GNameInfo* nameinfo = static_cast<ZNameInfo*>(uprv_malloc(sizeof(GNameInfo)));
+                // put the name to the local trie as well, unless it is already complete
+                GNameInfo* nameinfo = umtx_loadAcquire(fGNamesTrieFullyLoaded) != 0 ? nullptr :
+                    static_cast<ZNameInfo*>(uprv_malloc(sizeof(GNameInfo)));
                 if (nameinfo != nullptr) {
                     nameinfo->type = isLong ? UTZGNM_LONG : UTZGNM_SHORT;
                     nameinfo->tzID = key.tzID;
@@ -1004,11 +1008,17 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
 
     TZGNCore *nonConstThis = const_cast<TZGNCore *>(this);
 
-    umtx_lock(&gLock);
-    {
+    // Once the trie is complete, it is only read.
+    UBool fullyLoaded = umtx_loadAcquire(fGNamesTrieFullyLoaded) != 0;
+    if (fullyLoaded) {
         fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+    } else {
+        umtx_lock(&gLock);
+        {
+            fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        }
+        umtx_unlock(&gLock);
     }
-    umtx_unlock(&gLock);
 
     if (U_FAILURE(status)) {
         return nullptr;
@@ -1018,7 +1028,7 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
 
     int32_t maxLen = 0;
     UVector *results = handler.getMatches(maxLen);
-    if (results != nullptr && ((maxLen == (text.length() - start)) || fGNamesTrieFullyLoaded)) {
+    if (results != nullptr && ((maxLen == (text.length() - start)) || fullyLoaded)) {
         // perfect match
         gmatchInfo = new TimeZoneGenericNameMatchInfo(results);
         if (gmatchInfo == nullptr) {
@@ -1031,11 +1041,16 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
 
     delete results;
 
+    if (fullyLoaded) {
+        // No match in the complete trie.
+        return nullptr;
+    }
+
     // All names are not yet loaded into the local trie.
     // Load all available names into the trie. This could be very heavy.
     umtx_lock(&gLock);
     {
-        if (!fGNamesTrieFullyLoaded) {
+        if (umtx_loadAcquire(fGNamesTrieFullyLoaded) == 0) {
             StringEnumeration *tzIDs = TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_CANONICAL, nullptr, nullptr, status);
             if (U_SUCCESS(status)) {
                 const UnicodeString *tzID;
@@ -1047,10 +1062,15 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
                 }
             }
             delete tzIDs;
+        }
 
-            if (U_SUCCESS(status)) {
-                nonConstThis->fGNamesTrieFullyLoaded = true;
-            }
+        // now try it again
+        fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+
+        // The search also built the trie nodes, which have to be complete
+        // before other threads start searching the trie without the lock.
+        if (U_SUCCESS(status)) {
+            umtx_storeRelease(fGNamesTrieFullyLoaded, 1);
         }
     }
     umtx_unlock(&gLock);
@@ -1059,13 +1079,6 @@ TZGNCore::findLocal(const UnicodeString& text, int32_t start, uint32_t types, UE
         return nullptr;
     }
 
-    umtx_lock(&gLock);
-    {
-        // now try it again
-        fGNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
-    }
-    umtx_unlock(&gLock);
-
     results = handler.getMatches(maxLen);
     if (results != nullptr && maxLen > 0) {
         gmatchInfo = new TimeZoneGenericNameMatchInfo(results);
@@ -188,7 +188,7 @@ TextTrieMapSearchResultHandler::~TextTrieMapSearchResultHandler(){
 // ---------------------------------------------------
 TextTrieMap::TextTrieMap(UBool ignoreCase, UObjectDeleter *valueDeleter)
 : fIgnoreCase(ignoreCase), fNodes(nullptr), fNodesCapacity(0), fNodesCount(0), 
-  fLazyContents(nullptr), fIsEmpty(true), fValueDeleter(valueDeleter) {
+  fLazyContents(nullptr), fIsEmpty(true), fValueDeleter(valueDeleter), fTrieBuilt(1) {
 }
 
 TextTrieMap::~TextTrieMap() {
@@ -231,6 +231,7 @@ TextTrieMap::put(const UnicodeString &key, void *value, ZNStringPool &sp, UError
 void
 TextTrieMap::put(const char16_t *key, void *value, UErrorCode &status) {
     fIsEmpty = false;
+    umtx_storeRelease(fTrieBuilt, 0);
     if (fLazyContents == nullptr) {
         LocalPointer<UVector> lpLazyContents(new UVector(status), status);
         fLazyContents = lpLazyContents.orphan();
@@ -385,13 +386,7 @@ void TextTrieMap::buildTrie(UErrorCode &status) {
 void
 TextTrieMap::search(const UnicodeString &text, int32_t start,
                   TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
-    {
-        // TODO: if locking the mutex for each check proves to be a performance problem,
-        //       add a flag of type atomic_int32_t to class TextTrieMap, and use only
-        //       the ICU atomic safe functions for assigning and testing.
-        //       Don't test the pointer fLazyContents.
-        //       Don't do unless it's really required.
-
+    if (umtx_loadAcquire(fTrieBuilt) == 0) {
         // Mutex for protecting the lazy creation of the Trie node structure on the first call to search().
         static UMutex TextTrieMutex;
 
@@ -400,6 +395,9 @@ TextTrieMap::search(const UnicodeString &text, int32_t start,
             TextTrieMap *nonConstThis = const_cast<TextTrieMap *>(this);
             nonConstThis->buildTrie(status);
         }
+        if (U_SUCCESS(status)) {
+            umtx_storeRelease(fTrieBuilt, 1);
+        }
     }
     if (fNodes == nullptr) {
         return;
@@ -1027,7 +1025,7 @@ TimeZoneNamesImpl::TimeZoneNamesImpl(const Locale& locale, UErrorCode& status)
   fZoneStrings(nullptr),
   fTZNamesMap(nullptr),
   fMZNamesMap(nullptr),
-  fNamesTrieFullyLoaded(false),
+  fNamesTrieFullyLoaded(0),
   fNamesFullyLoaded(false),
   fNamesTrie(true, deleteZNameInfo) {
     initialize(locale, status);
@@ -1372,8 +1370,12 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
     TimeZoneNames::MatchInfoCollection* matches;
     TimeZoneNamesImpl* nonConstThis = const_cast<TimeZoneNamesImpl*>(this);
 
+    if (umtx_loadAcquire(fNamesTrieFullyLoaded) != 0) {
+        // The trie has all names and no longer changes.
+        return doFind(handler, text, start, status);
+    }
+
     // Synchronize so that data is not loaded multiple times.
-    // TODO: Consider more fine-grained synchronization.
     {
         Mutex lock(&gDataMutex);
 
@@ -1401,11 +1403,16 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
         // Load everything now.
         nonConstThis->internalLoadAllDisplayNames(status);
         nonConstThis->addAllNamesIntoTrie(status);
-        nonConstThis->fNamesTrieFullyLoaded = true;
         if (U_FAILURE(status)) { return nullptr; }
 
         // Third try: we must return this one.
-        return doFind(handler, text, start, status);
+        // The search also builds the trie nodes, which have to be complete
+        // before other threads start searching the trie without the lock.
+        fNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+        if (U_FAILURE(status)) { return nullptr; }
+        umtx_storeRelease(fNamesTrieFullyLoaded, 1);
+        int32_t maxLen = 0;
+        return handler.getMatches(maxLen);
     }
 }
 
@@ -1418,7 +1425,7 @@ TimeZoneNamesImpl::doFind(ZNameSearchHandler& handler,
 
     int32_t maxLen = 0;
     TimeZoneNames::MatchInfoCollection* matches = handler.getMatches(maxLen);
-    if (matches != nullptr && ((maxLen == (text.length() - start)) || fNamesTrieFullyLoaded)) {
+    if (matches != nullptr && ((maxLen == (text.length() - start)) || umtx_loadAcquire(fNamesTrieFullyLoaded) != 0)) {
         // perfect match, or no more names available
         return matches;
     }
@@ -130,6 +130,12 @@ class TextTrieMapSearchResultHandler : public UMemory {
 /**
  * TextTrieMap is a trie implementation for supporting
  * fast prefix match for the string key.
+ *
+ * search() may be called from several threads at once. It builds the node
+ * structure from the put() contents the first time it is needed, and after
+ * that reads it without locking. put() invalidates the node structure and
+ * must not run concurrently with search() or put(); callers that keep
+ * calling put() synchronize both themselves.
  */
 class U_I18N_API TextTrieMap : public UMemory {
 public:
@@ -151,6 +157,8 @@ class U_I18N_API TextTrieMap : public UMemory {
     UVector         *fLazyContents;
     UBool           fIsEmpty;
     UObjectDeleter  *fValueDeleter;
+    // 1 when fNodes has all of the put() contents; put() resets it to 0.
+    mutable u_atomic_int32_t fTrieBuilt;
 
     UBool growNodes();
     CharacterNode* addChildNode(CharacterNode *parent, char16_t c, UErrorCode &status);
@@ -209,7 +217,9 @@ class TimeZoneNamesImpl : public TimeZoneNames {
     UHashtable* fTZNamesMap;
     UHashtable* fMZNamesMap;
 
-    UBool fNamesTrieFullyLoaded;
+    // Set once fNamesTrie holds all names. After that the trie no longer
+    // changes, and find() searches it without locking.
+    mutable u_atomic_int32_t fNamesTrieFullyLoaded;
     UBool fNamesFullyLoaded;
     TextTrieMap fNamesTrie;
 
@@ -501,6 +501,19 @@ ucal_get(    const    UCalendar*                cal,
     return ((Calendar*)cal)->get(field, *status);
 }
 
+U_CAPI void U_EXPORT2
+ucal_computeFieldsBatch(const UCalendar*           cal,
+                        const UDate*               dates,
+                        int32_t                    count,
+                        const UCalendarDateFields* fields,
+                        int32_t                    fieldCount,
+                        int32_t* const*            results,
+                        UErrorCode*                status) {
+    if(U_FAILURE(*status)) return;
+
+    ((const Calendar*)cal)->computeFieldsBatch(dates, count, fields, fieldCount, results, *status);
+}
+
 U_CAPI void  U_EXPORT2
 ucal_set(    UCalendar*                cal,
          UCalendarDateFields        field,
@@ -34,10 +34,7 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_TRANSLITERATOR,
     UCLN_I18N_REGEX,
     UCLN_I18N_JAPANESE_CALENDAR,
-    UCLN_I18N_ISLAMIC_CALENDAR,
     UCLN_I18N_CHINESE_CALENDAR,
-    UCLN_I18N_HEBREW_CALENDAR,
-    UCLN_I18N_ASTRO_CALENDAR,
     UCLN_I18N_DANGI_CALENDAR,
     UCLN_I18N_PERSIAN_CALENDAR,
     UCLN_I18N_CALENDAR,
@@ -47,6 +44,7 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_TIMEZONENAMES,
     UCLN_I18N_ZONEMETA,
     UCLN_I18N_TIMEZONE,
+    UCLN_I18N_OLSONTZ,
     UCLN_I18N_DIGITLIST,
     UCLN_I18N_DECFMT,
     UCLN_I18N_NUMFMT,
@@ -26,6 +26,8 @@
 #include "unicode/udisplaycontext.h"
 #include "unicode/ufieldpositer.h"
 #include "cpputils.h"
+#include "cmemory.h"
+#include "ustr_imp.h"
 #include "reldtfmt.h"
 #include "umutex.h"
 
@@ -350,6 +352,95 @@ udat_formatCalendarForFields(const UDateFormat*  format,
     return res.extract(result, resultLength, *status);
 }
 
+U_CAPI int32_t U_EXPORT2
+udat_formatBatch(const UDateFormat* format,
+        const UDate*    dates,
+        int32_t         count,
+        char16_t*       result,
+        int32_t         resultLength,
+        int32_t*        offsets,
+        UErrorCode*     status)
+{
+    if(U_FAILURE(*status)) {
+        return -1;
+    }
+    if (result == nullptr ? resultLength != 0 : resultLength < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+
+    UnicodeString res;
+    if (result != nullptr) {
+        // nullptr destination for pure preflighting: empty dummy string
+        // otherwise, alias the destination buffer
+        res.setTo(result, 0, resultLength);
+    }
+
+    ((const DateFormat*)format)->formatBatch(dates, count, res, offsets, *status);
+    if (U_FAILURE(*status)) {
+        return -1;
+    }
+
+    return res.extract(result, resultLength, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+udat_formatBatchUTF8(const UDateFormat* format,
+        const UDate*    dates,
+        int32_t         count,
+        char*           result,
+        int32_t         resultLength,
+        int32_t*        offsets,
+        UErrorCode*     status)
+{
+    if(U_FAILURE(*status)) {
+        return -1;
+    }
+    if (result == nullptr ? resultLength != 0 : resultLength < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+    if (count < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+
+    UnicodeString res;
+    MaybeStackArray<int32_t, 64> offsets16;
+    if (count >= offsets16.getCapacity() && offsets16.resize(count + 1) == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return -1;
+    }
+    ((const DateFormat*)format)->formatBatch(dates, count, res, offsets16.getAlias(), *status);
+    if (U_FAILURE(*status)) {
+        return -1;
+    }
+
+    // Convert each string separately, for its offset in bytes.
+    const char16_t* s = res.getBuffer();
+    int32_t length8 = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        if (offsets != nullptr) {
+            offsets[i] = length8;
+        }
+        int32_t capacity = length8 < resultLength ? resultLength - length8 : 0;
+        int32_t stringLength8 = 0;
+        UErrorCode stringStatus = U_ZERO_ERROR;
+        u_strToUTF8WithSub(capacity > 0 ? result + length8 : nullptr, capacity, &stringLength8,
+                           s + offsets16[i], offsets16[i + 1] - offsets16[i],
+                           0xfffd, nullptr, &stringStatus);
+        if (U_FAILURE(stringStatus) && stringStatus != U_BUFFER_OVERFLOW_ERROR) {
+            *status = stringStatus;
+            return -1;
+        }
+        length8 += stringLength8;
+    }
+    if (offsets != nullptr) {
+        offsets[count] = length8;
+    }
+    return u_terminateChars(result, resultLength, length8, status);
+}
+
 U_CAPI UDate U_EXPORT2
 udat_parse(    const    UDateFormat*        format,
         const    char16_t*          text,
@@ -1173,6 +1173,35 @@ class U_I18N_API_CLASS Calendar : public UObject {
      */
     U_I18N_API int32_t get(UCalendarDateFields field, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Computes the given fields for each of many dates, with the same results as
+     * setTime() followed by get() for each date and field, but without changing this
+     * Calendar. This is intended for bulk data such as time series. The results are
+     * written as one array per field.
+     *
+     * For a GregorianCalendar the fields of dates after the year of the Gregorian
+     * change are computed directly, with the time zone offsets of one date reused for
+     * the following dates until the next time zone transition; dates in ascending order
+     * convert fastest. The week-of-year fields and other calendars go through setTime()
+     * and get() on a copy of this Calendar.
+     *
+     * @param dates       The dates, in milliseconds since 1970-01-01T00:00:00Z.
+     * @param count       The number of dates.
+     * @param fields      The fields to compute.
+     * @param fieldCount  The number of fields.
+     * @param results     fieldCount arrays of count values each: results[j][i] receives
+     *                    the value of fields[j] for dates[i].
+     * @param status      Set to U_ILLEGAL_ARGUMENT_ERROR for invalid arguments, or to the
+     *                    error that setTime() or get() returns for one of the dates, in
+     *                    which case the results are undefined.
+     * @draft ICU 79
+     */
+    U_I18N_API void computeFieldsBatch(const UDate* dates, int32_t count,
+                                       const UCalendarDateFields* fields, int32_t fieldCount,
+                                       int32_t* const* results, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Determines if the given time field has a value set. This can affect in the
      * resolving of time in Calendar. Unset fields have a value of zero, by definition.
@@ -386,6 +386,31 @@ class U_I18N_API_CLASS DateFormat : public Format {
      */
     U_I18N_API UnicodeString& format(UDate date, UnicodeString& appendTo) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats an array of UDates into consecutive date/time strings in one
+     * UnicodeString, for example for exporting a column of timestamps.
+     * The strings are the same as from format(dates[i], appendTo), but the
+     * calendar is set up only once for all dates, and dates on the same day
+     * as the previous one reuse its date fields where possible.
+     *
+     * @param dates     The UDate values to be formatted.
+     * @param count     The number of dates.
+     * @param appendTo  Output parameter to receive the result.
+     *                  Result is appended to existing contents.
+     * @param offsets   If not nullptr, an array of count+1 integers that
+     *                  receives the index in appendTo at which the string for
+     *                  each date starts; offsets[count] receives the final
+     *                  length of appendTo.
+     * @param status    error status.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 79
+     */
+    U_I18N_API UnicodeString& formatBatch(const UDate* dates, int32_t count,
+                                          UnicodeString& appendTo, int32_t* offsets,
+                                          UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Parse a date/time string. For example, a time text "07/10/96 4:5 PM, PDT"
      * will be parsed into a UDate that is equivalent to Date(837039928046).
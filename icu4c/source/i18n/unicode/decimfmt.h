@@ -1154,6 +1154,28 @@ class U_I18N_API DecimalFormat : public NumberFormat {
      */
     CurrencyAmount* parseCurrency(const UnicodeString& text, ParsePosition& pos) const override;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Parses each of the given strings from its start, as parse() does, and stores the results
+     * as doubles. This is intended for bulk data such as a column of numbers: strings consisting
+     * of an optional sign, digits with grouping separators, and an optional decimal separator
+     * and fraction digits are recognized without going through the general parser.
+     *
+     * @param texts      The strings to parse.
+     * @param count      The number of strings.
+     * @param results    Receives count doubles. The result for a string that cannot be parsed
+     *                   is 0.
+     * @param parseEnds  If not nullptr, receives for each string the index after the last
+     *                   parsed character, or -1 if the string cannot be parsed.
+     * @param status     Set to an error code for invalid arguments or internal failures; strings
+     *                   that cannot be parsed do not set an error.
+     * @return The number of strings that were parsed successfully.
+     * @draft ICU 79
+     */
+    int32_t parseBatch(const UnicodeString* texts, int32_t count, double* results,
+                       int32_t* parseEnds, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Returns the decimal format symbols, which is generally not changed
      * by the programmer or user.
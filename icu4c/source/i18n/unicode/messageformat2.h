@@ -36,6 +36,7 @@ namespace message2 {
     class StaticErrors;
     class InternalValue;
     class BaseValue;
+    class VariantTable;
 
     /**
      * <p>MessageFormatter is a Technical Preview API implementing MessageFormat 2.0.
@@ -494,15 +495,11 @@ namespace message2 {
 
         // Takes a vector of FormattedPlaceholders
         void resolveSelectors(MessageContext&, Environment& env, UErrorCode&, UVector&) const;
-        // Takes a vector of vectors of strings (input) and a vector of PrioritizedVariants (output)
-        void filterVariants(const UVector&, UVector&, UErrorCode&) const;
-        // Takes a vector of vectors of strings (input) and a vector of PrioritizedVariants (input/output)
-        void sortVariants(const UVector&, UVector&, UErrorCode&) const;
-        // Takes a vector of strings (input) and a vector of strings (output)
-        void matchSelectorKeys(const UVector&, MessageContext&, InternalValue&& rv, UVector&, UErrorCode&) const;
-        // Takes a vector of FormattedPlaceholders (input),
-        // and a vector of vectors of strings (output)
-        void resolvePreferences(MessageContext&, UVector&, UVector&, UErrorCode&) const;
+        // Takes an array of keys (input) and an array of indices into the keys (output)
+        void matchSelectorKeys(const UnicodeString*, int32_t, MessageContext&, InternalValue&& rv,
+                               int32_t*, int32_t&, UErrorCode&) const;
+        // Numbers the variant keys of the data model; called by the constructor
+        void buildVariantTable(UErrorCode&);
 
         bool checkSelectOption(const FunctionValue&) const;
 
@@ -580,6 +577,11 @@ namespace message2 {
         // Owned by `this`
         StaticErrors* errors = nullptr;
 
+        // Variant keys of the data model, prepared for pattern selection;
+        // null if the message has no selectors
+        // Owned by `this`
+        VariantTable* variantTable = nullptr;
+
         // Error handling behavior.
         // If true, then formatting methods set their UErrorCode arguments
         // to signal MessageFormat errors, and no useful output is returned.
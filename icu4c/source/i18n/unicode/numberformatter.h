@@ -2562,6 +2562,55 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatDecimal(StringPiece value, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Format the given integer number to a UTF-8 string in a caller-provided buffer, using the settings
+     * specified in the NumberFormatter fluent setting chain.
+     *
+     * This produces the same string as formatInt(value, status).toString(status), converted to UTF-8,
+     * without creating a FormattedNumber. It is intended for code that writes many numbers into
+     * byte-oriented output, such as JSON or CSV emitters.
+     *
+     * The result is NUL-terminated if there is room for the NUL.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The buffer for the UTF-8 result. Can be nullptr if capacity is 0, for preflighting.
+     * @param capacity
+     *            The size of the buffer in bytes.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     *            Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit into the buffer.
+     * @return The length of the UTF-8 result in bytes, not counting the terminating NUL.
+     * @draft ICU 79
+     */
+    int32_t formatIntInto(int64_t value, char* dest, int32_t capacity, UErrorCode& status) const;
+
+    /**
+     * Format the given float or double to a UTF-8 string in a caller-provided buffer, using the
+     * settings specified in the NumberFormatter fluent setting chain.
+     *
+     * This produces the same string as formatDouble(value, status).toString(status), converted to UTF-8,
+     * without creating a FormattedNumber.
+     *
+     * The result is NUL-terminated if there is room for the NUL.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The buffer for the UTF-8 result. Can be nullptr if capacity is 0, for preflighting.
+     * @param capacity
+     *            The size of the buffer in bytes.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     *            Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit into the buffer.
+     * @return The length of the UTF-8 result in bytes, not counting the terminating NUL.
+     * @draft ICU 79
+     */
+    int32_t formatDoubleInto(double value, char* dest, int32_t capacity, UErrorCode& status) const;
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_INTERNAL_API
 
             
@@ -2712,6 +2761,9 @@ class U_I18N_API LocalizedNumberFormatter
      */
     bool computeCompiled(UErrorCode& status) const;
 
+    int32_t formatIntoImpl(impl::UFormattedNumberData& results, bool compiled, char* dest,
+                           int32_t capacity, UErrorCode& status) const;
+
     // To give the fluent setters access to this class's constructor:
     friend class NumberFormatterSettings<UnlocalizedNumberFormatter>;
     friend class NumberFormatterSettings<LocalizedNumberFormatter>;
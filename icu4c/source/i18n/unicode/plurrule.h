@@ -42,12 +42,15 @@
  */
 #define UPLRULES_NO_UNIQUE_VALUE ((double)-0.00123456777)
 
+class PluralRulesTest;
+
 U_NAMESPACE_BEGIN
 
 class Hashtable;
 class IFixedDecimal;
 class FixedDecimal;
 class RuleChain;
+class PluralRulesProgram;
 class PluralRuleParser;
 class PluralKeywordEnumeration;
 class AndConstraint;
@@ -566,6 +569,7 @@ class U_I18N_API PluralRules : public UObject {
 private:
     RuleChain  *mRules;
     StandardPluralRanges *mStandardPluralRanges;
+    const PluralRulesProgram *mProgram;  // mRules compiled for select(); shared with clones.
 
     PluralRules() = delete;   // default constructor not implemented
     UnicodeString   getRuleFromResource(const Locale& locale, UPluralType type, UErrorCode& status);
@@ -579,6 +583,7 @@ class U_I18N_API PluralRules : public UObject {
     UErrorCode mInternalStatus;
 
     friend class PluralRuleParser;
+    friend class ::PluralRulesTest;
 };
 
 U_NAMESPACE_END
@@ -52,6 +52,7 @@ class TimeZoneFormat;
 class SharedNumberFormat;
 class SimpleDateFormatMutableNFs;
 class DateIntervalFormat;
+class CompiledDatePattern;
 
 namespace number {
 class LocalizedNumberFormatter;
@@ -875,6 +876,7 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
 private:
     friend class DateFormat;
     friend class DateIntervalFormat;
+    friend class CompiledDatePatternKey;
 
     void initializeDefaultCentury();
 
@@ -933,6 +935,45 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
                    Calendar& cal,
                    UErrorCode& status) const; // in case of illegal argument
 
+    /**
+     * The Gregorian date fields of the day that fastFormat() computed last,
+     * which DateFormat::formatBatch() keeps for the following dates.
+     */
+    struct FastFormatDay {
+        UBool valid = false;
+        int32_t day = 0;
+        int32_t year = 0;
+        int8_t month = 0;
+        int8_t dayOfMonth = 0;
+        int16_t dayOfYear = 0;
+    };
+
+    /**
+     * Formats a date without going through a Calendar, if the pattern
+     * consists of numeric fields only, the calendar is Gregorian and
+     * the date is after its Gregorian change, and the digits are those
+     * of fSimpleNumberFormatter.
+     * @param lastDay if not nullptr, reused if the date is on the same day,
+     *        and updated otherwise
+     * @return false, without changing appendTo, if the date cannot be
+     *         formatted this way
+     */
+    UBool fastFormat(UDate date, UnicodeString& appendTo,
+                     FieldPositionHandler& handler,
+                     FastFormatDay* lastDay = nullptr) const;
+
+    /**
+     * Compiles the pattern into the literal text and fields used by
+     * _format(), fastFormat() and parse().
+     */
+    static CompiledDatePattern* compilePattern(const UnicodeString& pattern, UErrorCode& status);
+
+    /**
+     * Returns the compiled pattern from the cache.  The caller needs to
+     * remove the reference.
+     */
+    static const CompiledDatePattern* getCompiledPattern(const UnicodeString& pattern, UErrorCode& status);
+
     /**
      * Used by subFormat() to format a numeric value.
      * Appends to toAppendTo a string representation of "value"
@@ -1070,6 +1111,18 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
                                const UnicodeString &text, int32_t &textOffset,
                                UBool whitespaceLenient, UBool partialMatchLenient, UBool oldLeniency);
 
+    /**
+     * Matches the literal pattern text that has already been extracted
+     * from pattern[patternOffset..patternLimit[.
+     *
+     * @param literal the unquoted literal text; may be modified
+     * @see matchLiterals
+     */
+    static UBool matchLiterals(const UnicodeString &pattern, int32_t patternOffset,
+                               int32_t patternLimit, UnicodeString &literal,
+                               const UnicodeString &text, int32_t &textOffset,
+                               UBool whitespaceLenient, UBool partialMatchLenient, UBool oldLeniency);
+
     /**
      * Private member function that converts the parsed date strings into
      * timeFields. Returns -start (for ParsePosition) if failed.
@@ -1270,7 +1323,7 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
     UBool                fHasHanYearChar; // pattern contains the Han year character \u5E74
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * Sets fHasMinutes, fHasSeconds, fHasHanYearChar and fCompiledPattern.
      */
     void                 parsePattern();
 
@@ -1304,6 +1357,25 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
      */
     const number::SimpleNumberFormatter* fSimpleNumberFormatter = nullptr;
 
+    /**
+     * The zero digit of fSimpleNumberFormatter if its digits are contiguous
+     * BMP characters, otherwise 0.  Used by fastFormat().
+     */
+    char16_t fFastZeroDigit = 0;
+
+    /**
+     * A clone of fNumberFormat that does not parse negative numbers,
+     * created by parseInt() for abutting numeric fields (owned).
+     * Guarded by a mutex, and reset by initSimpleNumberFormatter().
+     */
+    mutable NumberFormat* fNonNegativeNumberFormat = nullptr;
+
+    /**
+     * fPattern compiled by parsePattern(), shared with other formatters
+     * (reference counted).  nullptr only if out of memory.
+     */
+    const CompiledDatePattern* fCompiledPattern = nullptr;
+
     UBool fHaveDefaultCentury;
 
     const BreakIterator* fCapitalizationBrkIter = nullptr;
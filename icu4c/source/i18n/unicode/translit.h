@@ -598,7 +598,18 @@ class U_I18N_API Transliterator : public UObject {
     static Transliterator* createBasicInstance(const UnicodeString& id,
                                                const UnicodeString* canon);
 
+    /**
+     * Implements createInstance() without consulting the cache of
+     * instantiated transliterators.
+     * @internal
+     */
+    static Transliterator* createUncachedInstance(const UnicodeString& ID,
+                                                  UTransDirection dir,
+                                                  UParseError& parseError,
+                                                  UErrorCode& status);
+
     friend class TransliteratorParser; // for parseID()
+    friend class TransliteratorCacheKey; // for createUncachedInstance()
     friend class TransliteratorIDParser; // for createBasicInstance()
     friend class TransliteratorAlias; // for setID()
 
@@ -1089,6 +1100,23 @@ class U_I18N_API Transliterator : public UObject {
                                           UTransDirection dir,
                                           UErrorCode& status);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Returns statistics for the cache behind createInstance().
+     * Transliterators are cached per ID, direction and registry state;
+     * a hit returns a clone of the cached instance, a miss parses the ID
+     * and builds the transliterator chain.  Any change to the registry
+     * (register*(), unregister()) starts a fresh set of cache entries.
+     *
+     * @param hits   receives the number of createInstance() calls served
+     *               from the cache
+     * @param misses receives the number of createInstance() calls that
+     *               had to build a new transliterator
+     * @internal
+     */
+    static void U_EXPORT2 getCacheStatistics(int32_t& hits, int32_t& misses);
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Returns a <code>Transliterator</code> object constructed from
      * the given rule string.  This will be a rule-based Transliterator,
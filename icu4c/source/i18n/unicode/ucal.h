@@ -1234,6 +1234,35 @@ ucal_get(const UCalendar*     cal,
          UCalendarDateFields  field,
          UErrorCode*          status );
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Compute the values of fields of a UCalendar for each of many dates, with
+ * the same results as ucal_setMillis followed by ucal_get for each date and
+ * field, but without changing the UCalendar. This is intended for bulk data
+ * such as time series. For a Gregorian UCalendar, dates in ascending order
+ * convert fastest.
+ * @param cal The UCalendar to use.
+ * @param dates The dates, in milliseconds since 1970-01-01T00:00:00Z.
+ * @param count The number of dates.
+ * @param fields The fields to compute.
+ * @param fieldCount The number of fields.
+ * @param results fieldCount arrays of count values each: results[j][i]
+ * receives the value of fields[j] for dates[i].
+ * @param status A pointer to an UErrorCode to receive any errors; on error
+ * the results are undefined.
+ * @see ucal_get
+ * @draft ICU 79
+ */
+U_CAPI void U_EXPORT2
+ucal_computeFieldsBatch(const UCalendar*           cal,
+                        const UDate*               dates,
+                        int32_t                    count,
+                        const UCalendarDateFields* fields,
+                        int32_t                    fieldCount,
+                        int32_t* const*            results,
+                        UErrorCode*                status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Set the value of a field in a UCalendar.
  * All fields are represented as 32-bit integers.
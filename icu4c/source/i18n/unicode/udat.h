@@ -1166,6 +1166,81 @@ udat_formatCalendarForFields( const UDateFormat* format,
                         UFieldPositionIterator* fpositer,
                         UErrorCode*     status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Format an array of dates into consecutive strings in one buffer, for
+* example for exporting a column of timestamps. Each string is the same
+* as from {@link #udat_format}, but the calendar is set up only once for
+* all dates, and dates on the same day as the previous one reuse its date
+* fields where possible.
+* @param format
+*          The formatter to use
+* @param dates
+*          The dates to format
+* @param count
+*          The number of dates
+* @param result
+*          A pointer to a buffer to receive the formatted strings.
+* @param resultLength
+*          The maximum size of result.
+* @param offsets
+*          If not NULL, an array of count+1 integers that receives the offset
+*          in result at which the string for each date starts; offsets[count]
+*          receives the total length. The offsets are set even if the buffer
+*          is too small.
+* @param status
+*          A pointer to a UErrorCode to receive any errors
+* @return
+*          The total buffer size needed; if greater than resultLength, the output was truncated.
+* @see udat_format
+* @see udat_formatBatchUTF8
+* @draft ICU 79
+*/
+U_CAPI int32_t U_EXPORT2
+udat_formatBatch(const UDateFormat* format,
+                 const UDate*       dates,
+                 int32_t            count,
+                 UChar*             result,
+                 int32_t            resultLength,
+                 int32_t*           offsets,
+                 UErrorCode*        status);
+
+/**
+* Format an array of dates into consecutive UTF-8 strings in one buffer,
+* like {@link #udat_formatBatch}.
+* @param format
+*          The formatter to use
+* @param dates
+*          The dates to format
+* @param count
+*          The number of dates
+* @param result
+*          A pointer to a buffer to receive the formatted UTF-8 strings.
+* @param resultLength
+*          The maximum size of result in bytes.
+* @param offsets
+*          If not NULL, an array of count+1 integers that receives the byte
+*          offset in result at which the string for each date starts;
+*          offsets[count] receives the total length. The offsets are set
+*          even if the buffer is too small.
+* @param status
+*          A pointer to a UErrorCode to receive any errors
+* @return
+*          The total buffer size needed in bytes; if greater than resultLength,
+*          the output was truncated.
+* @see udat_formatBatch
+* @draft ICU 79
+*/
+U_CAPI int32_t U_EXPORT2
+udat_formatBatchUTF8(const UDateFormat* format,
+                     const UDate*       dates,
+                     int32_t            count,
+                     char*              result,
+                     int32_t            resultLength,
+                     int32_t*           offsets,
+                     UErrorCode*        status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
 * Parse a string into an date/time using a UDateFormat.
@@ -804,6 +804,39 @@ unum_parseDouble(    const   UNumberFormat*  fmt,
             int32_t         *parsePos /* 0 = start */,
             UErrorCode      *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Parse an array of strings into doubles using a UNumberFormat, as if
+* unum_parseDouble were called on each of them starting at offset 0.
+* This is intended for bulk data such as a column of numbers; with a decimal
+* UNumberFormat, strings consisting of an optional sign, digits with grouping
+* separators, and an optional decimal separator and fraction digits are
+* recognized without going through the general parser.
+* @param fmt The formatter to use.
+* @param texts The strings to parse.
+* @param textLengths The lengths of the strings; an element of -1, or a NULL
+* array, means that the string is null-terminated.
+* @param count The number of strings.
+* @param results Receives count doubles. The result for a string that cannot
+* be parsed is 0.
+* @param parseEnds If not NULL, receives for each string the offset at which
+* parsing ended, or -1 if the string cannot be parsed.
+* @param status A pointer to an UErrorCode to receive any errors. Strings that
+* cannot be parsed do not set an error.
+* @return The number of strings that were parsed successfully.
+* @see unum_parseDouble
+* @draft ICU 79
+*/
+U_CAPI int32_t U_EXPORT2
+unum_parseDoubleBatch(const UNumberFormat*  fmt,
+                      const UChar* const*   texts,
+                      const int32_t*        textLengths,
+                      int32_t               count,
+                      double*               results,
+                      int32_t*              parseEnds,
+                      UErrorCode*           status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
 * Parse a number from a string into an unformatted numeric string using a UNumberFormat.
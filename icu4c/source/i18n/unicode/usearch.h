@@ -580,6 +580,63 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
 U_CAPI const UChar * U_EXPORT2 usearch_getText(const UStringSearch *strsrch, 
                                                int32_t       *length);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Set UTF-8 text to be searched. Text iteration will hence begin at the
+* start of the text string.
+*
+* The text is converted once to UTF-16, into a buffer owned by the
+* UStringSearch; ill-formed UTF-8 sequences are replaced by U+FFFD.
+* All other functions keep working with UTF-16 indexes into the converted
+* text, which is returned by <code>usearch_getText</code>. Use
+* <code>usearch_getMatchedStartUTF8</code> and
+* <code>usearch_getMatchedLengthUTF8</code> to get the current match as
+* byte offsets into the UTF-8 text.
+*
+* The UStringSearch retains a pointer to the UTF-8 text string. The caller
+* must not modify or delete the string while using the UStringSearch.
+*
+* @param strsrch search iterator data struct
+* @param text new UTF-8 string to look for match
+* @param textlength length of the new string in bytes, -1 for null-termination
+* @param status for errors if it occurs. If text is NULL, or textlength is 0
+*               then an U_ILLEGAL_ARGUMENT_ERROR is returned with no change
+*               done to strsrch.
+* @see #usearch_setText
+* @draft ICU 79
+*/
+U_CAPI void U_EXPORT2 usearch_setUTF8Text(      UStringSearch *strsrch,
+                                          const char          *text,
+                                                int32_t        textlength,
+                                                UErrorCode    *status);
+
+/**
+* Returns the byte offset in the UTF-8 text of the current match, like
+* <code>usearch_getMatchedStart</code>.
+* @param strsrch search iterator data struct
+* @return The UTF-8 offset of the current match, or
+*         <code>USEARCH_DONE</code> if there is no match currently or the
+*         text was not set with <code>usearch_setUTF8Text</code>.
+* @see #usearch_setUTF8Text
+* @draft ICU 79
+*/
+U_CAPI int32_t U_EXPORT2 usearch_getMatchedStartUTF8(
+                                               const UStringSearch *strsrch);
+
+/**
+* Returns the length in bytes of the current match in the UTF-8 text, like
+* <code>usearch_getMatchedLength</code>.
+* @param strsrch search iterator data struct
+* @return The UTF-8 length of the match, 0 if there is no match currently,
+*         or <code>USEARCH_DONE</code> if the text was not set with
+*         <code>usearch_setUTF8Text</code>.
+* @see #usearch_setUTF8Text
+* @draft ICU 79
+*/
+U_CAPI int32_t U_EXPORT2 usearch_getMatchedLengthUTF8(
+                                               const UStringSearch *strsrch);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Gets the collator used for the language rules. 
 * <p>
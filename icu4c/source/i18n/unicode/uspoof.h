@@ -28,7 +28,9 @@
 
 
 #if U_SHOW_CPLUSPLUS_API
+#include "unicode/bytestream.h"
 #include "unicode/localpointer.h"
+#include "unicode/stringpiece.h"
 #include "unicode/unistr.h"
 #include "unicode/uniset.h"
 #endif
@@ -190,6 +192,9 @@
  * uspoof_close(sc);
  * \endcode
  *
+ * In C++, a {@link icu::SpoofSkeletonIndex} stores the skeletons of a large dictionary compactly and checks a string
+ * against all of them in constant time.
+ *
  * <b>Note:</b> Since the Unicode confusables mapping table is frequently updated, confusable skeletons are <em>not</em>
  * guaranteed to be the same between ICU releases. We therefore recommend that you always compute confusable skeletons
  * at runtime and do not rely on creating a permanent, or difficult to update, database of skeletons.
@@ -1815,6 +1820,63 @@ U_I18N_API icu::UnicodeString &U_EXPORT2 uspoof_getBidiSkeletonUnicodeString(
     const USpoofChecker *sc, UBiDiDirection direction, const icu::UnicodeString &id,
     icu::UnicodeString &dest, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ *  Get the "skeleton" for a UTF-8 identifier and write it to a ByteSink.
+ *  Same result as uspoof_getSkeletonUTF8(), but the identifier is processed
+ *  in UTF-8 without conversion to and from UTF-16 (unless it is ill-formed),
+ *  and the caller need not guess the length of the skeleton.
+ *
+ *  Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param sc      The USpoofChecker.
+ * @param id      The UTF-8 identifier whose skeleton will be computed.
+ * @param dest    The ByteSink to which the UTF-8 skeleton string is written.
+ * @param status  The error code, set if an error occurred while attempting to
+ *                perform the check.
+ *
+ * @draft ICU 79
+ */
+U_I18N_API void U_EXPORT2
+uspoof_getSkeletonByteSink(const USpoofChecker *sc,
+                           icu::StringPiece id,
+                           icu::ByteSink &dest,
+                           UErrorCode *status);
+
+/**
+ *  Get the "skeletons" for an array of UTF-8 identifiers.
+ *  Same results as uspoof_getSkeletonByteSink() for each of the identifiers,
+ *  but intended for high volumes of identifiers, for example when building
+ *  a collection of the skeletons of all existing user names.
+ *
+ *  The skeletons are written one after another, without separators,
+ *  into one buffer; limits[i] is the end of the skeleton for ids[i]
+ *  and the start of the next one.
+ *  The buffer is NUL-terminated if there is room for the NUL.
+ *
+ * @param sc       The USpoofChecker.
+ * @param ids      The UTF-8 identifiers whose skeletons will be computed.
+ * @param count    The number of identifiers.
+ * @param dest     The output buffer, to receive the skeleton strings;
+ *                 can be nullptr if capacity is 0, for preflighting.
+ * @param capacity The length of the output buffer, in bytes.
+ * @param limits   Receives count skeleton limits in dest.
+ * @param status   The error code, set if an error occurred while attempting to
+ *                 perform the check.  Set to U_BUFFER_OVERFLOW_ERROR if the
+ *                 skeletons do not fit into the buffer; limits are set anyway.
+ * @return         The total length of the skeletons, in bytes,
+ *                 not counting the terminating NUL.
+ *
+ * @draft ICU 79
+ */
+U_I18N_API int32_t U_EXPORT2
+uspoof_getSkeletonBatchUTF8(const USpoofChecker *sc,
+                            const icu::StringPiece ids[], int32_t count,
+                            char *dest, int32_t capacity,
+                            int32_t limits[],
+                            UErrorCode *status);
+#endif  // U_HIDE_DRAFT_API
+
 /**
   * Get the set of Candidate Characters for Inclusion in Identifiers, as defined
   * in http://unicode.org/Public/security/latest/xidmodifications.txt
@@ -1845,6 +1907,157 @@ uspoof_getInclusionUnicodeSet(UErrorCode *status);
 U_CAPI const icu::UnicodeSet * U_EXPORT2
 uspoof_getRecommendedUnicodeSet(UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+struct SpoofSkeletonIndexHeader;
+
+/**
+ * A compact set of the skeletons of many identifiers, for checking whether a new identifier
+ * is confusable with any of them, for example when a new user name is registered.
+ * This replaces computing the skeleton of every existing identifier (see uspoof_getSkeleton())
+ * and keeping them in an application hash table.
+ *
+ * The index stores only a 64-bit hash of each skeleton, in an open-addressing hash table
+ * of about 11 to 21 bytes per distinct skeleton, not the identifiers or skeletons themselves.
+ * Adding or looking up an identifier computes its skeleton and then takes constant time.
+ *
+ * Since different skeletons can have the same hash, isConfusable() returns a false positive
+ * with a probability of about size()/2<sup>64</sup> per query.
+ * There are no false negatives. Where that matters, or where the kind of confusability is needed,
+ * keep the identifiers elsewhere and confirm a match with uspoof_areConfusable().
+ * Only the plain skeletons of uspoof_getSkeleton() are indexed, not bidi skeletons.
+ *
+ * The serialized form of an index can be used directly, without copying or parsing it,
+ * for example from a memory-mapped file.
+ * It depends on the platform endianness and on the confusables data,
+ * which typically changes with each ICU version. An index serialized with different
+ * confusables data cannot be opened and must be rebuilt from the identifiers.
+ *
+ * The const functions can be called concurrently, but not concurrently with add().
+ *
+ * @draft ICU 79
+ */
+class U_I18N_API SpoofSkeletonIndex : public UMemory {
+public:
+    /**
+     * Constructs an empty index.
+     *
+     * @param sc     The USpoofChecker whose confusables data is used for the skeletons.
+     *               The index works with a clone of it.
+     * @param status The error code, set if an error occurred.
+     * @draft ICU 79
+     */
+    SpoofSkeletonIndex(const USpoofChecker *sc, UErrorCode &status);
+
+    /**
+     * Constructs an index from its serialized form, as written by serialize().
+     * The data is not copied and must remain valid and unchanged as long as
+     * the index is used, or until the first add(), which copies it.
+     *
+     * @param sc     The USpoofChecker whose confusables data is used for the skeletons.
+     *               The index works with a clone of it.
+     * @param data   The serialized index. Must be aligned to 8 bytes.
+     * @param length The length of the data, in bytes.
+     *               Can be larger than the serialized index.
+     * @param status The error code. Set to U_INVALID_FORMAT_ERROR if the data
+     *               is not a serialized index for this platform
+     *               and for the confusables data of the checker.
+     * @draft ICU 79
+     */
+    SpoofSkeletonIndex(const USpoofChecker *sc, const void *data, int32_t length, UErrorCode &status);
+
+    /**
+     * Destructor.
+     * @draft ICU 79
+     */
+    ~SpoofSkeletonIndex();
+
+    /**
+     * Adds the skeleton of an identifier.
+     *
+     * @param id     The identifier.
+     * @param status The error code, set if an error occurred.
+     * @return true if the identifier was not confusable with any one already in the index
+     * @draft ICU 79
+     */
+    UBool add(const UnicodeString &id, UErrorCode &status);
+
+    /**
+     * Adds the skeleton of a UTF-8 identifier.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     *
+     * @param id     The UTF-8 identifier.
+     * @param status The error code, set if an error occurred.
+     * @return true if the identifier was not confusable with any one already in the index
+     * @draft ICU 79
+     */
+    UBool addUTF8(StringPiece id, UErrorCode &status);
+
+    /**
+     * Returns whether an identifier is confusable with any one in the index,
+     * that is, whether an identifier with the same skeleton was added.
+     *
+     * @param id     The identifier.
+     * @param status The error code, set if an error occurred.
+     * @return true if the identifier is confusable with one in the index
+     * @draft ICU 79
+     */
+    UBool isConfusable(const UnicodeString &id, UErrorCode &status) const;
+
+    /**
+     * Returns whether a UTF-8 identifier is confusable with any one in the index,
+     * that is, whether an identifier with the same skeleton was added.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     *
+     * @param id     The UTF-8 identifier.
+     * @param status The error code, set if an error occurred.
+     * @return true if the identifier is confusable with one in the index
+     * @draft ICU 79
+     */
+    UBool isConfusableUTF8(StringPiece id, UErrorCode &status) const;
+
+    /**
+     * @return the number of distinct skeletons in the index
+     * @draft ICU 79
+     */
+    int32_t size() const;
+
+    /**
+     * Writes the index into a buffer, for storing it and later
+     * constructing an index from it without having to rebuild it.
+     *
+     * @param dest     The destination buffer. Should be aligned to 8 bytes.
+     *                 Can be nullptr if capacity is 0, for preflighting.
+     * @param capacity The size of the buffer, in bytes.
+     * @param status   The error code. Set to U_BUFFER_OVERFLOW_ERROR
+     *                 if the index does not fit into the buffer.
+     * @return the length of the serialized index, in bytes
+     * @draft ICU 79
+     */
+    int32_t serialize(void *dest, int32_t capacity, UErrorCode &status) const;
+
+private:
+    SpoofSkeletonIndex(const SpoofSkeletonIndex &) = delete;
+    SpoofSkeletonIndex &operator=(const SpoofSkeletonIndex &) = delete;
+
+    uint64_t hashSkeleton(StringPiece id, UErrorCode &status) const;
+    UBool contains(uint64_t hash) const;
+    UBool insert(uint64_t hash, UErrorCode &status);
+    void reallocate(int32_t capacity, UErrorCode &status);
+
+    USpoofChecker *fChecker;
+    uint64_t fDataFingerprint;
+    SpoofSkeletonIndexHeader *fHeader;
+    uint64_t *fSlots;
+    UBool fOwned;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+
 #endif /* U_SHOW_CPLUSPLUS_API */
 
 #endif /* UCONFIG_NO_NORMALIZATION */
@@ -440,6 +440,52 @@ unum_parseDouble(    const   UNumberFormat*  fmt,
     return res.getDouble(*status);
 }
 
+U_CAPI int32_t U_EXPORT2
+unum_parseDoubleBatch(const UNumberFormat*  fmt,
+                      const char16_t* const* texts,
+                      const int32_t*        textLengths,
+                      int32_t               count,
+                      double*               results,
+                      int32_t*              parseEnds,
+                      UErrorCode*           status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (fmt == nullptr || count < 0 || (count > 0 && (texts == nullptr || results == nullptr))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const NumberFormat* nf = reinterpret_cast<const NumberFormat*>(fmt);
+    const DecimalFormat* df = dynamic_cast<const DecimalFormat*>(nf);
+    int32_t successes = 0;
+    for (int32_t i = 0; i < count && U_SUCCESS(*status); i++) {
+        int32_t textLength = textLengths == nullptr ? -1 : textLengths[i];
+        // Read-only alias
+        const UnicodeString src(textLength == -1, texts[i], textLength);
+        int32_t parseEnd = -1;
+        if (df != nullptr) {
+            df->parseBatch(&src, 1, results + i, &parseEnd, *status);
+        } else {
+            Formattable res;
+            ParsePosition pp;
+            nf->parse(src, res, pp);
+            results[i] = 0.0;
+            if (pp.getErrorIndex() == -1) {
+                parseEnd = pp.getIndex();
+                results[i] = res.getDouble(*status);
+            }
+        }
+        if (parseEnds != nullptr) {
+            parseEnds[i] = parseEnd;
+        }
+        if (parseEnd >= 0) {
+            successes++;
+        }
+    }
+    return successes;
+}
+
 U_CAPI int32_t U_EXPORT2
 unum_parseDecimal(const UNumberFormat*  fmt,
             const char16_t*    text,
@@ -17,9 +17,11 @@
 #include "unicode/ustring.h"
 #include "unicode/uchar.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "normalizer2impl.h"
 #include "usrchimp.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_in.h"
 #include "uassert.h"
 #include "ustr_imp.h"
@@ -305,6 +307,50 @@ inline void initializePatternCETable(UStringSearch *strsrch, UErrorCode *status)
     pattern->cesLength = offset;
 }
 
+/**
+* Hashes a processed collation element by its primary weight, for the shift
+* tables.  Equal CEs always hash alike, which is all that the shifts rely on.
+* @param pce processed collation element
+* @return index into the shift tables
+*/
+static
+inline int32_t hashFromPCE(int64_t pce)
+{
+    return static_cast<int32_t>(static_cast<uint64_t>(pce) >> 48) % MAX_TABLE_SIZE_;
+}
+
+/**
+* Builds the Horspool bad-character shift tables for the pattern pces.
+* When there is no match at a position, the forward search looks at the
+* target CE aligned with the last pattern CE and moves forward by
+* shift[hashFromPCE(ce)]: the distance from the last pattern CE to the
+* closest preceding one in the same hash bucket, or the pattern length if
+* there is none.  backShift[] is the mirror image for the backward search,
+* keyed off the target CE aligned with the first pattern CE.
+* Shifts are capped at 0xFFFF; a smaller shift is always safe.
+* Internal method.
+* @param pattern pattern data, with pces already set
+*/
+static
+inline void setShiftTable(UPattern *pattern)
+{
+    int32_t length       = pattern->pcesLength;
+    UChar   defaultShift = static_cast<UChar>(length < 0xFFFF ? length : 0xFFFF);
+    for (int32_t i = 0; i < MAX_TABLE_SIZE_; i++) {
+        pattern->shift[i]     = defaultShift;
+        pattern->backShift[i] = defaultShift;
+    }
+    for (int32_t i = 0; i < length - 1; i++) {
+        int32_t distance = length - 1 - i;
+        pattern->shift[hashFromPCE(pattern->pces[i])] =
+            static_cast<UChar>(distance < 0xFFFF ? distance : 0xFFFF);
+    }
+    for (int32_t i = length - 1; i > 0; i--) {
+        pattern->backShift[hashFromPCE(pattern->pces[i])] =
+            static_cast<UChar>(i < 0xFFFF ? i : 0xFFFF);
+    }
+}
+
 /**
 * Initializing the pce table for a pattern.
 * Stores non-ignorable collation keys.
@@ -371,6 +417,7 @@ inline void initializePatternPCETable(UStringSearch *strsrch,
     }
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
+    setShiftTable(pattern);
 }
 
 /**
@@ -637,6 +684,11 @@ U_CAPI UStringSearch * U_EXPORT2 usearch_openFromCollator(
 
         result->search->text       = text;
         result->search->textLength = textlength;
+        result->search->utf8Text   = nullptr;
+        result->search->utf8Length = 0;
+        result->search->utf16Text  = nullptr;
+        result->search->utf8MapIndex16 = 0;
+        result->search->utf8MapIndex8  = 0;
 
         result->pattern.text       = pattern;
         result->pattern.textLength = patternlength;
@@ -708,6 +760,7 @@ U_CAPI void U_EXPORT2 usearch_close(UStringSearch *strsrch)
         }
 #endif
 
+        uprv_free(strsrch->search->utf16Text);
         uprv_free(strsrch->search);
         uprv_free(strsrch);
     }
@@ -911,6 +964,12 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
             if (textlength == -1) {
                 textlength = u_strlen(text);
             }
+            if (text != strsrch->search->utf16Text) {
+                uprv_free(strsrch->search->utf16Text);
+                strsrch->search->utf16Text = nullptr;
+            }
+            strsrch->search->utf8Text   = nullptr;
+            strsrch->search->utf8Length = 0;
             strsrch->search->text       = text;
             strsrch->search->textLength = textlength;
             ucol_setText(strsrch->textIter, text, textlength, status);
@@ -930,6 +989,104 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
     }
 }
 
+U_CAPI void U_EXPORT2 usearch_setUTF8Text(      UStringSearch *strsrch,
+                                          const char          *text,
+                                                int32_t        textlength,
+                                                UErrorCode    *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (strsrch == nullptr || text == nullptr || textlength < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (textlength == -1) {
+        textlength = static_cast<int32_t>(uprv_strlen(text));
+    }
+    if (textlength == 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    // Each UTF-8 sequence, and each ill-formed one replaced by U+FFFD,
+    // becomes at most as many UTF-16 code units as it has bytes.
+    char16_t *utf16 = static_cast<char16_t *>(uprv_malloc(textlength * sizeof(char16_t)));
+    if (utf16 == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t utf16Length = 0;
+    for (int32_t i = 0; i < textlength;) {
+        UChar32 c;
+        U8_NEXT_OR_FFFD(text, i, textlength, c);
+        U16_APPEND_UNSAFE(utf16, utf16Length, c);
+    }
+
+    usearch_setText(strsrch, utf16, utf16Length, status);
+    if (U_FAILURE(*status)) {
+        if (strsrch->search->text != utf16) {
+            uprv_free(utf16);
+        }
+        return;
+    }
+    strsrch->search->utf16Text      = utf16;
+    strsrch->search->utf8Text       = text;
+    strsrch->search->utf8Length     = textlength;
+    strsrch->search->utf8MapIndex16 = 0;
+    strsrch->search->utf8MapIndex8  = 0;
+}
+
+namespace {
+
+/**
+* Maps an index into the UTF-16 conversion of the UTF-8 text to the offset
+* of the same position in the UTF-8 text. Lookups continue from the last
+* one, so that mapping successive matches is linear in the text length.
+*/
+int32_t getUTF8Index(USearch *search, int32_t index16) {
+    if (index16 < search->utf8MapIndex16) {
+        search->utf8MapIndex16 = 0;
+        search->utf8MapIndex8  = 0;
+    }
+    int32_t i16 = search->utf8MapIndex16;
+    int32_t i8  = search->utf8MapIndex8;
+    while (i16 < index16 && i8 < search->utf8Length) {
+        UChar32 c;
+        U8_NEXT_OR_FFFD(search->utf8Text, i8, search->utf8Length, c);
+        i16 += U16_LENGTH(c);
+    }
+    search->utf8MapIndex16 = i16;
+    search->utf8MapIndex8  = i8;
+    return i8;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2 usearch_getMatchedStartUTF8(
+                                                const UStringSearch *strsrch)
+{
+    if (strsrch == nullptr || strsrch->search->utf8Text == nullptr ||
+        strsrch->search->matchedIndex == USEARCH_DONE) {
+        return USEARCH_DONE;
+    }
+    return getUTF8Index(strsrch->search, strsrch->search->matchedIndex);
+}
+
+U_CAPI int32_t U_EXPORT2 usearch_getMatchedLengthUTF8(
+                                                const UStringSearch *strsrch)
+{
+    if (strsrch == nullptr || strsrch->search->utf8Text == nullptr) {
+        return USEARCH_DONE;
+    }
+    if (strsrch->search->matchedIndex == USEARCH_DONE) {
+        return 0;
+    }
+    USearch *search = strsrch->search;
+    int32_t start = getUTF8Index(search, search->matchedIndex);
+    return getUTF8Index(search, search->matchedIndex + search->matchedLength) - start;
+}
+
 U_CAPI const char16_t * U_EXPORT2 usearch_getText(const UStringSearch *strsrch,
                                                      int32_t       *length)
 {
@@ -1802,6 +1959,10 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
+    // The shift table is only valid when each pattern CE has to equal exactly one
+    // target CE; the wildcard comparison types may skip CEs on either side.
+    int32_t  patternLength = strsrch->pattern.pcesLength;
+    UBool    useShift = strsrch->search->elementComparisonType == 0 && patternLength > 1;
 
 
     // Outer loop moves over match starting positions in the
@@ -1834,7 +1995,33 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
             found = false;
             break;
         }
-        
+
+        if (useShift) {
+            // Boyer-Moore-Horspool: check the target CE under the last pattern CE
+            // first. If it does not match, skip the positions at which it would be
+            // aligned with a pattern CE of a different primary weight.
+            int32_t    probeIx = targetIx + patternLength - 1;
+            const CEI *probeCEI = nullptr;
+            for (int32_t ix = ceb.limitIx; ix < probeIx; ix++) {
+                ceb.get(ix);
+            }
+            probeCEI = ceb.get(probeIx);
+            if (probeCEI == nullptr) {
+                *status = U_INTERNAL_PROGRAM_ERROR;
+                found = false;
+                break;
+            }
+            if (probeCEI->ce == UCOL_PROCESSED_NULLORDER) {
+                // The pattern no longer fits into the rest of the target text.
+                found = false;
+                break;
+            }
+            if (probeCEI->ce != strsrch->pattern.pces[patternLength - 1]) {
+                targetIx += strsrch->pattern.shift[hashFromPCE(probeCEI->ce)] - 1;
+                continue;
+            }
+        }
+
         for (patIx=0; patIx<strsrch->pattern.pcesLength; patIx++) {
             patCE = strsrch->pattern.pces[patIx];
             targetCEI = ceb.get(targetIx+patIx+targetIxOffset);
@@ -2148,6 +2335,9 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
+    int32_t  patternLength = strsrch->pattern.pcesLength;
+    UBool    useShift = strsrch->search->elementComparisonType == 0 && patternLength > 1;
+
 
 
     // Outer loop moves over match starting positions in the
@@ -2168,6 +2358,30 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
             found = false;
              break;
         }
+
+        if (useShift) {
+            // Mirror image of the forward Boyer-Moore-Horspool skip, probing the
+            // target CE under the first pattern CE.
+            int32_t    probeIx = targetIx + patternLength - 1;
+            const CEI *probeCEI = nullptr;
+            for (int32_t ix = ceb.limitIx; ix < probeIx; ix++) {
+                ceb.getPrevious(ix);
+            }
+            probeCEI = ceb.getPrevious(probeIx);
+            if (probeCEI == nullptr) {
+                *status = U_INTERNAL_PROGRAM_ERROR;
+                found = false;
+                break;
+            }
+            if (probeCEI->ce == UCOL_PROCESSED_NULLORDER) {
+                found = false;
+                break;
+            }
+            if (probeCEI->ce != strsrch->pattern.pces[0]) {
+                targetIx += strsrch->pattern.backShift[hashFromPCE(probeCEI->ce)] - 1;
+                continue;
+            }
+        }
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
         int32_t targetIxOffset = 0;
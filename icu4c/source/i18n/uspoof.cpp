@@ -17,10 +17,14 @@
 */
 #include "unicode/ubidi.h"
 #include "unicode/utypes.h"
+#include "unicode/bytestream.h"
 #include "unicode/normalizer2.h"
 #include "unicode/uspoof.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
@@ -787,8 +791,15 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
     for (inputIndex=0; inputIndex < normalizedLen; ) {
         UChar32 c = nfdId.char32At(inputIndex);
         inputIndex += U16_LENGTH(c);
-        if (!u_hasBinaryProperty(c, UCHAR_DEFAULT_IGNORABLE_CODE_POINT)) {
-            This->fSpoofData->confusableLookup(c, skelStr);
+        uint16_t value = This->fSpoofData->getSkeletonValue(c);
+        if ((value & SpoofData::SKELETON_IGNORABLE) != 0) {
+            continue;
+        }
+        int32_t index = (value & SpoofData::SKELETON_INDEX_MASK) - 1;
+        if (index < 0) {
+            skelStr.append(c);
+        } else {
+            This->fSpoofData->appendValueTo(index, skelStr);
         }
     }
 
@@ -796,6 +807,125 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
     return dest;
 }
 
+namespace {
+
+UBool isASCII(StringPiece s) {
+    for (int32_t i = 0; i < s.length(); ++i) {
+        if (static_cast<uint8_t>(s.data()[i]) >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the skeleton of a UTF-8 identifier to the sink.
+// Same as uspoof_getSkeletonUnicodeString() but without conversions to and from UTF-16.
+// nfdId and skelStr are scratch buffers, so that the batch function can reuse them.
+void getSkeletonUTF8(const USpoofChecker *sc, const SpoofImpl *This, StringPiece id, ByteSink &dest,
+                     CharString &nfdId, CharString &skelStr, UErrorCode &status) {
+    // ASCII is always in NFD.
+    StringPiece nfd = id;
+    if (!isASCII(id)) {
+        nfdId.clear();
+        CharStringByteSink nfdSink(&nfdId);
+        gNfdNormalizer->normalizeUTF8(0, id, nfdSink, nullptr, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        nfd = nfdId.toStringPiece();
+    }
+
+    // Apply the skeleton mapping to the NFD normalized input string,
+    // copying runs of code points that map to themselves all at once.
+    skelStr.clear();
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(nfd.data());
+    int32_t length = nfd.length();
+    int32_t copyStart = 0;
+    for (int32_t i = 0; i < length;) {
+        int32_t start = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0) {
+            // Ill-formed UTF-8: Let UTF-16 conversion substitute U+FFFD as usual.
+            UnicodeString skeleton;
+            uspoof_getSkeletonUnicodeString(sc, 0 /* deprecated */,
+                                            UnicodeString::fromUTF8(id), skeleton, &status);
+            skeleton.toUTF8(dest);
+            return;
+        }
+        uint16_t value = This->fSpoofData->getSkeletonValue(c);
+        if (value == 0) {
+            continue;
+        }
+        skelStr.append(nfd.data() + copyStart, start - copyStart, status);
+        if ((value & SpoofData::SKELETON_IGNORABLE) == 0) {
+            int32_t index = (value & SpoofData::SKELETON_INDEX_MASK) - 1;
+            if (index < 0) {
+                skelStr.append(nfd.data() + start, i - start, status);
+            } else {
+                This->fSpoofData->appendValueToUTF8(index, skelStr, status);
+            }
+        }
+        copyStart = i;
+    }
+    skelStr.append(nfd.data() + copyStart, length - copyStart, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (isASCII(skelStr.toStringPiece())) {
+        dest.Append(skelStr.data(), skelStr.length());
+    } else {
+        gNfdNormalizer->normalizeUTF8(0, skelStr.toStringPiece(), dest, nullptr, status);
+    }
+}
+
+}  // namespace
+
+U_I18N_API void U_EXPORT2
+uspoof_getSkeletonByteSink(const USpoofChecker *sc,
+                           StringPiece id,
+                           ByteSink &dest,
+                           UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    CharString nfdId, skelStr;
+    getSkeletonUTF8(sc, This, id, dest, nfdId, skelStr, *status);
+}
+
+U_I18N_API int32_t U_EXPORT2
+uspoof_getSkeletonBatchUTF8(const USpoofChecker *sc,
+                            const StringPiece ids[], int32_t count,
+                            char *dest, int32_t capacity,
+                            int32_t limits[],
+                            UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (count < 0 || (count > 0 && (ids == nullptr || limits == nullptr)) ||
+            capacity < 0 || (dest == nullptr && capacity != 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    CharString nfdId, skelStr;
+    int32_t length = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        // After an overflow, only count the lengths.
+        CheckedArrayByteSink sink(length < capacity ? dest + length : nullptr,
+                                  length < capacity ? capacity - length : 0);
+        getSkeletonUTF8(sc, This, ids[i], sink, nfdId, skelStr, *status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+        length += sink.NumberOfBytesAppended();
+        limits[i] = length;
+    }
+    return u_terminateChars(dest, capacity, length, status);
+}
+
 U_CAPI int32_t U_EXPORT2 uspoof_getSkeletonUTF8(const USpoofChecker *sc, uint32_t type, const char *id,
                                                 int32_t length, char *dest, int32_t destCapacity,
                        UErrorCode *status) {
@@ -808,17 +938,15 @@ U_CAPI int32_t U_EXPORT2 uspoof_getSkeletonUTF8(const USpoofChecker *sc, uint32_
         return 0;
     }
 
-    UnicodeString srcStr = UnicodeString::fromUTF8(
-        StringPiece(id, length >= 0 ? length : static_cast<int32_t>(uprv_strlen(id))));
-    UnicodeString destStr;
-    uspoof_getSkeletonUnicodeString(sc, type, srcStr, destStr, status);
+    (void)type;  // deprecated
+    CheckedArrayByteSink sink(dest, destCapacity);
+    uspoof_getSkeletonByteSink(
+        sc, StringPiece(id, length >= 0 ? length : static_cast<int32_t>(uprv_strlen(id))),
+        sink, status);
     if (U_FAILURE(*status)) {
         return 0;
     }
-
-    int32_t lengthInUTF8 = 0;
-    u_strToUTF8(dest, destCapacity, &lengthInUTF8, destStr.getBuffer(), destStr.length(), status);
-    return lengthInUTF8;
+    return u_terminateChars(dest, destCapacity, sink.NumberOfBytesAppended(), status);
 }
 
 U_CAPI int32_t U_EXPORT2 uspoof_getBidiSkeletonUTF8(const USpoofChecker *sc, UBiDiDirection direction,
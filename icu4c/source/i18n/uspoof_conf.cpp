@@ -23,8 +23,12 @@
 #if !UCONFIG_NO_REGULAR_EXPRESSIONS
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/unorm.h"
 #include "unicode/uregex.h"
+#include "unicode/uset.h"
 #include "unicode/ustring.h"
 #include "cmemory.h"
 #include "uspoof_impl.h"
@@ -472,6 +476,52 @@ void ConfusabledataBuilder::outputData(UErrorCode &status) {
     rawData->fCFUStringTable = static_cast<int32_t>(reinterpret_cast<char*>(strings) - reinterpret_cast<char*>(rawData));
     rawData->fCFUStringTableLen = stringsLength;
     fSpoofImpl->fSpoofData->fCFUStrings = strings;
+
+    // The Trie, for looking up the skeleton value of a code point
+    //   without a binary search of the keys.
+    //   Only code points with a confusable entry or the Default_Ignorable_Code_Point property
+    //   have nonzero values.
+    U_ASSERT(numKeys < SpoofData::SKELETON_INDEX_MASK);
+    LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(0, 0, &status));
+    for (i=0; i<numKeys; i++) {
+        UChar32 codePoint = fSpoofImpl->fSpoofData->codePointAt(i);
+        umutablecptrie_set(mutableTrie.getAlias(), codePoint,
+                           fSpoofImpl->fSpoofData->computeSkeletonValue(codePoint), &status);
+    }
+    const USet *ignorables = u_getBinaryPropertySet(UCHAR_DEFAULT_IGNORABLE_CODE_POINT, &status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t numRanges = uset_getRangeCount(ignorables);
+    for (int32_t range=0; range<numRanges; range++) {
+        UChar32 start, end;
+        uset_getItem(ignorables, range, &start, &end, nullptr, 0, &status);
+        for (UChar32 c=start; c<=end; c++) {
+            umutablecptrie_set(mutableTrie.getAlias(), c,
+                               fSpoofImpl->fSpoofData->computeSkeletonValue(c), &status);
+        }
+    }
+    LocalUCPTriePointer trie(umutablecptrie_buildImmutable(
+        mutableTrie.getAlias(), UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, &status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+    UErrorCode preflightStatus = U_ZERO_ERROR;
+    int32_t trieLength = ucptrie_toBinary(trie.getAlias(), nullptr, 0, &preflightStatus);
+    if (preflightStatus != U_BUFFER_OVERFLOW_ERROR) {
+        status = preflightStatus;
+        return;
+    }
+    void *trieBytes = fSpoofImpl->fSpoofData->reserveSpace(trieLength, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    ucptrie_toBinary(trie.getAlias(), trieBytes, trieLength, &status);
+    rawData = fSpoofImpl->fSpoofData->fRawData;
+    U_ASSERT(rawData->fCFUTrie == 0);
+    rawData->fCFUTrie = static_cast<int32_t>(reinterpret_cast<char*>(trieBytes) - reinterpret_cast<char*>(rawData));
+    rawData->fCFUTrieLength = trieLength;
+    fSpoofImpl->fSpoofData->initPtrs(status);
 }
 
 #endif
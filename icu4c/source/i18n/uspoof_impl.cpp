@@ -11,8 +11,11 @@
 #include "unicode/uspoof.h"
 #include "unicode/uchar.h"
 #include "unicode/uniset.h"
+#include "unicode/ucptrie.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "utrie2.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "scriptset.h"
@@ -662,6 +665,7 @@ void SpoofData::reset() {
    fCFUKeys = nullptr;
    fCFUValues = nullptr;
    fCFUStrings = nullptr;
+   fCFUTrie = nullptr;
 }
 
 
@@ -684,6 +688,8 @@ void SpoofData::initPtrs(UErrorCode &status) {
     fCFUKeys = nullptr;
     fCFUValues = nullptr;
     fCFUStrings = nullptr;
+    ucptrie_close(fCFUTrie);
+    fCFUTrie = nullptr;
     if (U_FAILURE(status)) {
         return;
     }
@@ -696,10 +702,18 @@ void SpoofData::initPtrs(UErrorCode &status) {
     if (fRawData->fCFUStringTable != 0) {
         fCFUStrings = reinterpret_cast<char16_t*>(reinterpret_cast<char*>(fRawData) + fRawData->fCFUStringTable);
     }
+    if (fRawData->fCFUTrie != 0) {
+        int32_t actualLength;
+        fCFUTrie = ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                          reinterpret_cast<char*>(fRawData) + fRawData->fCFUTrie,
+                                          fRawData->fCFUTrieLength, &actualLength, &status);
+    }
 }
 
 
 SpoofData::~SpoofData() {
+    ucptrie_close(fCFUTrie);
+    fCFUTrie = nullptr;
     if (fDataOwned) {
         uprv_free(fRawData);
     }
@@ -763,6 +777,20 @@ int32_t SpoofData::size() const {
 //-------------------------------
 
 int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
+    int32_t index = fCFUTrie != nullptr ?
+        (getSkeletonValue(inChar) & SKELETON_INDEX_MASK) - 1 : findIndex(inChar);
+
+    // Did we find an entry?  If not, the char maps to itself.
+    if (index < 0) {
+        dest.append(inChar);
+        return 1;
+    }
+
+    // Add the element to the string builder and return.
+    return appendValueTo(index, dest);
+}
+
+int32_t SpoofData::findIndex(UChar32 inChar) const {
     // Perform a binary search.
     // [lo, hi), i.e lo is inclusive, hi is exclusive.
     // The result after the loop will be in lo.
@@ -780,15 +808,15 @@ int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
             break;
         }
     } while (hi - lo > 1);
+    return codePointAt(lo) == inChar ? lo : -1;
+}
 
-    // Did we find an entry?  If not, the char maps to itself.
-    if (codePointAt(lo) != inChar) {
-        dest.append(inChar);
-        return 1;
+uint16_t SpoofData::computeSkeletonValue(UChar32 c) const {
+    uint16_t value = static_cast<uint16_t>(findIndex(c) + 1);
+    if (u_hasBinaryProperty(c, UCHAR_DEFAULT_IGNORABLE_CODE_POINT)) {
+        value |= SKELETON_IGNORABLE;
     }
-
-    // Add the element to the string builder and return.
-    return appendValueTo(lo, dest);
+    return value;
 }
 
 int32_t SpoofData::length() const {
@@ -814,6 +842,21 @@ int32_t SpoofData::appendValueTo(int32_t index, UnicodeString& dest) const {
     return stringLength;
 }
 
+void SpoofData::appendValueToUTF8(int32_t index, CharString &dest, UErrorCode &status) const {
+    int32_t stringLength = ConfusableDataUtils::keyToLength(fCFUKeys[index]);
+    uint16_t value = fCFUValues[index];
+    char16_t single = static_cast<char16_t>(value);
+    const char16_t *s = stringLength == 1 ? &single : fCFUStrings + value;
+    char buffer[U8_MAX_LENGTH];
+    for (int32_t i = 0; i < stringLength;) {
+        UChar32 c;
+        U16_NEXT(s, i, stringLength, c);
+        int32_t length = 0;
+        U8_APPEND_UNSAFE(buffer, length, c);
+        dest.append(buffer, length, status);
+    }
+}
+
 
 U_NAMESPACE_END
 
@@ -937,6 +980,13 @@ uspoof_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *ou
     sectionLength = ds->readUInt32(spoofDH->fCFUStringTableLen) * 2;
     ds->swapArray16(ds, inBytes+sectionStart, sectionLength, outBytes+sectionStart, status);
 
+    // Trie Section, if present
+    sectionStart  = ds->readUInt32(spoofDH->fCFUTrie);
+    sectionLength = ds->readUInt32(spoofDH->fCFUTrieLength);
+    if (sectionStart != 0) {
+        ucptrie_swap(ds, inBytes+sectionStart, sectionLength, outBytes+sectionStart, status);
+    }
+
     // And, last, swap the header itself.
     //   int32_t   fMagic             // swap this
     //   uint8_t   fFormatVersion[4]  // Do not swap this, just copy
@@ -20,6 +20,7 @@
 #include "unicode/uspoof.h"
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
+#include "unicode/ucptrie.h"
 #include "udataswp.h"
 #include "utrie2.h"
 
@@ -46,6 +47,7 @@ U_NAMESPACE_BEGIN
 // Magic number for sanity checking spoof checkers.
 #define USPOOF_CHECK_MAGIC 0x2734ecde
 
+class CharString;
 class ScriptSet;
 class SpoofData;
 struct SpoofDataHeader;
@@ -246,12 +248,35 @@ class SpoofData: public UMemory {
     // Not to be confused with length, which returns the number of confusable entries.
     int32_t size() const;
 
+    // Get the raw data buffer, size() bytes long.
+    const void *getRawData() const { return fRawData; }
+
     // Get the confusable skeleton transform for a single code point.
     // The result is a string with a length between 1 and 18 as of Unicode 9.
     // This is the main public endpoint for this class.
     // @return   The length in UTF-16 code units of the substitution string.
     int32_t confusableLookup(UChar32 inChar, UnicodeString &dest) const;
 
+    // Bits of a skeleton value, see getSkeletonValue().
+    static constexpr uint16_t SKELETON_IGNORABLE = 0x8000;
+    static constexpr uint16_t SKELETON_INDEX_MASK = 0x7fff;
+
+    // Get what the skeleton of an NFD string does with a single code point:
+    // SKELETON_IGNORABLE is set for Default_Ignorable_Code_Point characters, which are dropped,
+    // and the SKELETON_INDEX_MASK bits are 0 if the code point maps to itself,
+    // or else the index+1 of its confusable entry.
+    // Uses the trie if the data has one, or else a binary search of the keys.
+    inline uint16_t getSkeletonValue(UChar32 c) const {
+        if (fCFUTrie != nullptr) {
+            return static_cast<uint16_t>(UCPTRIE_FAST_GET(fCFUTrie, UCPTRIE_16, c));
+        }
+        return computeSkeletonValue(c);
+    }
+
+    // Same as getSkeletonValue() but always without the trie.
+    // Used for building the trie.
+    uint16_t computeSkeletonValue(UChar32 c) const;
+
     // Get the number of confusable entries in this SpoofData.
     int32_t length() const;
 
@@ -263,7 +288,14 @@ class SpoofData: public UMemory {
     // @return   The length in UTF-16 code units of the skeleton string.
     int32_t appendValueTo(int32_t index, UnicodeString& dest) const;
 
+    // Same as appendValueTo() but appends the value in UTF-8.
+    void appendValueToUTF8(int32_t index, CharString &dest, UErrorCode &status) const;
+
   private:
+    // Binary search of the keys.
+    // @return   The index of the confusable entry for the code point, or -1 if there is none.
+    int32_t findIndex(UChar32 inChar) const;
+
     // Reserve space in the raw data.  For use by builder when putting together a
     //   new set of data.  Init the new storage to zero, to prevent inconsistent
     //   results if it is not all otherwise set by the requester.
@@ -288,6 +320,7 @@ class SpoofData: public UMemory {
     int32_t                     *fCFUKeys;
     uint16_t                    *fCFUValues;
     char16_t                    *fCFUStrings;
+    UCPTrie                     *fCFUTrie;          // nullptr if the data has no trie
 
     friend class ConfusabledataBuilder;
 };
@@ -319,9 +352,15 @@ struct SpoofDataHeader {
     int32_t       fCFUStringTable;        // byte offset of String table
     int32_t       fCFUStringTableLen;     // length of string table (in 16 bit UChars)
 
+    // Optional (0 if absent, as in data from before ICU 79):
+    //   a UCPTrie of type UCPTRIE_TYPE_FAST with 16-bit values, mapping each code point
+    //   to its skeleton value as returned by SpoofData::getSkeletonValue().
+    int32_t       fCFUTrie;               // byte offset of the serialized trie
+    int32_t       fCFUTrieLength;         // length of the serialized trie, in bytes
+
     // The following sections are for data from xidmodifications.txt
 
-    int32_t       unused[15];              // Padding, Room for Expansion
+    int32_t       unused[13];              // Padding, Room for Expansion
 };
 
 
@@ -0,0 +1,324 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// uspoof_index.cpp
+// SpoofSkeletonIndex: a hash set of the skeletons of many identifiers.
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/uspoof.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "uspoof_impl.h"
+
+U_NAMESPACE_BEGIN
+
+// The serialized form of an index is this header followed by the slots,
+// an open-addressing, linear-probing hash table of 64-bit skeleton hashes
+// where 0 marks an empty slot.
+// An index keeps the header and the slots in one block of memory,
+// so that serializing it is a simple copy.
+struct SpoofSkeletonIndexHeader {
+    uint32_t magic;             // INDEX_MAGIC, also detects the wrong endianness
+    uint8_t formatVersion[4];
+    int32_t length;             // of the header and the slots, in bytes
+    int32_t capacity;           // number of slots, a power of 2
+    int32_t count;              // number of non-empty slots
+    int32_t reserved;
+    uint64_t dataFingerprint;   // hash of the confusables data
+};
+
+namespace {
+
+constexpr uint32_t INDEX_MAGIC = 0x536b4978;  // "SkIx"
+constexpr int32_t INITIAL_CAPACITY = 64;
+// Keeps the serialized length within int32_t.
+constexpr int32_t MAX_CAPACITY = 1 << 27;
+
+static_assert(sizeof(SpoofSkeletonIndexHeader) % 8 == 0, "the slots are aligned to 8 bytes");
+
+// The table grows when it would be more than 3/4 full.
+inline int32_t maxCount(int32_t capacity) {
+    return capacity / 4 * 3;
+}
+
+// 64-bit FNV-1a, which is stable across platforms and versions.
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+inline uint64_t fnv1a(uint64_t h, const char *s, int32_t length) {
+    for (int32_t i = 0; i < length; ++i) {
+        h = (h ^ static_cast<uint8_t>(s[i])) * FNV_PRIME;
+    }
+    return h;
+}
+
+// Spreads the FNV bits into the low bits that select the slot.
+inline uint64_t finalMix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Hashes a skeleton as it is written, rather than collecting it in a buffer.
+class SkeletonHashSink : public ByteSink {
+public:
+    void Append(const char *bytes, int32_t n) override {
+        fHash = fnv1a(fHash, bytes, n);
+    }
+    uint64_t getHash() const {
+        uint64_t h = finalMix(fHash);
+        return h != 0 ? h : 1;  // 0 marks an empty slot
+    }
+private:
+    uint64_t fHash = FNV_OFFSET_BASIS;
+};
+
+uint64_t getDataFingerprint(const USpoofChecker *sc, UErrorCode &status) {
+    const SpoofImpl *impl = SpoofImpl::validateThis(sc, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (impl->fSpoofData == nullptr) {
+        status = U_INVALID_STATE_ERROR;
+        return 0;
+    }
+    const SpoofData &data = *impl->fSpoofData;
+    return finalMix(fnv1a(FNV_OFFSET_BASIS, static_cast<const char *>(data.getRawData()), data.size()));
+}
+
+}  // namespace
+
+SpoofSkeletonIndex::SpoofSkeletonIndex(const USpoofChecker *sc, UErrorCode &status)
+        : fChecker(nullptr), fDataFingerprint(0), fHeader(nullptr), fSlots(nullptr), fOwned(false) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fChecker = uspoof_clone(sc, &status);
+    fDataFingerprint = getDataFingerprint(fChecker, status);
+    reallocate(INITIAL_CAPACITY, status);
+}
+
+SpoofSkeletonIndex::SpoofSkeletonIndex(const USpoofChecker *sc, const void *data, int32_t length,
+                                       UErrorCode &status)
+        : fChecker(nullptr), fDataFingerprint(0), fHeader(nullptr), fSlots(nullptr), fOwned(false) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (data == nullptr || length < 0 || (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fChecker = uspoof_clone(sc, &status);
+    fDataFingerprint = getDataFingerprint(fChecker, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    const auto *header = static_cast<const SpoofSkeletonIndexHeader *>(data);
+    if (length < static_cast<int32_t>(sizeof(SpoofSkeletonIndexHeader)) ||
+            header->magic != INDEX_MAGIC ||
+            header->formatVersion[0] != 1 ||
+            header->capacity < INITIAL_CAPACITY || header->capacity > MAX_CAPACITY ||
+            (header->capacity & (header->capacity - 1)) != 0 ||
+            header->length != static_cast<int32_t>(sizeof(SpoofSkeletonIndexHeader)) +
+                    header->capacity * static_cast<int32_t>(sizeof(uint64_t)) ||
+            header->length > length ||
+            header->count < 0 || header->count > maxCount(header->capacity)) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    if (header->dataFingerprint != fDataFingerprint) {
+        // Built with other confusables data, so the skeletons may differ.
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    // The data is only read until the first add() copies it.
+    fHeader = const_cast<SpoofSkeletonIndexHeader *>(header);
+    fSlots = reinterpret_cast<uint64_t *>(fHeader + 1);
+}
+
+SpoofSkeletonIndex::~SpoofSkeletonIndex() {
+    if (fOwned) {
+        uprv_free(fHeader);
+    }
+    uspoof_close(fChecker);
+}
+
+UBool SpoofSkeletonIndex::add(const UnicodeString &id, UErrorCode &status) {
+    CharString utf8;
+    {
+        CharStringByteSink sink(&utf8);
+        id.toUTF8(sink);
+    }
+    return addUTF8(utf8.toStringPiece(), status);
+}
+
+UBool SpoofSkeletonIndex::addUTF8(StringPiece id, UErrorCode &status) {
+    uint64_t hash = hashSkeleton(id, status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    return insert(hash, status);
+}
+
+UBool SpoofSkeletonIndex::isConfusable(const UnicodeString &id, UErrorCode &status) const {
+    CharString utf8;
+    {
+        CharStringByteSink sink(&utf8);
+        id.toUTF8(sink);
+    }
+    return isConfusableUTF8(utf8.toStringPiece(), status);
+}
+
+UBool SpoofSkeletonIndex::isConfusableUTF8(StringPiece id, UErrorCode &status) const {
+    uint64_t hash = hashSkeleton(id, status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    return contains(hash);
+}
+
+int32_t SpoofSkeletonIndex::size() const {
+    return fHeader != nullptr ? fHeader->count : 0;
+}
+
+int32_t SpoofSkeletonIndex::serialize(void *dest, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (dest == nullptr && capacity != 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (fHeader == nullptr) {
+        status = U_INVALID_STATE_ERROR;
+        return 0;
+    }
+    int32_t length = fHeader->length;
+    if (capacity < length) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+    uprv_memcpy(dest, fHeader, length);
+    return length;
+}
+
+uint64_t SpoofSkeletonIndex::hashSkeleton(StringPiece id, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (fHeader == nullptr) {
+        // The constructor failed.
+        status = U_INVALID_STATE_ERROR;
+        return 0;
+    }
+    SkeletonHashSink sink;
+    uspoof_getSkeletonByteSink(fChecker, id, sink, &status);
+    return sink.getHash();
+}
+
+UBool SpoofSkeletonIndex::contains(uint64_t hash) const {
+    // An empty slot ends the probing. Serialized data need not have one,
+    // so also stop after visiting every slot.
+    uint32_t mask = fHeader->capacity - 1;
+    uint32_t i = static_cast<uint32_t>(hash) & mask;
+    for (int32_t n = fHeader->capacity; n > 0; --n, i = (i + 1) & mask) {
+        uint64_t slot = fSlots[i];
+        if (slot == hash) {
+            return true;
+        } else if (slot == 0) {
+            return false;
+        }
+    }
+    return false;
+}
+
+UBool SpoofSkeletonIndex::insert(uint64_t hash, UErrorCode &status) {
+    if (contains(hash)) {
+        return false;
+    }
+    int32_t capacity = fHeader->capacity;
+    if (fHeader->count >= maxCount(capacity)) {
+        if (capacity >= MAX_CAPACITY) {
+            status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return false;
+        }
+        reallocate(capacity * 2, status);
+    } else if (!fOwned) {
+        reallocate(capacity, status);
+    }
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    uint32_t mask = fHeader->capacity - 1;
+    uint32_t i = static_cast<uint32_t>(hash) & mask;
+    while (fSlots[i] != 0) {
+        i = (i + 1) & mask;
+    }
+    fSlots[i] = hash;
+    ++fHeader->count;
+    return true;
+}
+
+void SpoofSkeletonIndex::reallocate(int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    U_ASSERT(capacity <= MAX_CAPACITY && (capacity & (capacity - 1)) == 0);
+    int32_t length = static_cast<int32_t>(sizeof(SpoofSkeletonIndexHeader)) +
+            capacity * static_cast<int32_t>(sizeof(uint64_t));
+    auto *header = static_cast<SpoofSkeletonIndexHeader *>(uprv_malloc(length));
+    if (header == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(header, 0, length);
+    header->magic = INDEX_MAGIC;
+    header->formatVersion[0] = 1;
+    header->length = length;
+    header->capacity = capacity;
+    header->dataFingerprint = fDataFingerprint;
+    auto *slots = reinterpret_cast<uint64_t *>(header + 1);
+    if (fHeader != nullptr) {
+        // Rehash into the new table, and count the entries rather than trusting
+        // the count of serialized data, so that the new table keeps empty slots.
+        uint32_t mask = capacity - 1;
+        int32_t count = 0;
+        for (int32_t j = 0; j < fHeader->capacity; ++j) {
+            uint64_t hash = fSlots[j];
+            if (hash != 0) {
+                if (++count > maxCount(capacity)) {
+                    uprv_free(header);
+                    status = U_INVALID_FORMAT_ERROR;
+                    return;
+                }
+                uint32_t i = static_cast<uint32_t>(hash) & mask;
+                while (slots[i] != 0) {
+                    i = (i + 1) & mask;
+                }
+                slots[i] = hash;
+            }
+        }
+        header->count = count;
+        if (fOwned) {
+            uprv_free(fHeader);
+        }
+    }
+    fHeader = header;
+    fSlots = slots;
+    fOwned = true;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -127,6 +127,7 @@ class UCollationPCE : public UMemory {
 U_NAMESPACE_END
 
 #define INITIAL_ARRAY_SIZE_       256
+#define MAX_TABLE_SIZE_           257
 
 struct USearch {
     // required since collation element iterator does not have a getText API
@@ -145,6 +146,14 @@ struct USearch {
           int32_t             matchedLength;
           UBool               isForwardSearching;
           UBool               reset;
+    // UTF-8 text set with usearch_setUTF8Text(), otherwise nullptr.
+    // text then points to utf16Text, its UTF-16 conversion owned by the search.
+    const char               *utf8Text;
+          int32_t             utf8Length;
+          UChar              *utf16Text;
+    // last UTF-16 text index mapped to a UTF-8 offset, for sequential lookups
+          int32_t             utf8MapIndex16;
+          int32_t             utf8MapIndex8;
 };
 
 struct UPattern {
@@ -159,6 +168,11 @@ struct UPattern {
           int64_t             pcesBuffer[INITIAL_ARRAY_SIZE_];
           UBool               hasPrefixAccents;
           UBool               hasSuffixAccents;
+    // Horspool bad-character shifts over the primary weights of pces[],
+    // indexed by hashFromPCE().  shift[] is for forward searching and
+    // backShift[] for backward searching.  Built with pces[].
+          UChar               shift[MAX_TABLE_SIZE_];
+          UChar               backShift[MAX_TABLE_SIZE_];
 };
 
 struct UStringSearch {
@@ -272,7 +272,7 @@ utrans_setFilter(UTransliterator* trans,
                  UErrorCode* status) {
 
     utrans_ENTRY(status);
-    UnicodeFilter* filter = nullptr;
+    UnicodeSet* filter = nullptr;
     if (filterPattern != nullptr && *filterPattern != 0) {
         // Create read only alias of filterPattern:
         UnicodeString pat(filterPatternLen < 0, filterPattern, filterPatternLen);
@@ -285,6 +285,8 @@ utrans_setFilter(UTransliterator* trans,
         if (U_FAILURE(*status)) {
             delete filter;
             filter = nullptr;
+        } else {
+            filter->freeze();
         }
     }
     ((Transliterator*) trans)->adoptFilter(filter);
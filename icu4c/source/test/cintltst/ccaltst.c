@@ -74,6 +74,7 @@ void addCalTest(TestNode** root)
     addTest(root, &TestFWWithISO8601, "tsformat/ccaltst/TestFWWithISO8601");
     addTest(root, &TestFWwithRGSD, "tsformat/ccaltst/TestFWwithRGSD");
     addTest(root, &TestGetIanaTimeZoneID, "tstformat/ccaltst/TestGetIanaTimeZoneID");
+    addTest(root, &TestComputeFieldsBatch, "tsformat/ccaltst/TestComputeFieldsBatch");
 }
 
 /* "GMT" */
@@ -2953,4 +2954,59 @@ TestGetIanaTimeZoneID(void) {
     }
 }
 
+void
+TestComputeFieldsBatch(void) {
+    enum { DATE_COUNT = 100 };
+    static const UCalendarDateFields fields[] = {
+        UCAL_ERA, UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_DAY_OF_WEEK, UCAL_HOUR_OF_DAY,
+        UCAL_MINUTE, UCAL_ZONE_OFFSET, UCAL_DST_OFFSET, UCAL_WEEK_OF_YEAR
+    };
+    enum { FIELD_COUNT = UPRV_LENGTHOF(fields) };
+    const char* locales[] = { "en_US", "th_TH@calendar=buddhist" };
+    UDate dates[DATE_COUNT];
+    int32_t values[FIELD_COUNT][DATE_COUNT];
+    int32_t* results[FIELD_COUNT];
+    int32_t i, j, k;
+
+    /* Hourly around the start of daylight saving time in New York on 2026-03-08 */
+    for (i = 0; i < DATE_COUNT; i++) {
+        dates[i] = 1772917200000.0 + i * 3600000.0;
+    }
+    for (j = 0; j < FIELD_COUNT; j++) {
+        results[j] = values[j];
+    }
+    for (k = 0; k < UPRV_LENGTHOF(locales); k++) {
+        UErrorCode status = U_ZERO_ERROR;
+        UCalendar* cal = ucal_open(u"America/New_York", -1, locales[k], UCAL_DEFAULT, &status);
+        UCalendar* each = ucal_open(u"America/New_York", -1, locales[k], UCAL_DEFAULT, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("ucal_open(%s) failed: %s\n", locales[k], u_errorName(status));
+            ucal_close(cal);
+            ucal_close(each);
+            return;
+        }
+        ucal_setMillis(cal, 0.0, &status);
+        ucal_computeFieldsBatch(cal, dates, DATE_COUNT, fields, FIELD_COUNT, results, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucal_computeFieldsBatch(%s) failed: %s\n", locales[k], u_errorName(status));
+        } else {
+            if (ucal_getMillis(cal, &status) != 0.0) {
+                log_err("ucal_computeFieldsBatch(%s) changed the calendar\n", locales[k]);
+            }
+            for (i = 0; i < DATE_COUNT; i++) {
+                ucal_setMillis(each, dates[i], &status);
+                for (j = 0; j < FIELD_COUNT; j++) {
+                    int32_t expected = ucal_get(each, fields[j], &status);
+                    if (values[j][i] != expected) {
+                        log_err("ucal_computeFieldsBatch(%s) field %d of %.0f: %d, ucal_get: %d\n",
+                                locales[k], fields[j], dates[i], values[j][i], expected);
+                    }
+                }
+            }
+        }
+        ucal_close(cal);
+        ucal_close(each);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
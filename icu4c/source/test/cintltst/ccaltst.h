@@ -76,6 +76,10 @@
      * Test ucal_getIanaTimeZoneID()
      */
     static void TestGetIanaTimeZoneID(void);
+    /**
+     * Test ucal_computeFieldsBatch()
+     */
+    static void TestComputeFieldsBatch(void);
 
 /*Internal functions used*/
     /**
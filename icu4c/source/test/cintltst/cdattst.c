@@ -52,6 +52,7 @@ static void TestExtraneousCharacters(void);
 static void TestParseTooStrict(void);
 static void TestHourCycle(void);
 static void TestLocaleNameCrash(void);
+static void TestFormatBatch(void);
 
 void addDateForTest(TestNode** root);
 
@@ -78,6 +79,7 @@ void addDateForTest(TestNode** root)
     TESTCASE(TestParseTooStrict);
     TESTCASE(TestHourCycle);
     TESTCASE(TestLocaleNameCrash);
+    TESTCASE(TestFormatBatch);
 }
 /* Testing the DateFormat API */
 static void TestDateFormat(void)
@@ -2158,4 +2160,78 @@ static void TestLocaleNameCrash(void) {
     udat_close(icudf);
 }
 
+
+static void TestFormatBatch(void) {
+    static const UDate dates[] = {
+        1234567890123.0, 1234567890123.0 + 3600000.0, 1234567890123.0 + 7200000.0,
+        0.0, -1.0, -12219292800000.0, 1710054000000.0
+    };
+    static const struct {
+        const char* locale;
+        const UChar* pattern;
+    } testCases[] = {
+        { "en", u"yyyy-MM-dd HH:mm:ss.SSS" },
+        { "en", u"EEE, MMM d, y h:mm a" },
+        { "ja", u"y年M月d日 EEEE H:mm" },
+        { "ar", u"d/M/y HH:mm" },
+    };
+    const int32_t count = UPRV_LENGTHOF(dates);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(testCases); i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        UDateFormat* df = udat_open(UDAT_PATTERN, UDAT_PATTERN, testCases[i].locale, u"America/New_York", -1,
+                                    testCases[i].pattern, -1, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("udat_open(%s) failed - %s\n", testCases[i].locale, u_errorName(status));
+            continue;
+        }
+        UChar expected[1000];
+        char expected8[1000];
+        int32_t length = 0, length8 = 0;
+        int32_t expectedOffsets[UPRV_LENGTHOF(dates) + 1], expectedOffsets8[UPRV_LENGTHOF(dates) + 1];
+        for (int32_t j = 0; j < count; j++) {
+            int32_t stringLength8;
+            expectedOffsets[j] = length;
+            expectedOffsets8[j] = length8;
+            length += udat_format(df, dates[j], expected + length, UPRV_LENGTHOF(expected) - length, NULL, &status);
+            u_strToUTF8(expected8 + length8, UPRV_LENGTHOF(expected8) - length8, &stringLength8,
+                        expected + expectedOffsets[j], length - expectedOffsets[j], &status);
+            length8 += stringLength8;
+        }
+        expectedOffsets[count] = length;
+        expectedOffsets8[count] = length8;
+
+        // Preflighting
+        int32_t offsets[UPRV_LENGTHOF(dates) + 1];
+        UErrorCode batchStatus = U_ZERO_ERROR;
+        assertIntEquals("udat_formatBatch preflight length", length,
+                        udat_formatBatch(df, dates, count, NULL, 0, offsets, &batchStatus));
+        assertIntEquals("udat_formatBatch preflight status", U_BUFFER_OVERFLOW_ERROR, batchStatus);
+        batchStatus = U_ZERO_ERROR;
+        assertIntEquals("udat_formatBatchUTF8 preflight length", length8,
+                        udat_formatBatchUTF8(df, dates, count, NULL, 0, NULL, &batchStatus));
+        assertIntEquals("udat_formatBatchUTF8 preflight status", U_BUFFER_OVERFLOW_ERROR, batchStatus);
+
+        UChar result[1000];
+        batchStatus = U_ZERO_ERROR;
+        assertIntEquals("udat_formatBatch length", length,
+                        udat_formatBatch(df, dates, count, result, UPRV_LENGTHOF(result), offsets, &batchStatus));
+        assertSuccess("udat_formatBatch", &batchStatus);
+        assertTrue("udat_formatBatch result", u_strncmp(expected, result, length) == 0 && result[length] == 0);
+        for (int32_t j = 0; j <= count; j++) {
+            assertIntEquals("udat_formatBatch offset", expectedOffsets[j], offsets[j]);
+        }
+
+        char result8[1000];
+        batchStatus = U_ZERO_ERROR;
+        assertIntEquals("udat_formatBatchUTF8 length", length8,
+                        udat_formatBatchUTF8(df, dates, count, result8, UPRV_LENGTHOF(result8), offsets, &batchStatus));
+        assertSuccess("udat_formatBatchUTF8", &batchStatus);
+        assertTrue("udat_formatBatchUTF8 result", uprv_strncmp(expected8, result8, length8) == 0 && result8[length8] == 0);
+        for (int32_t j = 0; j <= count; j++) {
+            assertIntEquals("udat_formatBatchUTF8 offset", expectedOffsets8[j], offsets[j]);
+        }
+        udat_close(df);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -82,6 +82,7 @@ static void TestChangingRuleset(void);
 static void TestParseWithEmptyCurr(void);
 static void TestDuration(void);
 static void TestStrictParse(void);
+static void TestParseDoubleBatch(void);
 
 #define TESTCASE(x) addTest(root, &x, "tsformat/cnumtst/" #x)
 
@@ -129,6 +130,7 @@ void addNumForTest(TestNode** root)
     TESTCASE(TestParseWithEmptyCurr);
     TESTCASE(TestDuration);
     TESTCASE(TestStrictParse);
+    TESTCASE(TestParseDoubleBatch);
 }
 
 /* test Parse int 64 */
@@ -3903,4 +3905,50 @@ static void TestStrictParse(void) {
     }
 }
 
+static void TestParseDoubleBatch(void) {
+    static const UChar* const texts[] = { u"1,234.5", u"-7", u"abc", u"12e3" };
+    static const double expected[] = { 1234.5, -7, 0, 12000 };
+    static const int32_t expectedEnds[] = { 7, 2, -1, 4 };
+    double results[4];
+    int32_t parseEnds[4];
+    UErrorCode status = U_ZERO_ERROR;
+    UNumberFormat* nf = unum_open(UNUM_DECIMAL, NULL, 0, "en", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("unum_open(UNUM_DECIMAL, en) failed - %s\n", u_errorName(status));
+        return;
+    }
+    int32_t count = unum_parseDoubleBatch(nf, texts, NULL, 4, results, parseEnds, &status);
+    if (assertSuccess("unum_parseDoubleBatch", &status)) {
+        assertIntEquals("unum_parseDoubleBatch count", 3, count);
+        for (int32_t i = 0; i < 4; i++) {
+            assertDoubleEquals("unum_parseDoubleBatch result", expected[i], results[i]);
+            assertIntEquals("unum_parseDoubleBatch parseEnd", expectedEnds[i], parseEnds[i]);
+        }
+    }
+
+    status = U_ZERO_ERROR;
+    unum_parseDoubleBatch(nf, texts, NULL, -1, results, parseEnds, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("unum_parseDoubleBatch with a negative count: expected U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                u_errorName(status));
+    }
+    unum_close(nf);
+
+    // A rule-based formatter goes through the general parse path.
+    static const UChar* const spelled[] = { u"one hundred" };
+    static const int32_t spelledLengths[] = { -1 };
+    status = U_ZERO_ERROR;
+    nf = unum_open(UNUM_SPELLOUT, NULL, 0, "en", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("unum_open(UNUM_SPELLOUT, en) failed - %s\n", u_errorName(status));
+        return;
+    }
+    count = unum_parseDoubleBatch(nf, spelled, spelledLengths, 1, results, NULL, &status);
+    if (assertSuccess("unum_parseDoubleBatch spellout", &status)) {
+        assertIntEquals("unum_parseDoubleBatch spellout count", 1, count);
+        assertDoubleEquals("unum_parseDoubleBatch spellout result", 100, results[0]);
+    }
+    unum_close(nf);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
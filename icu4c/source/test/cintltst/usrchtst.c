@@ -3055,6 +3055,176 @@ static void TestIndicPrefixMatch(void)
     close();
 }
 
+static int32_t appendUnescaped(UChar *dest, int32_t length, int32_t capacity, const char *s)
+{
+    return length + u_unescape(s, dest + length, capacity - length);
+}
+
+static void checkLongTextMatches(UStringSearch *strsrch, const int32_t *starts,
+                                 const UBool *isVariant, int32_t count,
+                                 UBool variantMatches, const char *name)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i = 0;
+    int32_t match;
+    for (match = usearch_first(strsrch, &status); match != USEARCH_DONE;
+         match = usearch_next(strsrch, &status)) {
+        while (i < count && isVariant[i] && !variantMatches) {
+            ++i;
+        }
+        if (i == count || match != starts[i] || usearch_getMatchedLength(strsrch) != 5) {
+            log_err("%s: unexpected forward match at %d, length %d\n", name,
+                    match, usearch_getMatchedLength(strsrch));
+            return;
+        }
+        ++i;
+    }
+    while (i < count && isVariant[i] && !variantMatches) {
+        ++i;
+    }
+    if (U_FAILURE(status) || i != count) {
+        log_err("%s: forward search missed matches (%s)\n", name, u_errorName(status));
+        return;
+    }
+    i = count - 1;
+    for (match = usearch_last(strsrch, &status); match != USEARCH_DONE;
+         match = usearch_previous(strsrch, &status)) {
+        while (i >= 0 && isVariant[i] && !variantMatches) {
+            --i;
+        }
+        if (i < 0 || match != starts[i]) {
+            log_err("%s: unexpected backward match at %d\n", name, match);
+            return;
+        }
+        --i;
+    }
+    while (i >= 0 && isVariant[i] && !variantMatches) {
+        --i;
+    }
+    if (U_FAILURE(status) || i != -1) {
+        log_err("%s: backward search missed matches (%s)\n", name, u_errorName(status));
+    }
+}
+
+/* Long text with near misses, so that the shift tables have to stop
+   at every candidate position. */
+static void TestLongText(void)
+{
+    UChar text[4096];
+    UChar pattern[8];
+    int32_t starts[64];
+    UBool isVariant[64];
+    int32_t length = 0;
+    int32_t count = 0;
+    int32_t i;
+    UErrorCode status = U_ZERO_ERROR;
+    UStringSearch *strsrch;
+
+    for (i = 0; i < 60; ++i) {
+        length = appendUnescaped(text, length, UPRV_LENGTHOF(text),
+                                 "abab ababd xbabc bcab abac\\u0301 ");
+        if (i % 5 == 0) {
+            starts[count] = length;
+            isVariant[count++] = false;
+            length = appendUnescaped(text, length, UPRV_LENGTHOF(text), "ababc ");
+        }
+        if (i % 7 == 3) {
+            starts[count] = length;
+            isVariant[count++] = true;
+            length = appendUnescaped(text, length, UPRV_LENGTHOF(text), "\\u00C4BABC ");
+        }
+    }
+    u_uastrcpy(pattern, "ababc");
+
+    strsrch = usearch_open(pattern, -1, text, length, "en", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Error opening string search %s\n", u_errorName(status));
+        return;
+    }
+    checkLongTextMatches(strsrch, starts, isVariant, count, false, "tertiary");
+
+    ucol_setStrength(usearch_getCollator(strsrch), UCOL_PRIMARY);
+    usearch_reset(strsrch);
+    checkLongTextMatches(strsrch, starts, isVariant, count, true, "primary");
+
+    usearch_setAttribute(strsrch, USEARCH_ELEMENT_COMPARISON,
+                         USEARCH_PATTERN_BASE_WEIGHT_IS_WILDCARD, &status);
+    checkLongTextMatches(strsrch, starts, isVariant, count, true, "primary wildcard");
+    usearch_close(strsrch);
+}
+
+static void TestUTF8Text(void)
+{
+    /* U+1F600, "café", an ill-formed byte, "cafe" */
+    static const char text[] = "\xF0\x9F\x98\x80 caf\xC3\xA9 \xFF cafe";
+    UChar pattern[8];
+    UChar dummy[] = { 0x78 };
+    UErrorCode status = U_ZERO_ERROR;
+    UStringSearch *strsrch;
+    int32_t length16;
+    int32_t match;
+
+    u_uastrcpy(pattern, "cafe");
+    strsrch = usearch_open(pattern, -1, dummy, 1, "en", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Error opening string search %s\n", u_errorName(status));
+        return;
+    }
+    ucol_setStrength(usearch_getCollator(strsrch), UCOL_PRIMARY);
+    usearch_reset(strsrch);
+    if (usearch_getMatchedStartUTF8(strsrch) != USEARCH_DONE) {
+        log_err("usearch_getMatchedStartUTF8() should fail without UTF-8 text\n");
+    }
+    usearch_setUTF8Text(strsrch, text, -1, &status);
+    if (U_FAILURE(status)) {
+        log_err("usearch_setUTF8Text() failed - %s\n", u_errorName(status));
+        usearch_close(strsrch);
+        return;
+    }
+    usearch_getText(strsrch, &length16);
+    if (length16 != 14) {
+        log_err("usearch_setUTF8Text(): UTF-16 length %d, expected 14\n", length16);
+    }
+
+    match = usearch_first(strsrch, &status);
+    if (match != 3 || usearch_getMatchedStartUTF8(strsrch) != 5 ||
+            usearch_getMatchedLengthUTF8(strsrch) != 5) {
+        log_err("first UTF-8 match: %d -> %d+%d, expected 3 -> 5+5\n", match,
+                usearch_getMatchedStartUTF8(strsrch), usearch_getMatchedLengthUTF8(strsrch));
+    }
+    match = usearch_next(strsrch, &status);
+    if (match != 10 || usearch_getMatchedStartUTF8(strsrch) != 13 ||
+            usearch_getMatchedLengthUTF8(strsrch) != 4) {
+        log_err("second UTF-8 match: %d -> %d+%d, expected 10 -> 13+4\n", match,
+                usearch_getMatchedStartUTF8(strsrch), usearch_getMatchedLengthUTF8(strsrch));
+    }
+    usearch_last(strsrch, &status);
+    match = usearch_previous(strsrch, &status);
+    if (match != 3 || usearch_getMatchedStartUTF8(strsrch) != 5) {
+        log_err("previous UTF-8 match: %d -> %d, expected 3 -> 5\n", match,
+                usearch_getMatchedStartUTF8(strsrch));
+    }
+    if (usearch_following(strsrch, 4, &status) != 10 || usearch_next(strsrch, &status) != USEARCH_DONE ||
+            usearch_getMatchedStartUTF8(strsrch) != USEARCH_DONE ||
+            usearch_getMatchedLengthUTF8(strsrch) != 0) {
+        log_err("UTF-8 search should end after two matches\n");
+    }
+    if (U_FAILURE(status)) {
+        log_err("UTF-8 search failed - %s\n", u_errorName(status));
+    }
+
+    usearch_setText(strsrch, dummy, 1, &status);
+    usearch_first(strsrch, &status);
+    if (usearch_getMatchedStartUTF8(strsrch) != USEARCH_DONE) {
+        log_err("usearch_setText() should forget the UTF-8 text\n");
+    }
+    usearch_setUTF8Text(strsrch, "", -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("usearch_setUTF8Text(\"\") should fail, got %s\n", u_errorName(status));
+    }
+    usearch_close(strsrch);
+}
+
 /**
 * addSearchTest
 */
@@ -3119,6 +3289,8 @@ void addSearchTest(TestNode** root)
     addTest(root, &TestMatchFollowedByIgnorables, "tscoll/usrchtst/TestMatchFollowedByIgnorables");
     addTest(root, &TestIndicPrefixMatch, "tscoll/usrchtst/TestIndicPrefixMatch");
     addTest(root, &TestUInt16Overflow, "tscoll/usrchtst/TestUInt16Overflow");
+    addTest(root, &TestLongText, "tscoll/usrchtst/TestLongText");
+    addTest(root, &TestUTF8Text, "tscoll/usrchtst/TestUTF8Text");
 }
 
 #endif /* #if !UCONFIG_NO_COLLATION */
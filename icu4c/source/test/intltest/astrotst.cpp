@@ -18,6 +18,7 @@
 #include "astrotst.h"
 #include "cmemory.h"
 #include "gregoimp.h" // for Math
+#include "simplethread.h"
 #include "unicode/simpletz.h"
 
 
@@ -37,6 +38,7 @@ void AstroTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
       CASE(3,TestCoverage);
       CASE(4,TestBasics);
       CASE(5,TestMoonAge);
+      CASE(6,TestCalendarCache);
     default: name = ""; break;
     }
 }
@@ -297,6 +299,74 @@ void AstroTest::TestMoonAge(){
 }
 
 
+namespace {
+
+// Static, as in the calendars, which relies on zero-initialization.
+CalendarCache<512> gTestCache;
+
+constexpr int32_t CACHE_THREAD_KEYS = 5000;
+
+// A value that depends on all bits of the key, and is never 0.
+int32_t cacheTestValue(int32_t key) {
+    return key * 7 - 1000003;
+}
+
+}  // namespace
+
+void AstroTest::TestCalendarCache() {
+    static CalendarCache<512> cache;
+    assertEquals("empty cache, key 0", 0, cache.get(0));
+    assertEquals("empty cache, key 17", 0, cache.get(17));
+
+    cache.put(17, 123);
+    cache.put(-17, -456);
+    cache.put(INT32_MAX, INT32_MIN);
+    assertEquals("17", 123, cache.get(17));
+    assertEquals("-17", -456, cache.get(-17));
+    assertEquals("INT32_MAX", INT32_MIN, cache.get(INT32_MAX));
+    assertEquals("missing 18", 0, cache.get(18));
+
+    // A run of consecutive keys does not collide.
+    for (int32_t key = 1900; key < 2100; ++key) {
+        cache.put(key, key * 3);
+    }
+    for (int32_t key = 1900; key < 2100; ++key) {
+        if (cache.get(key) != key * 3) {
+            errln(UnicodeString("consecutive key ") + key + " got " + cache.get(key));
+            break;
+        }
+    }
+
+    // A far-away key evicts the one in its slot but is otherwise a miss.
+    int32_t farKey = 1900 + (1 << 20);
+    assertEquals("far key before put", 0, cache.get(farKey));
+    cache.put(farKey, 99);
+    assertEquals("far key", 99, cache.get(farKey));
+    assertEquals("evicted key", 0, cache.get(1900));
+    assertEquals("neighbor of evicted key", 1901 * 3, cache.get(1901));
+
+    // Concurrent readers and writers only ever see a miss or the right value.
+    ThreadPool<AstroTest> threads(this, 8, &AstroTest::calendarCacheThread);
+    threads.start();
+    threads.join();
+}
+
+void AstroTest::calendarCacheThread(int32_t threadNumber) {
+    for (int32_t round = 0; round < 20; ++round) {
+        for (int32_t i = 0; i < CACHE_THREAD_KEYS; ++i) {
+            // Threads walk the keys in different orders.
+            int32_t key = (i * (threadNumber * 2 + 1) + round * 997) % CACHE_THREAD_KEYS - 1000;
+            int32_t value = gTestCache.get(key);
+            if (value == 0) {
+                gTestCache.put(key, cacheTestValue(key));
+            } else if (value != cacheTestValue(key)) {
+                errln(UnicodeString("thread ") + threadNumber + " key " + key + " got " + value);
+                return;
+            }
+        }
+    }
+}
+
 // TODO: try finding next new moon after  07/28/1984 16:00 GMT
 
 
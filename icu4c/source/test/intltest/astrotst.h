@@ -37,6 +37,9 @@ class AstroTest: public CalendarTimeZoneTest {
     void TestBasics();
     
     void TestMoonAge();
+
+    void TestCalendarCache();
+    void calendarCacheThread(int32_t threadNumber);
  private:
     void init(UErrorCode&);
     void close(UErrorCode&);
@@ -22,10 +22,14 @@
 #include "cstring.h"
 #include "unicode/localpointer.h"
 #include "chnsecal.h"
+#include "dangical.h"
 #include "intltest.h"
 #include "coptccal.h"
 #include "ethpccal.h"
 #include "islamcal.h"
+#include "putilimp.h"
+
+#include <vector>
 
 #define mkcstr(U) u_austrcpy(calloc(8, u_strlen(U) + 1), U)
 
@@ -218,6 +222,9 @@ void CalendarTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(Test22750Roll);
 
     TESTCASE_AUTO(TestChineseCalendarComputeMonthStart);
+    TESTCASE_AUTO(TestChineseCalendarPrecomputedTable);
+    TESTCASE_AUTO(TestIslamicUmalquraMonthStarts);
+    TESTCASE_AUTO(TestComputeFieldsBatch);
     TESTCASE_AUTO(Test22962MonthAddOneOverflow);
 
     TESTCASE_AUTO_END;
@@ -5919,6 +5926,258 @@ void CalendarTest::TestChineseCalendarComputeMonthStart() {  // ICU-22639
                 chinese.hasLeapMonthBetweenWinterSolstices);
 }
 
+namespace {
+
+// Chinese and Dangi calendars that compute everything with the astronomer,
+// without the precomputed table.
+class AstronomerChineseCalendar : public ChineseCalendar {
+public:
+    AstronomerChineseCalendar(UErrorCode& status) : ChineseCalendar(Locale::getRoot(), status) {}
+    AstronomerChineseCalendar* clone() const override { return new AstronomerChineseCalendar(*this); }
+protected:
+    Setting getSetting(UErrorCode& status) const override {
+        Setting setting = ChineseCalendar::getSetting(status);
+        setting.table = nullptr;
+        return setting;
+    }
+};
+
+class AstronomerDangiCalendar : public DangiCalendar {
+public:
+    AstronomerDangiCalendar(UErrorCode& status) : DangiCalendar(Locale::getRoot(), status) {}
+    AstronomerDangiCalendar* clone() const override { return new AstronomerDangiCalendar(*this); }
+protected:
+    Setting getSetting(UErrorCode& status) const override {
+        Setting setting = DangiCalendar::getSetting(status);
+        setting.table = nullptr;
+        return setting;
+    }
+};
+
+}  // namespace
+
+void CalendarTest::TestChineseCalendarPrecomputedTable() {
+    IcuTestErrorCode status(*this, "TestChineseCalendarPrecomputedTable");
+    ChineseCalendar chinese(Locale::getRoot(), status);
+    AstronomerChineseCalendar chineseAstronomer(status);
+    DangiCalendar dangi(Locale::getRoot(), status);
+    AstronomerDangiCalendar dangiAstronomer(status);
+    if (status.errIfFailureAndReset("constructing the calendars")) {
+        return;
+    }
+    struct {
+        Calendar* table;
+        Calendar* astronomer;
+    } pairs[] = {{&chinese, &chineseAstronomer}, {&dangi, &dangiAstronomer}};
+    const UCalendarDateFields fields[] = {
+        UCAL_ERA, UCAL_YEAR, UCAL_EXTENDED_YEAR, UCAL_MONTH, UCAL_ORDINAL_MONTH,
+        UCAL_IS_LEAP_MONTH, UCAL_DATE, UCAL_DAY_OF_YEAR
+    };
+
+    // The table covers 1900..2100; also cross both of its ends.
+    // Check every day in exhaustive mode.
+    GregorianCalendar gc(TimeZone::createTimeZone(u"UTC"), status);
+    gc.clear();
+    gc.set(1899, UCAL_JANUARY, 1);
+    const UDate start = gc.getTime(status);
+    gc.set(2102, UCAL_JANUARY, 1);
+    const UDate limit = gc.getTime(status);
+    const UDate increment = (quick ? 31.0 : 1.0) * U_MILLIS_PER_DAY;
+    for (const auto& pair : pairs) {
+        pair.table->adoptTimeZone(TimeZone::createTimeZone(u"UTC"));
+        pair.astronomer->adoptTimeZone(TimeZone::createTimeZone(u"UTC"));
+        for (UDate date = start; date < limit; date += increment) {
+            pair.table->setTime(date, status);
+            pair.astronomer->setTime(date, status);
+            for (UCalendarDateFields field : fields) {
+                int32_t expected = pair.astronomer->get(field, status);
+                int32_t actual = pair.table->get(field, status);
+                if (expected != actual) {
+                    errln(UnicodeString(pair.table->getType()) + " field " + field +
+                          " of " + date + ": table " + actual + " astronomer " + expected);
+                    return;
+                }
+            }
+            int32_t expected = pair.astronomer->getActualMaximum(UCAL_DATE, status);
+            int32_t actual = pair.table->getActualMaximum(UCAL_DATE, status);
+            if (expected != actual) {
+                errln(UnicodeString(pair.table->getType()) + " month length of " + date +
+                      ": table " + actual + " astronomer " + expected);
+                return;
+            }
+            // Round-trip the fields through each calendar.
+            pair.table->set(UCAL_DATE, 1);
+            pair.astronomer->set(UCAL_DATE, 1);
+            UDate expectedTime = pair.astronomer->getTime(status);
+            UDate actualTime = pair.table->getTime(status);
+            if (expectedTime != actualTime) {
+                errln(UnicodeString(pair.table->getType()) + " month start of " + date +
+                      ": table " + actualTime + " astronomer " + expectedTime);
+                return;
+            }
+            if (status.errIfFailureAndReset("%s at %f", pair.table->getType(), date)) {
+                return;
+            }
+        }
+    }
+}
+
+void CalendarTest::TestIslamicUmalquraMonthStarts() {
+    IcuTestErrorCode status(*this, "TestIslamicUmalquraMonthStarts");
+    LocalPointer<Calendar> cal(Calendar::createInstance(
+        TimeZone::createTimeZone(u"UTC"), Locale("en@calendar=islamic-umalqura"), status));
+    if (status.errIfFailureAndReset("creating the calendar")) {
+        return;
+    }
+    // The month length table covers 1300..1600; also cross both of its ends.
+    // Each month must start the day after the previous one ends, and each
+    // day must compute back to the fields it was set from.
+    const UDate millisPerDay = U_MILLIS_PER_DAY;
+    UDate previousStart = 0;
+    int32_t previousLength = 0;
+    for (int32_t year = 1298; year <= 1602; year++) {
+        for (int32_t month = 0; month < 12; month++) {
+            cal->clear();
+            cal->set(UCAL_EXTENDED_YEAR, year);
+            cal->set(UCAL_MONTH, month);
+            cal->set(UCAL_DATE, 1);
+            UDate start = cal->getTime(status);
+            int32_t length = cal->getActualMaximum(UCAL_DATE, status);
+            if (previousLength != 0 && start != previousStart + previousLength * millisPerDay) {
+                errln(UnicodeString("Month ") + month + " of " + year + " starts at " + start +
+                      ", not after the previous month ending at " +
+                      (previousStart + previousLength * millisPerDay));
+                return;
+            }
+            for (int32_t day = 1; day <= length; day += (quick ? length - 1 : 1)) {
+                cal->setTime(start + (day - 1) * millisPerDay, status);
+                if (cal->get(UCAL_EXTENDED_YEAR, status) != year ||
+                        cal->get(UCAL_MONTH, status) != month ||
+                        cal->get(UCAL_DATE, status) != day) {
+                    errln(UnicodeString("Day ") + day + " of month " + month + " of " + year +
+                          " computes to " + cal->get(UCAL_EXTENDED_YEAR, status) + "/" +
+                          cal->get(UCAL_MONTH, status) + "/" + cal->get(UCAL_DATE, status));
+                    return;
+                }
+            }
+            if (status.errIfFailureAndReset("month %d of %d", month, year)) {
+                return;
+            }
+            previousStart = start;
+            previousLength = length;
+        }
+    }
+}
+
+void CalendarTest::TestComputeFieldsBatch() {
+    IcuTestErrorCode status(*this, "TestComputeFieldsBatch");
+    // Dates around time zone transitions and the Gregorian change,
+    // in ascending order and shuffled, and far from the present.
+    std::vector<UDate> dates;
+    const UDate millisPerDay = U_MILLIS_PER_DAY;
+    for (UDate date = -13000 * millisPerDay * 366; date < 2000 * millisPerDay * 366;
+            date += (quick ? 9973.25 : 997.25) * millisPerDay) {
+        dates.push_back(date);
+    }
+    for (UDate date = -800 * millisPerDay * 366; date < 200 * millisPerDay * 366;
+            date += (quick ? 97.3 : 0.53) * millisPerDay) {
+        dates.push_back(date);
+    }
+    for (int32_t i = 0; i < 2000; ++i) {
+        dates.push_back(dates[(i * 7919) % dates.size()]);
+    }
+    dates.push_back(-1e20);
+    dates.push_back(1e20);
+    dates.push_back(-184303902528000000.0);
+    dates.push_back(183882168921600000.0);
+
+    std::vector<UCalendarDateFields> fields;
+    for (int32_t field = 0; field < UCAL_FIELD_COUNT; ++field) {
+        fields.push_back(static_cast<UCalendarDateFields>(field));
+    }
+    const UCalendarDateFields directFields[] = {
+        UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_HOUR_OF_DAY, UCAL_MINUTE, UCAL_DST_OFFSET
+    };
+
+    const char* locales[] = {"en_US", "en_US@calendar=buddhist", "fr_FR", "ar_EG@calendar=islamic-civil"};
+    const char16_t* zones[] = {u"UTC", u"America/Los_Angeles", u"Australia/Lord_Howe",
+                               u"Europe/London", u"Asia/Kolkata"};
+    for (const char* locale : locales) {
+        for (const char16_t* zoneID : zones) {
+            for (int32_t change = 0; change < 3; ++change) {
+                LocalPointer<Calendar> cal(Calendar::createInstance(
+                    TimeZone::createTimeZone(zoneID), Locale(locale), status));
+                if (status.errIfFailureAndReset("creating %s", locale)) {
+                    return;
+                }
+                GregorianCalendar* gregorian = dynamic_cast<GregorianCalendar*>(cal.getAlias());
+                if (change == 1 && gregorian != nullptr) {
+                    gregorian->setGregorianChange(-1e300, status);  // pure Gregorian
+                } else if (change == 2 && gregorian != nullptr) {
+                    gregorian->setGregorianChange(1e13, status);  // year 2286
+                } else if (change != 0) {
+                    continue;
+                }
+                UDate before = 1234567890123.0;
+                cal->setTime(before, status);
+
+                for (int32_t pass = 0; pass < 2; ++pass) {
+                    int32_t fieldCount = pass == 0 ? static_cast<int32_t>(fields.size()) :
+                        UPRV_LENGTHOF(directFields);
+                    const UCalendarDateFields* batchFields = pass == 0 ? fields.data() : directFields;
+                    std::vector<std::vector<int32_t>> values(fieldCount, std::vector<int32_t>(dates.size()));
+                    std::vector<int32_t*> results;
+                    for (auto& v : values) {
+                        results.push_back(v.data());
+                    }
+                    cal->computeFieldsBatch(dates.data(), static_cast<int32_t>(dates.size()),
+                                            batchFields, fieldCount, results.data(), status);
+                    if (status.errIfFailureAndReset("computeFieldsBatch %s", locale)) {
+                        return;
+                    }
+                    if (cal->getTime(status) != before) {
+                        errln(UnicodeString("computeFieldsBatch changed the calendar for ") + locale);
+                    }
+                    LocalPointer<Calendar> each(cal->clone());
+                    for (size_t i = 0; i < dates.size(); ++i) {
+                        each->setTime(dates[i], status);
+                        for (int32_t j = 0; j < fieldCount; ++j) {
+                            int32_t expected = each->get(batchFields[j], status);
+                            if (values[j][i] != expected) {
+                                errln(UnicodeString(locale) + " " + zoneID + " change " + change +
+                                      " field " + batchFields[j] + " of " + dates[i] + ": batch " +
+                                      values[j][i] + " get " + expected);
+                                return;
+                            }
+                        }
+                    }
+                    status.errIfFailureAndReset();
+                }
+            }
+        }
+    }
+
+    // Errors
+    LocalPointer<Calendar> cal(Calendar::createInstance(Locale::getUS(), status));
+    int32_t value = 0;
+    int32_t* result = &value;
+    UCalendarDateFields field = UCAL_YEAR;
+    UDate date = 0;
+    cal->computeFieldsBatch(&date, -1, &field, 1, &result, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    field = UCAL_FIELD_COUNT;
+    cal->computeFieldsBatch(&date, 1, &field, 1, &result, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    field = UCAL_YEAR;
+    cal->computeFieldsBatch(nullptr, 1, &field, 1, &result, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    cal->computeFieldsBatch(nullptr, 0, nullptr, 0, nullptr, status);
+    status.errIfFailureAndReset("empty batch");
+    date = uprv_getNaN();
+    cal->computeFieldsBatch(&date, 1, &field, 1, &result, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 void CalendarTest::Test22633HebrewLargeNegativeDay() {
     UErrorCode status = U_ZERO_ERROR;
     LocalPointer<Calendar> calendar(
@@ -362,6 +362,9 @@ class CalendarTest: public CalendarTimeZoneTest {
     void TestFirstDayOfWeek();
 
     void TestChineseCalendarComputeMonthStart();
+    void TestChineseCalendarPrecomputedTable();
+    void TestIslamicUmalquraMonthStarts();
+    void TestComputeFieldsBatch();
     void Test22633HebrewLargeNegativeDay();
     void Test23069HebrewHanukkah();
 
@@ -142,6 +142,9 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestLongLocale);
     TESTCASE_AUTO(TestChineseCalendar23043);
     TESTCASE_AUTO(TestAmPmLengths23114);
+    TESTCASE_AUTO(TestNumericPatternFormat);
+    TESTCASE_AUTO(TestNumericPatternFormatProleptic);
+    TESTCASE_AUTO(TestFormatBatch);
 
     TESTCASE_AUTO_END;
 }
@@ -6037,6 +6040,159 @@ void DateFormatTest::TestAmPmLengths23114() {
     assertEquals("DateFormatSymbols narrow after set", u"am!", borrowedAmPm[0]);
 }
 
+// Numeric Gregorian patterns are formatted from a UDate without going through
+// the Calendar; the result and the field positions must be the same as when
+// formatting the Calendar.
+void DateFormatTest::TestNumericPatternFormat() {
+    IcuTestErrorCode status(*this, "TestNumericPatternFormat");
+    static const char* const localeIDs[] = {
+        "en", "ar", "fa", "th-u-nu-thai", "hi-u-nu-deva", "ja", "en-u-ca-iso8601"
+    };
+    static const char16_t* const patterns[] = {
+        u"yyyy-MM-dd'T'HH:mm:ss.SSS", u"y/M/d H:m:s", u"yy.MM.dd", u"D k K h",
+        u"uuuu-MM-dd HH:mm:ss.SSSSSS", u"dd 'o''clock' hh:mm", u"yyyyy-LL-d S",
+    };
+    static const char* const zoneIDs[] = { "GMT", "America/New_York", "Australia/Lord_Howe" };
+    static const UDate dates[] = {
+        0.0, -1.0, 1234567890123.0, 1234567890123.75, -12219292800000.0 + 366.0 * U_MILLIS_PER_DAY,
+        -62135596800000.0, 253402300799999.0, 1710054000000.0, 1730613600000.0 - 1.0
+    };
+    for (const char* localeID : localeIDs) {
+        for (const char16_t* pattern : patterns) {
+            SimpleDateFormat fmt(pattern, Locale(localeID), status);
+            if (status.errDataIfFailureAndReset("new SimpleDateFormat")) {
+                return;
+            }
+            for (const char* zoneID : zoneIDs) {
+                fmt.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                LocalPointer<Calendar> cal(fmt.getCalendar()->clone());
+                for (UDate date : dates) {
+                    UnicodeString message = UnicodeString(localeID) + u" " + pattern + u" " +
+                        zoneID + u" " + date;
+                    cal->setTime(date, status);
+                    FieldPosition calPos(DateFormat::kMinuteField);
+                    UnicodeString expected;
+                    fmt.format(*cal, expected, calPos);
+                    FieldPosition pos(DateFormat::kMinuteField);
+                    UnicodeString actual;
+                    fmt.format(date, actual, pos);
+                    assertEquals(message, expected, actual);
+                    assertEquals(message + u" begin", calPos.getBeginIndex(), pos.getBeginIndex());
+                    assertEquals(message + u" end", calPos.getEndIndex(), pos.getEndIndex());
+                }
+            }
+        }
+    }
+
+    // The compiled pattern must follow pattern changes.
+    SimpleDateFormat fmt(u"yyyy", Locale::getEnglish(), status);
+    fmt.adoptTimeZone(TimeZone::createTimeZone("GMT"));
+    UnicodeString result;
+    assertEquals("yyyy", u"1970", fmt.format(0.0, result));
+    fmt.applyLocalizedPattern(u"HH:mm", status);
+    assertEquals("applyLocalizedPattern", u"00:00", fmt.format(0.0, result.remove()));
+    fmt.applyPattern(u"MMM d");
+    assertEquals("applyPattern", u"Jan 1", fmt.format(0.0, result.remove()));
+    ParsePosition pp(0);
+    UDate date = fmt.parse(u"Feb 2", pp);
+    assertEquals("parse index", 5, pp.getIndex());
+    LocalPointer<Calendar> cal(fmt.getCalendar()->clone());
+    cal->setTime(date, status);
+    assertEquals("parsed month", UCAL_FEBRUARY, cal->get(UCAL_MONTH, status));
+}
+
+// With a pure Gregorian calendar, the fast path must leave years of the BC era,
+// which have extended years <= 0, to the Calendar.
+void DateFormatTest::TestNumericPatternFormatProleptic() {
+    IcuTestErrorCode status(*this, "TestNumericPatternFormatProleptic");
+    SimpleDateFormat fmt(u"yyyy-MM-dd", Locale::getEnglish(), status);
+    if (status.errDataIfFailureAndReset("new SimpleDateFormat")) {
+        return;
+    }
+    LocalPointer<GregorianCalendar> cal(
+        new GregorianCalendar(TimeZone::getGMT()->clone(), Locale::getEnglish(), status), status);
+    if (status.errIfFailureAndReset("new GregorianCalendar")) {
+        return;
+    }
+    cal->setGregorianChange(-1e17, status);
+    fmt.setCalendar(*cal);
+    static const struct {
+        UDate date;
+        const char16_t* expected;
+    } cases[] = {
+        { -62135596800000.0, u"0001-01-01" },  // AD 1
+        { -62167219200000.0, u"0001-01-01" },  // 1 BC
+        { -62167219200000.0 - 1.0, u"0002-12-31" },  // 2 BC
+        { -62325072000000.0, u"0007-12-31" },  // 7 BC
+    };
+    UDate dates[UPRV_LENGTHOF(cases)];
+    UnicodeString expectedBatch;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UnicodeString actual;
+        fmt.format(cases[i].date, actual);
+        assertEquals(UnicodeString(u"format ") + cases[i].date, cases[i].expected, actual);
+        dates[i] = cases[i].date;
+        expectedBatch.append(cases[i].expected);
+    }
+    UnicodeString actualBatch;
+    fmt.formatBatch(dates, UPRV_LENGTHOF(dates), actualBatch, nullptr, status);
+    status.errIfFailureAndReset("formatBatch");
+    assertEquals("formatBatch", expectedBatch, actualBatch);
+}
+
+void DateFormatTest::TestFormatBatch() {
+    IcuTestErrorCode status(*this, "TestFormatBatch");
+    static const UDate dates[] = {
+        1234567890123.0, 1234567890123.0 + 60000.0, 1234567890123.0 + 3600000.0,
+        1234567890123.0 + 86400000.0, 0.0, -1.0, -12219292800000.0, 1710054000000.0
+    };
+    static const int32_t count = UPRV_LENGTHOF(dates);
+    LocalPointer<DateFormat> formats[] = {
+        LocalPointer<DateFormat>(new SimpleDateFormat(u"yyyy-MM-dd HH:mm:ss.SSS", Locale::getEnglish(), status)),
+        LocalPointer<DateFormat>(new SimpleDateFormat(u"EEEE, d MMMM y h:mm a zzzz", Locale::getFrench(), status)),
+        LocalPointer<DateFormat>(new SimpleDateFormat(u"y-MM-dd", Locale("ar"), status)),
+        LocalPointer<DateFormat>(DateFormat::createDateTimeInstance(
+            DateFormat::kFull, DateFormat::kShort, Locale("ja@calendar=japanese"))),
+        LocalPointer<DateFormat>(DateFormat::createDateInstance(
+            DateFormat::kMediumRelative, Locale::getEnglish())),
+    };
+    if (status.errDataIfFailureAndReset("new SimpleDateFormat")) {
+        return;
+    }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(formats); i++) {
+        if (formats[i].isNull()) {
+            dataerrln("Unable to create DateFormat %d", i);
+            continue;
+        }
+        formats[i]->adoptTimeZone(TimeZone::createTimeZone("America/Los_Angeles"));
+        UnicodeString expected(u"prefix");
+        int32_t expectedOffsets[count + 1];
+        for (int32_t j = 0; j < count; j++) {
+            expectedOffsets[j] = expected.length();
+            formats[i]->format(dates[j], expected);
+        }
+        expectedOffsets[count] = expected.length();
+
+        UnicodeString actual(u"prefix");
+        int32_t offsets[count + 1];
+        formats[i]->formatBatch(dates, count, actual, offsets, status);
+        status.errIfFailureAndReset("formatBatch %d", i);
+        assertEquals(UnicodeString(u"formatBatch ") + i, expected, actual);
+        for (int32_t j = 0; j <= count; j++) {
+            assertEquals(UnicodeString(u"offset ") + i + u" " + j, expectedOffsets[j], offsets[j]);
+        }
+        // The batch does not disturb the formatter, and offsets are optional.
+        assertEquals(UnicodeString(u"formatBatch nullptr offsets ") + i, expected,
+                     formats[i]->formatBatch(dates, count, actual.setTo(u"prefix"), nullptr, status));
+    }
+    UnicodeString result;
+    formats[0]->formatBatch(nullptr, 1, result, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, "nullptr dates");
+    formats[0]->formatBatch(dates, -1, result, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, "negative count");
+    assertEquals("empty batch", u"", formats[0]->formatBatch(dates, 0, result, nullptr, status));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
@@ -274,6 +274,9 @@ class DateFormatTest: public CalendarTimeZoneTest {
     void TestLongLocale();
     void TestChineseCalendar23043();
     void TestAmPmLengths23114();
+    void TestNumericPatternFormat();
+    void TestNumericPatternFormatProleptic();
+    void TestFormatBatch();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
@@ -25,9 +25,21 @@
 #include "cstring.h"
 #include "scriptset.h"
 #include "uhash.h"
+#include "uspoof_impl.h"
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string toUTF8(const UnicodeString &s) {
+    std::string result;
+    return s.toUTF8String(result);
+}
+
+}  // namespace
 
 #define TEST_ASSERT_SUCCESS(status) UPRV_BLOCK_MACRO_BEGIN { \
     if (U_FAILURE(status)) { \
@@ -109,6 +121,8 @@ void IntlTestSpoof::runIndexedTest( int32_t index, UBool exec, const char* &name
     TESTCASE_AUTO(testBug13314_MixedNumbers);
     TESTCASE_AUTO(testBug13328_MixedCombiningMarks);
     TESTCASE_AUTO(testCombiningDot);
+    TESTCASE_AUTO(testSkeletonUTF8);
+    TESTCASE_AUTO(testSkeletonIndex);
     TESTCASE_AUTO_END;
 }
 
@@ -263,6 +277,19 @@ void IntlTestSpoof::checkSkeleton(const USpoofChecker *sc, uint32_t type,
         errln(UnicodeString(" Actual   Skeleton: \"") + actual + UnicodeString("\"\n") +
               UnicodeString(" Expected Skeleton: \"") + uExpected + UnicodeString("\""));
     }
+
+    std::string actualUTF8;
+    StringByteSink<std::string> sink(&actualUTF8);
+    uspoof_getSkeletonByteSink(sc, toUTF8(uInput), sink, &status);
+    if (U_FAILURE(status)) {
+        errln("File %s, Line %d, Test case from line %d, status is %s", __FILE__, __LINE__, lineNum,
+              u_errorName(status));
+        return;
+    }
+    if (toUTF8(uExpected) != actualUTF8) {
+        errln("File %s, Line %d, Test case from line %d, Actual and Expected UTF-8 skeletons differ.",
+               __FILE__, __LINE__, lineNum);
+    }
 }
 
 //
@@ -432,6 +459,31 @@ void IntlTestSpoof::testConfData() {
     LocalUSpoofCheckerPointer sc(uspoof_open(&status));
     TEST_ASSERT_SUCCESS(status);
 
+    // A checker for the same data without the trie, as in data from before ICU 79,
+    // to check the trie against the binary search of the keys.
+    int32_t dataLength = uspoof_serialize(sc.getAlias(), nullptr, 0, &status);
+    TEST_ASSERT_EQ(status, U_BUFFER_OVERFLOW_ERROR);
+    status = U_ZERO_ERROR;
+    std::vector<int32_t> noTrieData(dataLength / 4);  // aligned for the header
+    uspoof_serialize(sc.getAlias(), noTrieData.data(), dataLength, &status);
+    TEST_ASSERT_SUCCESS(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    SpoofDataHeader *header = reinterpret_cast<SpoofDataHeader *>(noTrieData.data());
+    TEST_ASSERT(header->fCFUTrie != 0);
+    header->fCFUTrie = 0;
+    header->fCFUTrieLength = 0;
+    LocalUSpoofCheckerPointer scNoTrie(
+        uspoof_openFromSerialized(noTrieData.data(), dataLength, nullptr, &status));
+    TEST_ASSERT_SUCCESS(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    std::vector<std::string> ids;
+    std::string expectedSkeletons;
+    std::vector<int32_t> expectedLimits;
+
     // Parse lines from the confusables.txt file.  Example Line:
     // FF44 ;	0064 ;	SL	# ( d -> d ) FULLWIDTH ....
     // Three fields.  The hex fields can contain more than one character,
@@ -487,10 +539,41 @@ void IntlTestSpoof::testConfData() {
             }
             errln(line);
         }
+
+        UnicodeString actualNoTrie;
+        uspoof_getSkeletonUnicodeString(scNoTrie.getAlias(), skeletonType, from, actualNoTrie, &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(actualNoTrie == actual);
+
+        ids.push_back(toUTF8(from));
+        std::string actualUTF8;
+        StringByteSink<std::string> sink(&actualUTF8);
+        uspoof_getSkeletonByteSink(sc.getAlias(), ids.back(), sink, &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(actualUTF8 == toUTF8(actual));
+        expectedSkeletons.append(actualUTF8);
+        expectedLimits.push_back(static_cast<int32_t>(expectedSkeletons.length()));
         if (U_FAILURE(status)) {
             break;
         }
     }
+
+    // All of the identifiers at once.
+    std::vector<StringPiece> pieces(ids.begin(), ids.end());
+    int32_t count = static_cast<int32_t>(pieces.size());
+    std::vector<int32_t> limits(count);
+    int32_t length = uspoof_getSkeletonBatchUTF8(sc.getAlias(), pieces.data(), count,
+                                                 nullptr, 0, limits.data(), &status);
+    TEST_ASSERT_EQ(status, U_BUFFER_OVERFLOW_ERROR);
+    TEST_ASSERT_EQ(length, static_cast<int32_t>(expectedSkeletons.length()));
+    status = U_ZERO_ERROR;
+    std::string skeletons(length + 1, '\0');
+    length = uspoof_getSkeletonBatchUTF8(sc.getAlias(), pieces.data(), count,
+                                         &skeletons[0], length + 1, limits.data(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    skeletons.resize(length);
+    TEST_ASSERT(skeletons == expectedSkeletons);
+    TEST_ASSERT(limits == expectedLimits);
 }
 
 
@@ -846,4 +929,203 @@ void IntlTestSpoof::testCombiningDot() {
     }
 }
 
+void IntlTestSpoof::testSkeletonUTF8() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("uspoof_open", status)) {
+        return;
+    }
+    const char *ids[] = {
+        "",
+        "paypal",
+        "pa\xD1\x83" "pal",             // Cyrillic u
+        "so\xC2\xAD" "ft",              // soft hyphen is Default_Ignorable
+        "\xC3\x85ngstr\xC3\xB6m",       // needs NFD
+        "\xF0\x9D\x90\x80" "bc",        // U+1D400 MATHEMATICAL BOLD CAPITAL A
+        "ill\xFF" "formed\xE0\x80",     // ill-formed UTF-8
+        "\xE4\xBE\x8B\xE3\x81\x88",     // 例え
+    };
+    std::string expectedSkeletons;
+    std::vector<int32_t> expectedLimits;
+    for (const char *id : ids) {
+        UnicodeString skeleton;
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, UnicodeString::fromUTF8(id), skeleton, &status);
+        std::string expected = toUTF8(skeleton);
+
+        std::string actual;
+        StringByteSink<std::string> sink(&actual);
+        uspoof_getSkeletonByteSink(sc.getAlias(), id, sink, &status);
+        assertSuccess(id, status);
+        assertEquals(id, expected.c_str(), actual.c_str());
+
+        char buffer[100];
+        int32_t length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, id, -1, buffer, UPRV_LENGTHOF(buffer), &status);
+        assertSuccess(id, status);
+        assertEquals(id, expected.c_str(), std::string(buffer, length).c_str());
+
+        expectedSkeletons.append(expected);
+        expectedLimits.push_back(static_cast<int32_t>(expectedSkeletons.length()));
+    }
+    assertEquals("soft hyphen removed", "soft", expectedSkeletons.substr(expectedLimits[2], 4).c_str());
+
+    StringPiece pieces[UPRV_LENGTHOF(ids)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+        pieces[i] = ids[i];
+    }
+    int32_t limits[UPRV_LENGTHOF(ids)];
+    char buffer[200];
+    int32_t length = uspoof_getSkeletonBatchUTF8(sc.getAlias(), pieces, UPRV_LENGTHOF(ids),
+                                                 buffer, UPRV_LENGTHOF(buffer), limits, &status);
+    assertSuccess("batch", status);
+    assertEquals("batch", expectedSkeletons.c_str(), std::string(buffer, length).c_str());
+    assertEquals("batch NUL-terminated", 0, buffer[length]);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+        assertEquals(ids[i], expectedLimits[i], limits[i]);
+    }
+
+    // Overflow in the middle: The limits are still all set.
+    uprv_memset(limits, 0, sizeof(limits));
+    length = uspoof_getSkeletonBatchUTF8(sc.getAlias(), pieces, UPRV_LENGTHOF(ids),
+                                         buffer, 10, limits, &status);
+    assertEquals("batch overflow", U_BUFFER_OVERFLOW_ERROR, status);
+    assertEquals("batch overflow length", static_cast<int32_t>(expectedSkeletons.length()), length);
+    assertEquals("batch overflow prefix", expectedSkeletons.substr(0, 10).c_str(),
+                 std::string(buffer, 10).c_str());
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+        assertEquals(ids[i], expectedLimits[i], limits[i]);
+    }
+
+    status = U_ZERO_ERROR;
+    uspoof_getSkeletonBatchUTF8(sc.getAlias(), pieces, UPRV_LENGTHOF(ids),
+                                nullptr, 10, limits, &status);
+    assertEquals("batch nullptr buffer", U_ILLEGAL_ARGUMENT_ERROR, status);
+}
+
+void IntlTestSpoof::testSkeletonIndex() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    SpoofSkeletonIndex index(sc.getAlias(), status);
+    if (!assertSuccess("SpoofSkeletonIndex", status)) {
+        return;
+    }
+    assertEquals("empty", 0, index.size());
+    assertFalse("empty isConfusable", index.isConfusableUTF8("paypal", status));
+    assertTrue("add paypal", index.addUTF8("paypal", status));
+    assertFalse("add Cyrillic paypal", index.addUTF8("pa\xD1\x83" "pal", status));
+    assertFalse("add paypal again", index.add(u"paypal", status));
+    assertTrue("add microsoft", index.add(u"microsoft", status));
+    assertSuccess("add", status);
+    assertEquals("size", 2, index.size());
+    assertTrue("paypal", index.isConfusable(u"paypal", status));
+    assertTrue("Cyrillic paypal", index.isConfusable(u"pa\u0443pal", status));
+    assertTrue("rnicrosoft", index.isConfusableUTF8("rnicrosoft", status));
+    assertTrue("soft hyphen", index.isConfusableUTF8("pay\xC2\xAD" "pal", status));
+    assertFalse("alice", index.isConfusableUTF8("alice", status));
+    assertFalse("empty string", index.isConfusableUTF8("", status));
+    assertSuccess("isConfusable", status);
+
+    // Grow the table many times.
+    constexpr int32_t count = 20000;
+    char id[32];
+    for (int32_t i = 0; i < count; ++i) {
+        snprintf(id, sizeof(id), "user%d", static_cast<int>(i));
+        if (!index.addUTF8(id, status)) {
+            errln("add(%s) returned false", id);
+            break;
+        }
+    }
+    assertSuccess("add many", status);
+    assertEquals("size after adding many", count + 2, index.size());
+    for (int32_t i = 0; i < count; ++i) {
+        snprintf(id, sizeof(id), "user%d", static_cast<int>(i));
+        if (!index.isConfusableUTF8(id, status)) {
+            errln("isConfusable(%s) returned false", id);
+            break;
+        }
+        snprintf(id, sizeof(id), "other%d", static_cast<int>(i));
+        if (index.isConfusableUTF8(id, status)) {
+            errln("isConfusable(%s) returned true", id);
+            break;
+        }
+    }
+    // 0 vs. O and 1 vs. l have the same skeletons.
+    assertTrue("userlO", index.isConfusableUTF8("userlO", status));
+
+    // Serialize, with preflighting, into an 8-aligned buffer.
+    int32_t length = index.serialize(nullptr, 0, status);
+    assertEquals("serialize preflight", U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    std::vector<uint64_t> data((length + 7) / 8);
+    assertEquals("serialize", length, index.serialize(data.data(), length, status));
+    assertSuccess("serialize", status);
+    const std::vector<uint64_t> original(data);
+
+    SpoofSkeletonIndex loaded(sc.getAlias(), data.data(), length, status);
+    if (!assertSuccess("SpoofSkeletonIndex(serialized)", status)) {
+        return;
+    }
+    assertEquals("loaded size", index.size(), loaded.size());
+    assertTrue("loaded paypal", loaded.isConfusableUTF8("pa\xD1\x83" "pal", status));
+    assertTrue("loaded user123", loaded.isConfusableUTF8("user123", status));
+    assertFalse("loaded alice", loaded.isConfusableUTF8("alice", status));
+    // The first add() copies the aliased data.
+    assertTrue("loaded add alice", loaded.addUTF8("alice", status));
+    assertSuccess("loaded", status);
+    assertTrue("loaded alice after add", loaded.isConfusableUTF8("alice", status));
+    assertEquals("loaded size after add", index.size() + 1, loaded.size());
+    assertTrue("serialized data unchanged", data == original);
+    assertFalse("original index unchanged", index.isConfusableUTF8("alice", status));
+
+    // Invalid serialized data.
+    {
+        status = U_ZERO_ERROR;
+        SpoofSkeletonIndex truncated(sc.getAlias(), data.data(), length - 8, status);
+        assertEquals("truncated", U_INVALID_FORMAT_ERROR, status);
+        assertEquals("truncated size", 0, truncated.size());
+        status = U_ZERO_ERROR;
+        assertFalse("truncated add", truncated.addUTF8("alice", status));
+        assertEquals("truncated add", U_INVALID_STATE_ERROR, status);
+
+        status = U_ZERO_ERROR;
+        data[0] ^= 1;  // magic number
+        SpoofSkeletonIndex badMagic(sc.getAlias(), data.data(), length, status);
+        assertEquals("bad magic", U_INVALID_FORMAT_ERROR, status);
+        data[0] ^= 1;
+
+        status = U_ZERO_ERROR;
+        data[3] ^= 1;  // fingerprint of the confusables data
+        SpoofSkeletonIndex otherData(sc.getAlias(), data.data(), length, status);
+        assertEquals("other confusables data", U_INVALID_FORMAT_ERROR, status);
+        data[3] ^= 1;
+
+        status = U_ZERO_ERROR;
+        SpoofSkeletonIndex misaligned(sc.getAlias(), reinterpret_cast<char *>(data.data()) + 4,
+                                      length - 4, status);
+        assertEquals("misaligned", U_ILLEGAL_ARGUMENT_ERROR, status);
+
+        status = U_ZERO_ERROR;
+        SpoofSkeletonIndex reloaded(sc.getAlias(), data.data(), length, status);
+        assertSuccess("reloaded", status);
+    }
+
+    // Corrupt serialized data without any empty slot must not make probing hang.
+    {
+        std::vector<uint64_t> full(data);
+        for (size_t i = 4; i < full.size(); ++i) {  // after the 32-byte header
+            full[i] = i;
+        }
+        status = U_ZERO_ERROR;
+        SpoofSkeletonIndex corrupt(sc.getAlias(), full.data(), length, status);
+        assertSuccess("no empty slot", status);
+        corrupt.isConfusableUTF8("alice", status);
+        assertSuccess("no empty slot isConfusable", status);
+        assertFalse("no empty slot add", corrupt.addUTF8("alice", status));
+        assertEquals("no empty slot add", U_INVALID_FORMAT_ERROR, status);
+    }
+
+    status = U_ZERO_ERROR;
+    index.serialize(nullptr, 10, status);
+    assertEquals("serialize nullptr buffer", U_ILLEGAL_ARGUMENT_ERROR, status);
+}
+
 #endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FILE_IO */
@@ -60,6 +60,10 @@ class IntlTestSpoof: public IntlTest {
 
     void testCombiningDot();
 
+    void testSkeletonUTF8();
+
+    void testSkeletonIndex();
+
     // Internal functions to run a single skeleton test case.
     void checkSkeleton(const USpoofChecker *sc, uint32_t flags, const char *input, const char *expected,
                        int32_t lineNum);
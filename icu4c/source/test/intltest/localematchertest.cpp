@@ -16,6 +16,7 @@
 #include "intltest.h"
 #include "localeprioritylist.h"
 #include "ucbuf.h"
+#include "umutex.h"
 
 #define ARRAY_RANGE(array) (array), ((array) + UPRV_LENGTHOF(array))
 
@@ -64,6 +65,9 @@ class LocaleMatcherTest : public IntlTest {
     void testMaxDistanceAndIsMatch();
     void testMatch();
     void testResolvedLocale();
+    void testManySupportedLocales();
+    void testListStringCache();
+    void testListStringCacheLifetime();
     void testDataDriven();
 
 private:
@@ -90,6 +94,9 @@ void LocaleMatcherTest::runIndexedTest(int32_t index, UBool exec, const char *&n
     TESTCASE_AUTO(testMaxDistanceAndIsMatch);
     TESTCASE_AUTO(testMatch);
     TESTCASE_AUTO(testResolvedLocale);
+    TESTCASE_AUTO(testManySupportedLocales);
+    TESTCASE_AUTO(testListStringCache);
+    TESTCASE_AUTO(testListStringCacheLifetime);
     TESTCASE_AUTO(testDataDriven);
     TESTCASE_AUTO_END;
 }
@@ -441,6 +448,184 @@ void LocaleMatcherTest::testMatch() {
                matchZh == 0.0 && matchEnHantTw == 0.0); // with changes in CLDR-1435
 }
 
+namespace {
+
+// Some available locales, with many regional variants of a few languages,
+// as in a large application's supported locales.
+const char *const manySupported[] = {
+    "en", "en-GB", "en-AU", "en-CA", "en-IN", "en-IE", "en-NZ", "en-ZA", "en-001", "en-150",
+    "es", "es-419", "es-MX", "es-AR", "es-US", "es-CO", "fr", "fr-CA", "fr-CH", "fr-BE",
+    "de", "de-AT", "de-CH", "it", "pt", "pt-PT", "pt-AO", "nl", "nl-BE", "sv", "da", "nb", "nn",
+    "fi", "is", "pl", "cs", "sk", "hu", "ro", "hr", "sr", "sr-Latn", "bs", "sl", "bg", "ru",
+    "uk", "be", "el", "tr", "he", "ar", "ar-EG", "ar-SA", "ar-MA", "fa", "ur", "hi", "bn", "ta",
+    "te", "mr", "gu", "kn", "ml", "pa", "th", "vi", "id", "ms", "fil", "zh", "zh-Hant",
+    "zh-Hant-HK", "zh-Hans-SG", "ja", "ko", "sw", "am", "zu", "af", "ca", "eu", "gl", "et",
+    "lv", "lt", "ka", "hy", "az", "kk", "uz", "mn", "km", "lo", "my", "ne", "si"
+};
+
+const char *const manyDesired[] = {
+    "en", "en-US", "en-GB", "en-DE", "en-Latn-SG", "es-ES", "es-CL", "es-419", "fr-LU",
+    "pt-BR", "pt-MZ", "de-LI", "de-Latn-AT", "gsw", "nb-NO", "no", "nn-NO", "da-GL", "sr-ME",
+    "sr-Cyrl-BA", "sh", "hr-BA", "zh-TW", "zh-HK", "zh-MO", "zh-CN", "zh-Hant-CN", "yue",
+    "ja-JP", "ko-KP", "ar-AE", "arz", "fa-AF", "prs", "hi-Latn", "ur-IN", "ta-LK", "ms-Arab",
+    "id-ID", "in", "iw", "tl", "fil-PH", "ca-ES-valencia", "eu-FR", "ru-UA", "uk-RU", "be-Latn",
+    "ku", "xx", "und", "und-TW", "und-Cyrl", "und-Arab-PK", "mo", "zu-ZA", "sw-KE", "af-NA",
+    "kk-Arab", "uz-Arab", "mn-Mong", "my-MM", "si-LK", "ga", "cy", "lb", "fy", "ht"
+};
+
+}  // namespace
+
+void LocaleMatcherTest::testManySupportedLocales() {
+    IcuTestErrorCode errorCode(*this, "testManySupportedLocales");
+    // With many supported locales, the matcher groups them by language;
+    // the best match must still be one with the highest match score,
+    // and ties must be broken as without the grouping.
+    // (With only two-way matches, the reverse check uses the best distance so far,
+    // so the single-pair scores do not tell which one is best.)
+    static const struct {
+        ULocMatchFavorSubtag favor;
+        ULocMatchDirection direction;
+        const char *desired;
+        const char *expected;
+    } expectations[] = {
+        { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_DIRECTION_WITH_ONE_WAY, "en-DE", "en_GB" },
+        { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_DIRECTION_WITH_ONE_WAY, "gsw", "de_CH" },
+        { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_DIRECTION_WITH_ONE_WAY, "yue", "zh_Hant_HK" },
+        { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_DIRECTION_WITH_ONE_WAY, "ga", "en_IE" },
+        { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_DIRECTION_ONLY_TWO_WAY, "gsw", "en" },
+        { ULOCMATCH_FAVOR_SCRIPT, ULOCMATCH_DIRECTION_WITH_ONE_WAY, "cy", "en_GB" },
+        { ULOCMATCH_FAVOR_SCRIPT, ULOCMATCH_DIRECTION_ONLY_TWO_WAY, "en-DE", "en_GB" },
+        { ULOCMATCH_FAVOR_SCRIPT, ULOCMATCH_DIRECTION_ONLY_TWO_WAY, "gsw", "fr_CH" },
+        { ULOCMATCH_FAVOR_SCRIPT, ULOCMATCH_DIRECTION_ONLY_TWO_WAY, "yue", "zh_Hant" },
+        { ULOCMATCH_FAVOR_SCRIPT, ULOCMATCH_DIRECTION_ONLY_TWO_WAY, "ga", "en" },
+    };
+    std::vector<Locale> supported;
+    for (const char *tag : manySupported) {
+        supported.push_back(Locale::forLanguageTag(tag, errorCode));
+    }
+    for (ULocMatchFavorSubtag favor : { ULOCMATCH_FAVOR_LANGUAGE, ULOCMATCH_FAVOR_SCRIPT }) {
+        for (ULocMatchDirection direction :
+                { ULOCMATCH_DIRECTION_WITH_ONE_WAY, ULOCMATCH_DIRECTION_ONLY_TWO_WAY }) {
+            LocaleMatcher matcher = LocaleMatcher::Builder().
+                setSupportedLocales(supported.begin(), supported.end()).
+                setFavorSubtag(favor).
+                setDirection(direction).
+                build(errorCode);
+            if (errorCode.errIfFailureAndReset("build(favor %d direction %d)",
+                                               static_cast<int>(favor),
+                                               static_cast<int>(direction))) {
+                continue;
+            }
+            for (const char *tag : manyDesired) {
+                Locale desired = Locale::forLanguageTag(tag, errorCode);
+                const Locale *best = matcher.getBestMatch(desired, errorCode);
+                if (errorCode.errIfFailureAndReset("getBestMatch(%s)", tag)) { continue; }
+                if (direction == ULOCMATCH_DIRECTION_ONLY_TWO_WAY) { continue; }
+                double bestScore = matcher.internalMatch(desired, *best, errorCode);
+                for (const Locale &locale : supported) {
+                    double score = matcher.internalMatch(desired, locale, errorCode);
+                    if (score > bestScore) {
+                        errln("favor %d direction %d: %s matched %s (%g) but %s is closer (%g)",
+                              static_cast<int>(favor), static_cast<int>(direction), tag,
+                              best->getName(), bestScore, locale.getName(), score);
+                        break;
+                    }
+                }
+            }
+            for (const auto &exp : expectations) {
+                if (exp.favor == favor && exp.direction == direction) {
+                    const Locale *best = matcher.getBestMatch(Locale(exp.desired), errorCode);
+                    assertEquals(UnicodeString(u"favor ") + favor + u" direction " + direction +
+                                 u" " + UnicodeString(exp.desired, -1, US_INV),
+                                 exp.expected, locString(best));
+                }
+            }
+        }
+    }
+}
+
+void LocaleMatcherTest::testListStringCache() {
+    IcuTestErrorCode errorCode(*this, "testListStringCache");
+    std::vector<Locale> supported;
+    for (const char *tag : manySupported) {
+        supported.push_back(Locale::forLanguageTag(tag, errorCode));
+    }
+    LocaleMatcher matcher = LocaleMatcher::Builder().
+        setSupportedLocales(supported.begin(), supported.end()).build(errorCode);
+    const char *lists[] = {
+        "de-CH,de;q=0.9,en;q=0.8",
+        "zh-TW,zh;q=0.9,en-US;q=0.8,en;q=0.7",
+        "xx, yy;q=0.5",
+        "",
+        "sr-ME, hr;q=0.7, en;q=0.1",
+        "ja,en-US;q=0.9,en;q=0.8",
+        "fr-LU;q=0.3, de-LU;q=0.4",
+    };
+    // Enough different lists to overflow the cache, each one twice.
+    std::vector<std::string> all;
+    for (int32_t i = 0; i < 100; ++i) {
+        for (const char *list : lists) {
+            std::string s(list);
+            if (i > 0) {
+                s.append(s.empty() ? "" : ",").append(manyDesired[i % UPRV_LENGTHOF(manyDesired)]);
+                s.append(";q=0.0").append(std::to_string(i % 9 + 1));
+            }
+            all.push_back(s);
+        }
+    }
+    for (int32_t round = 0; round < 2; ++round) {
+        for (const std::string &list : all) {
+            LocalePriorityList priorityList(list, errorCode);
+            LocalePriorityList::Iterator iter = priorityList.iterator();
+            const Locale *expected = matcher.getBestMatch(iter, errorCode);
+            const Locale *actual = matcher.getBestMatchForListString(list, errorCode);
+            if (errorCode.errIfFailureAndReset("round %d \"%s\"", static_cast<int>(round),
+                                               list.c_str())) {
+                continue;
+            }
+            if (expected != actual) {
+                errln("round %d \"%s\": getBestMatchForListString() %s != getBestMatch() %s",
+                      static_cast<int>(round), list.c_str(), locString(actual), locString(expected));
+            }
+        }
+    }
+}
+
+void LocaleMatcherTest::testListStringCacheLifetime() {
+    IcuTestErrorCode errorCode(*this, "testListStringCacheLifetime");
+    // The list-string cache and its mutex are owned by the matcher.
+    // Destroying the matcher must not leave anything behind that
+    // u_cleanup() would touch later.
+    for (int32_t i = 0; i < 3; ++i) {
+        LocalPointer<LocaleMatcher> matcher(new LocaleMatcher(
+            LocaleMatcher::Builder().setSupportedLocalesFromListString("fr, en-GB, en").
+            build(errorCode)), errorCode);
+        if (errorCode.errIfFailureAndReset("LocaleMatcher")) {
+            return;
+        }
+        const Locale *best = matcher->getBestMatchForListString("fr-CA, en;q=0.5", errorCode);
+        assertEquals("fr-CA", "fr", locString(best));
+    }
+    // Reuse the freed memory, then do what u_cleanup() does with mutexes.
+    std::vector<char *> blocks;
+    for (int32_t i = 0; i < 100; ++i) {
+        char *block = static_cast<char *>(uprv_malloc(64));
+        if (block != nullptr) {
+            uprv_memset(block, 0x5a, 64);
+            blocks.push_back(block);
+        }
+    }
+    UMutex::cleanup();
+    for (char *block : blocks) {
+        uprv_free(block);
+    }
+    LocaleMatcher matcher = LocaleMatcher::Builder().
+        setSupportedLocalesFromListString("fr, en-GB, en").build(errorCode);
+    const Locale *best = matcher.getBestMatchForListString("en-AU, fr;q=0.5", errorCode);
+    errorCode.errIfFailureAndReset("getBestMatchForListString() after UMutex::cleanup()");
+    assertEquals("en-AU", "en_GB", locString(best));
+}
+
 void LocaleMatcherTest::testResolvedLocale() {
     IcuTestErrorCode errorCode(*this, "testResolvedLocale");
     LocaleMatcher matcher = LocaleMatcher::Builder().
@@ -10,7 +10,10 @@
 #include <functional>
 #include <iterator>
 #include <set>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <cctype>
 
 #include "loctest.h"
@@ -35,6 +38,7 @@
 #include "locmap.h"
 #include "uparse.h"
 #include "ulocimp.h"
+#include "loccache.h"
 #include "loclikelysubtags.h"
 #include "lsr.h"
 
@@ -302,6 +306,7 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestSierraLeoneCurrency21997);
 #endif
     TESTCASE_AUTO(TestPayload);
+    TESTCASE_AUTO(TestLocaleIDCache);
     TESTCASE_AUTO_END;
 }
 
@@ -4221,7 +4226,7 @@ LocaleTest::TestAddLikelyAndMinimizeSubtags() {
 void
 LocaleTest::TestXLikelySubtags() {
     IcuTestErrorCode status(*this, "TestXLikelySubtags()");
-    const XLikelySubtags* xlikely = XLikelySubtags::XLikelySubtags::getSingleton(status);
+    const LikelySubtags* xlikely = LikelySubtags::getSingleton(status);
     U_ASSERT(U_SUCCESS(status));
     Locale matchForUnd("und");
     matchForUnd.addLikelySubtags(status);
@@ -4234,7 +4239,7 @@ LocaleTest::TestXLikelySubtags() {
         Locale input(org);
         input.canonicalize(status);
         status.errIfFailureAndReset("\"%s\"", org);
-        LSR actual = xlikely->makeMaximizedLsrFrom(input, status);
+        LSR actual = xlikely->makeMaximizedLsrFrom(input, false, status);
         if (exp[0] == '\0') {
             assertLSR(UnicodeString(u"makeMaximizedLsrFrom(") + org + ")", matchForUnd, actual);
         } else {
@@ -7424,3 +7429,183 @@ void LocaleTest::TestPayload() {
         assertTrue("[11] is struct Nest", l.getLanguage() + baseNameNestOffset == l.getBaseName());
     }
 }
+
+namespace {
+
+// Everything a Locale exposes that depends on how it was initialized.
+std::string describeLocale(const Locale &l) {
+    if (l.isBogus()) {
+        return "bogus";
+    }
+    std::string s = l.getName();
+    for (const char *part : {l.getLanguage(), l.getScript(), l.getCountry(), l.getVariant(),
+                             l.getBaseName()}) {
+        s.append("|").append(part);
+    }
+    return s;
+}
+
+}  // namespace
+
+void LocaleTest::TestLocaleIDCache() {
+    static const char *const ids[] = {
+        "", "en", "en-US", "EN_us", "ja-JP", "zh-Hant-CN", "hy-SU", "iw", "mo", "sh",
+        "und-Latn", "und_GB", "art-lojban", "en-GB-oed", "zh-min-nan", "x-whatever",
+        "en_US_POSIX", "no-no-ny.utf8@B", "qz-qz@Euro", "de-tv.koi8r",
+        "en_Hant_IL_VALLEY_GIRL@ currency = EUR; calendar = Japanese ;",
+        "de-DE-u-co-phonebk-ca-buddhist", "th-TH-u-nu-thai", "sr-Latn-RS-x-private",
+        "und-u-rg-gbzzzz", "ja_JP.12345678901234567890123456789012345678901234567890123456789012345@B",
+        "en-", "-en", "123", "en--US"
+    };
+    IcuTestErrorCode status(*this, "TestLocaleIDCache");
+    LocaleIDCache::clear();
+    LocaleIDCache::Metrics metrics = LocaleIDCache::getMetrics(LocaleIDCache::CANONICAL_LOCALE);
+    assertEquals("no hits after clear()", static_cast<int64_t>(0), metrics.hits);
+    assertEquals("no misses after clear()", static_cast<int64_t>(0), metrics.misses);
+    assertEquals("no entries after clear()", 0, metrics.size);
+
+    // Results must not depend on whether they came from the cache.
+    std::vector<std::string> first[6];
+    for (int32_t pass = 0; pass < 3; ++pass) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+            const char *id = ids[i];
+            std::string results[6];
+            results[0] = describeLocale(Locale::createCanonical(id));
+            Locale canonical(id);
+            canonical.canonicalize(status);
+            results[1] = describeLocale(canonical) + status.errorName();
+            status.reset();
+            Locale tagged = Locale::forLanguageTag(id, status);
+            results[2] = describeLocale(tagged) + status.errorName();
+            status.reset();
+            char buffer[ULOC_FULLNAME_CAPACITY];
+            UErrorCode errorCode = U_ZERO_ERROR;
+            uloc_addLikelySubtags(id, buffer, UPRV_LENGTHOF(buffer), &errorCode);
+            results[3] = std::string(U_SUCCESS(errorCode) ? buffer : "") + u_errorName(errorCode);
+            errorCode = U_ZERO_ERROR;
+            uloc_minimizeSubtags(id, buffer, UPRV_LENGTHOF(buffer), &errorCode);
+            results[4] = std::string(U_SUCCESS(errorCode) ? buffer : "") + u_errorName(errorCode);
+            CharString minimized = ulocimp_minimizeSubtags(id, true, status);
+            results[5] = std::string(minimized.data()) + status.errorName();
+            status.reset();
+            for (int32_t j = 0; j < UPRV_LENGTHOF(results); ++j) {
+                if (pass == 0) {
+                    first[j].push_back(results[j]);
+                } else {
+                    assertEquals(UnicodeString("result ") + j + " of \"" + id + "\" pass " + pass,
+                                 first[j][i].c_str(), results[j].c_str());
+                }
+            }
+        }
+        if (pass == 1) {
+            // Third pass without the cache.
+            LocaleIDCache::clear();
+        }
+    }
+    LocaleIDCache::clear();
+    for (int32_t pass = 0; pass < 2; ++pass) {
+        Locale::createCanonical("hy-SU");
+        Locale::forLanguageTag("en-", status);
+        status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    }
+    metrics = LocaleIDCache::getMetrics(LocaleIDCache::CANONICAL_LOCALE);
+    assertEquals("canonical hits", static_cast<int64_t>(1), metrics.hits);
+    assertEquals("canonical misses", static_cast<int64_t>(1), metrics.misses);
+    assertEquals("canonical size", 1, metrics.size);
+    metrics = LocaleIDCache::getMetrics(LocaleIDCache::FOR_LANGUAGE_TAG);
+    assertEquals("errors are not cached", 0, metrics.size);
+    assertEquals("error lookups miss", static_cast<int64_t>(2), metrics.misses);
+
+    // LRU eviction, which happens per shard,
+    // so use only keys in the same shard as k0.
+    LocaleIDCache::clear();
+    constexpr int32_t shardCapacity = LocaleIDCache::CAPACITY / LocaleIDCache::SHARD_COUNT;
+    int32_t shard = LocaleIDCache::getShard(LocaleIDCache::ADD_LIKELY_SUBTAGS, "k0");
+    std::vector<std::string> keys;
+    keys.push_back("k0");
+    for (int32_t i = 1; static_cast<int32_t>(keys.size()) < shardCapacity + 10; ++i) {
+        std::string key = "k" + std::to_string(i);
+        if (LocaleIDCache::getShard(LocaleIDCache::ADD_LIKELY_SUBTAGS, key) == shard) {
+            keys.push_back(key);
+        }
+    }
+    CharString value;
+    for (int32_t i = 0; i < static_cast<int32_t>(keys.size()); ++i) {
+        if (i == shardCapacity - 1) {
+            // Touch k0 so that it is not the least recently used entry.
+            value.clear();
+            assertTrue("k0 before eviction",
+                       LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, "k0", value, status));
+            assertEquals("k0 value", "v0", value.data());
+        }
+        std::string v = "v" + keys[i].substr(1);
+        LocaleIDCache::put(LocaleIDCache::ADD_LIKELY_SUBTAGS, keys[i], v);
+    }
+    metrics = LocaleIDCache::getMetrics(LocaleIDCache::ADD_LIKELY_SUBTAGS);
+    assertEquals("shard full", shardCapacity, metrics.size);
+    assertEquals("evictions", static_cast<int64_t>(10), metrics.evictions);
+    value.clear();
+    assertTrue("recently used k0 kept",
+               LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, "k0", value, status));
+    assertFalse("least recently used keys[1] evicted",
+                LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, keys[1], value, status));
+    assertFalse("keys[10] evicted",
+                LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, keys[10], value, status));
+    const std::string &kept = keys[11];
+    value.clear();
+    assertTrue("keys[11] kept", LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, kept, value, status));
+    assertEquals("keys[11] value", ("v" + kept.substr(1)).c_str(), value.data());
+    assertFalse("kinds are separate",
+                LocaleIDCache::get(LocaleIDCache::MINIMIZE_SUBTAGS, kept, value, status));
+    // Other shards still have room.
+    for (int32_t i = 1; i <= shardCapacity; ++i) {
+        std::string key = "o" + std::to_string(i);
+        if (LocaleIDCache::getShard(LocaleIDCache::ADD_LIKELY_SUBTAGS, key) != shard) {
+            LocaleIDCache::put(LocaleIDCache::ADD_LIKELY_SUBTAGS, key, "o");
+        }
+    }
+    assertEquals("other shards do not evict", static_cast<int64_t>(10),
+                 LocaleIDCache::getMetrics(LocaleIDCache::ADD_LIKELY_SUBTAGS).evictions);
+    LocaleIDCache::put(LocaleIDCache::ADD_LIKELY_SUBTAGS, kept, "replaced");
+    value.clear();
+    LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, kept, value, status);
+    assertEquals("keys[11] replaced", "replaced", value.data());
+    assertEquals("replacing does not evict", static_cast<int64_t>(10),
+                 LocaleIDCache::getMetrics(LocaleIDCache::ADD_LIKELY_SUBTAGS).evictions);
+    std::string longKey(LocaleIDCache::MAX_LENGTH + 1, 'a');
+    LocaleIDCache::put(LocaleIDCache::ADD_LIKELY_SUBTAGS, longKey, "v");
+    assertFalse("long keys are not cached",
+                LocaleIDCache::get(LocaleIDCache::ADD_LIKELY_SUBTAGS, longKey, value, status));
+    LocaleIDCache::clear();
+
+    // Concurrent lookups with constant eviction.
+    std::vector<std::string> expected;
+    for (int32_t i = 0; i < 2 * LocaleIDCache::CAPACITY; ++i) {
+        std::string id = std::string(ids[i % 10]) + "-x-t" + std::to_string(i);
+        expected.push_back(Locale::createCanonical(id.c_str()).getName());
+    }
+    int32_t failures[4] = {0, 0, 0, 0};
+    std::thread threads[4];
+    for (int32_t t = 0; t < UPRV_LENGTHOF(threads); ++t) {
+        threads[t] = std::thread([&expected, &failures, t]() {
+            for (int32_t n = 0; n < 5; ++n) {
+                for (int32_t i = 0; i < 2 * LocaleIDCache::CAPACITY; ++i) {
+                    int32_t k = (i * (2 * t + 1) + n) % (2 * LocaleIDCache::CAPACITY);
+                    std::string id = std::string(ids[k % 10]) + "-x-t" + std::to_string(k);
+                    if (expected[k] != Locale::createCanonical(id.c_str()).getName()) {
+                        ++failures[t];
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (int32_t t = 0; t < UPRV_LENGTHOF(threads); ++t) {
+        assertEquals(UnicodeString("thread ") + t + " failures", 0, failures[t]);
+    }
+    metrics = LocaleIDCache::getMetrics(LocaleIDCache::CANONICAL_LOCALE);
+    assertTrue("concurrent hits", metrics.hits > 0);
+    assertTrue("concurrent evictions", metrics.evictions > 0);
+}
@@ -171,6 +171,7 @@ class LocaleTest: public IntlTest {
     void TestLongLocaleSetKeywordMoveAssign();
     void TestSierraLeoneCurrency21997();
     void TestPayload();
+    void TestLocaleIDCache();
 
 private:
     void assertLSR(UnicodeString msg, const Locale& expected, const LSR& actual);
@@ -28,6 +28,7 @@ TestMessageFormat2::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(testHighLoneSurrogate);
     TESTCASE_AUTO(testLowLoneSurrogate);
     TESTCASE_AUTO(testLoneSurrogateInQuotedLiteral);
+    TESTCASE_AUTO(testFormatRepeatedly);
     TESTCASE_AUTO(dataDrivenTests);
     TESTCASE_AUTO_END;
 }
@@ -471,6 +472,78 @@ void TestMessageFormat2::testLoneSurrogateInQuotedLiteral() {
     errorCode.errIfFailureAndReset("testLoneSurrogateInQuotedLiteral");
 }
 
+// The formatter keeps number formatters, plural rules and numbered variant keys
+// across calls; check that reusing them gives the same results as fresh ones.
+void TestMessageFormat2::testFormatRepeatedly() {
+    IcuTestErrorCode errorCode(*this, "testFormatRepeatedly");
+    UParseError parseError;
+    MessageFormatter::Builder builder(errorCode);
+    builder.setBidiIsolationStrategy(MessageFormatter::U_MF_BIDI_OFF).setLocale(Locale::getEnglish());
+
+    // Option values and locales that change between calls
+    MessageFormatter mf = builder.setPattern(
+        u"{$n :number minimumFractionDigits=$d} {$n :number u:locale=de}", parseError, errorCode)
+        .build(errorCode);
+    static const struct {
+        double n;
+        int64_t d;
+        const char16_t* expected;
+    } numberCases[] = {
+        {1234.5, 0, u"1,234.5 1.234,5"},
+        {1234.5, 2, u"1,234.50 1.234,5"},
+        {1, 3, u"1.000 1"},
+        {1, 4, u"1.0000 1"},
+        {1, 5, u"1.00000 1"},
+        {1234.5, 0, u"1,234.5 1.234,5"},
+        {1, 3, u"1.000 1"},
+        {1234.5, 2, u"1,234.50 1.234,5"},
+    };
+    for (int32_t round = 0; round < 2; round++) {
+        for (const auto& c : numberCases) {
+            std::map<UnicodeString, message2::Formattable> argsBuilder;
+            argsBuilder["n"] = message2::Formattable(c.n);
+            argsBuilder["d"] = message2::Formattable(c.d);
+            MessageArguments args(argsBuilder, errorCode);
+            assertEquals("options", c.expected, mf.formatToString(args, errorCode));
+        }
+    }
+
+    // More than nine variants with two selectors, and keys that are equal after
+    // NFC normalization
+    mf = builder.setPattern(
+        u".input {$a :string} .input {$n :integer}\n"
+        u".match $a $n\n"
+        u"x 1 {{x1}} x one {{xone}} x * {{x*}} y 1 {{y1}} y * {{y*}}\n"
+        u"* 1 {{*1}} * one {{*one}} * other {{*other}} z 2 {{z2}} z * {{z*}}\n"
+        u"|A\u030A| * {{ring}} * * {{**}}", parseError, errorCode)
+        .build(errorCode);
+    static const struct {
+        const char16_t* a;
+        int64_t n;
+        const char16_t* expected;
+    } selectCases[] = {
+        {u"x", 1, u"x1"},
+        {u"x", 2, u"x*"},
+        {u"q", 1, u"*1"},
+        {u"q", 5, u"*other"},
+        {u"z", 2, u"z2"},
+        {u"z", 1, u"z*"},
+        {u"y", 3, u"y*"},
+        {u"\u00C5", 3, u"ring"},
+        {u"x", 1, u"x1"},
+    };
+    for (int32_t round = 0; round < 2; round++) {
+        for (const auto& c : selectCases) {
+            std::map<UnicodeString, message2::Formattable> argsBuilder;
+            argsBuilder["a"] = message2::Formattable(UnicodeString(c.a));
+            argsBuilder["n"] = message2::Formattable(c.n);
+            MessageArguments args(argsBuilder, errorCode);
+            assertEquals(UnicodeString(u"select ") + c.a, c.expected, mf.formatToString(args, errorCode));
+        }
+    }
+    errorCode.errIfFailureAndReset("testFormatRepeatedly");
+}
+
 void TestMessageFormat2::dataDrivenTests() {
     IcuTestErrorCode errorCode(*this, "jsonTests");
 
@@ -53,6 +53,8 @@ class TestMessageFormat2: public IntlTest {
     void testBidiAPI(void);
     void testAPI(void);
     void testAPISimple(void);
+    // Test formatting the same message several times with different arguments
+    void testFormatRepeatedly(void);
 
 private:
     void jsonTestsFromFiles(IcuTestErrorCode&);
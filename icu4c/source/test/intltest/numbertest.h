@@ -106,6 +106,7 @@ class NumberFormatterApiTest : public IntlTestWithFieldPosition {
     void formatArbitraryConstant();
     void TestPortionFormat();
     void testIssue22378();
+    void formatInto();
 
     void runIndexedTest(int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
 
@@ -207,6 +208,7 @@ class DecimalQuantityTest : public IntlTest {
     void testConvertToAccurateDouble();
     void testUseApproximateDoubleWhenAble();
     void testHardDoubleConversion();
+    void testShortDecimalConversion();
     void testFitsInLong();
     void testToDouble();
     void testMaxDigits();
@@ -227,6 +229,7 @@ class DecimalQuantityTest : public IntlTest {
 class DoubleConversionTest : public IntlTest {
   public:
     void testDoubleConversionApi();
+    void testShortestMatchesDoubleToAscii();
 
     void runIndexedTest(int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
 };
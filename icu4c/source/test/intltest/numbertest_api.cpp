@@ -136,6 +136,7 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(formatArbitraryConstant);
         TESTCASE_AUTO(TestPortionFormat);
         TESTCASE_AUTO(testIssue22378);
+        TESTCASE_AUTO(formatInto);
     TESTCASE_AUTO_END;
 }
 
@@ -6300,6 +6301,66 @@ void NumberFormatterApiTest::testIssue22378() {
     assertEquals("Testing default -u-mu- for fr-FR", MeasureUnit::getCelsius().getIdentifier(), result);
 }
 
+void NumberFormatterApiTest::formatInto() {
+    IcuTestErrorCode status(*this, "formatInto");
+    static const char* const localeIDs[] = {"en", "de-CH", "pl", "ar-EG", "hi-u-nu-deva", "en-IN"};
+    static const char16_t* const skeletons[] = {
+        u"", u"group-off", u"sign-always", u"sign-accounting-except-zero currency/EUR", u".00",
+        u"@@", u"integer-width/000", u"percent", u"compact-short", u"scientific", u"scale/100",
+        u"decimal-always", u"measure-unit/length-meter unit-width-full-name",
+    };
+    static const int64_t intValues[] = {
+        0, 1, -1, 12, 1234, -12345, 1234567, 99999999999, INT64_MAX, INT64_MIN,
+    };
+    static const double doubleValues[] = {
+        0.0, -0.0, 2.0, -1234.0, 1234.5678, 1e15, 1e20, 0.001, uprv_getNaN(), -uprv_getInfinity(),
+    };
+    for (const char* localeID : localeIDs) {
+        for (const char16_t* skeleton : skeletons) {
+            LocalizedNumberFormatter formatter =
+                NumberFormatter::forSkeleton(skeleton, status).locale(localeID);
+            // Repeat so that both the static and the compiled formatter are used.
+            for (int32_t i = 0; i < 4; i++) {
+                for (int64_t value : intValues) {
+                    UnicodeString message = UnicodeString(localeID) + u" " + skeleton + u" " +
+                        Int64ToUnicodeString(value);
+                    std::string expected;
+                    formatter.formatInt(value, status).toString(status).toUTF8String(expected);
+                    char buffer[100];
+                    int32_t length = formatter.formatIntInto(value, buffer, UPRV_LENGTHOF(buffer), status);
+                    assertEquals(message, expected.c_str(), buffer);
+                    assertEquals(message + u" length", static_cast<int32_t>(expected.length()), length);
+                }
+                for (double value : doubleValues) {
+                    UnicodeString message = UnicodeString(localeID) + u" " + skeleton + u" " +
+                        DoubleToUnicodeString(value);
+                    std::string expected;
+                    formatter.formatDouble(value, status).toString(status).toUTF8String(expected);
+                    char buffer[100];
+                    int32_t length =
+                        formatter.formatDoubleInto(value, buffer, UPRV_LENGTHOF(buffer), status);
+                    assertEquals(message, expected.c_str(), buffer);
+                    assertEquals(message + u" length", static_cast<int32_t>(expected.length()), length);
+                }
+            }
+        }
+    }
+
+    // Preflighting and a buffer without room for the NUL.
+    LocalizedNumberFormatter formatter = NumberFormatter::withLocale("de");
+    assertEquals("preflight", 10, formatter.formatIntInto(-1234567, nullptr, 0, status));
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    char buffer[11];
+    uprv_memset(buffer, '?', UPRV_LENGTHOF(buffer));
+    assertEquals("unterminated", 10, formatter.formatIntInto(-1234567, buffer, 10, status));
+    status.expectErrorAndReset(U_STRING_NOT_TERMINATED_WARNING);
+    assertEquals("unterminated result", "-1.234.567?", std::string(buffer, 11).c_str());
+    assertEquals("too short", 10, formatter.formatDoubleInto(-1234567, buffer, 5, status));
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    formatter.formatIntInto(1, nullptr, 1, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 /* For skeleton comparisons: this checks the toSkeleton output for `f` and for
  * `conciseSkeleton` against the normalized version of `uskeleton` - this does
  * not round-trip uskeleton itself.
@@ -27,6 +27,7 @@ void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *
         }
         TESTCASE_AUTO(testUseApproximateDoubleWhenAble);
         TESTCASE_AUTO(testHardDoubleConversion);
+        TESTCASE_AUTO(testShortDecimalConversion);
         TESTCASE_AUTO(testFitsInLong);
         TESTCASE_AUTO(testToDouble);
         TESTCASE_AUTO(testMaxDigits);
@@ -362,6 +363,47 @@ void DecimalQuantityTest::testHardDoubleConversion() {
     }
 }
 
+void DecimalQuantityTest::testShortDecimalConversion() {
+    // Short decimals are converted to exact BCD without the double-conversion oracle.
+    static const struct TestCase {
+        double input;
+        const char16_t* expectedOutput;
+    } cases[] = {
+            { 0.1, u"0.1" },
+            { 0.3, u"0.3" },
+            { 0.30000000000000004, u"0.30000000000000004" },
+            { 1234.5678, u"1234.5678" },
+            { 0.00012345, u"0.00012345" },
+            { 0.000012345, u"0.000012345" },
+            { 123456.78901234, u"123456.78901234" },
+            { 99999.99999999, u"99999.99999999" },
+            { 0.125, u"0.125" },
+            { 1e-9, u"0.000000001" },
+            { 2.675, u"2.675" },
+            { 1.0 / 3.0, u"0.3333333333333333" } };
+
+    for (const auto& cas : cases) {
+        DecimalQuantity q;
+        q.setToDouble(cas.input);
+        q.roundToInfinity();
+        assertEquals(DoubleToUnicodeString(cas.input), cas.expectedOutput, q.toPlainString());
+        assertTrue("Should not be using approximate double", q.isExplicitExactDouble());
+        assertHealth(q);
+        assertDoubleEquals(u"Round trip", cas.input, q.toDouble());
+    }
+
+    // Integers are converted to BCD two digits at a time.
+    static const int64_t longs[] = {
+        1, 9, 10, 99, 100, 101, 12345, 1000000, 9999999999999999LL, 1000000000000000LL, 4000000000000002LL };
+    for (int64_t input : longs) {
+        DecimalQuantity q;
+        q.setToLong(input);
+        assertEquals(Int64ToUnicodeString(input), Int64ToUnicodeString(input), q.toPlainString());
+        assertEquals(Int64ToUnicodeString(input) + u" toLong", input, q.toLong());
+        assertHealth(q);
+    }
+}
+
 void DecimalQuantityTest::testFitsInLong() {
     IcuTestErrorCode status(*this, "testFitsInLong");
     DecimalQuantity quantity;
@@ -6,6 +6,8 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "numbertest.h"
+#include "number_ryu.h"
+#include "cmemory.h"
 #include "double-conversion.h"
 
 using namespace double_conversion;
@@ -16,6 +18,7 @@ void DoubleConversionTest::runIndexedTest(int32_t index, UBool exec, const char
     }
     TESTCASE_AUTO_BEGIN;
         TESTCASE_AUTO(testDoubleConversionApi);
+        TESTCASE_AUTO(testShortestMatchesDoubleToAscii);
     TESTCASE_AUTO_END;
 }
 
@@ -42,4 +45,68 @@ void DoubleConversionTest::testDoubleConversionApi() {
     assertEquals("Scale", 2, point);
 }
 
+void DoubleConversionTest::testShortestMatchesDoubleToAscii() {
+    // doubleToShortestDecimal must produce exactly the digits of DoubleToAscii in SHORTEST mode.
+    // Check every exponent at the mantissa edges, a sample of floats, and random doubles.
+    // In exhaustive mode, check many more of the latter two.
+    int32_t failures = 0;
+    auto check = [&](uint64_t bits) {
+        double d;
+        uprv_memcpy(&d, &bits, sizeof(d));
+        uint64_t significand;
+        int32_t exponent;
+        icu::number::impl::doubleToShortestDecimal(d, significand, exponent);
+
+        char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
+        bool sign;
+        int32_t length;
+        int32_t point;
+        DoubleToStringConverter::DoubleToAscii(
+            d, DoubleToStringConverter::DtoaMode::SHORTEST, 0,
+            buffer, sizeof(buffer), &sign, &length, &point);
+        uint64_t expected = 0;
+        for (int32_t i = 0; i < length; i++) {
+            expected = expected * 10 + (buffer[i] - '0');
+        }
+        if ((significand != expected || exponent != point - length) && failures++ < 10) {
+            errln(UnicodeString("Mismatch for ") + DoubleToUnicodeString(d) + u": got " +
+                Int64ToUnicodeString(static_cast<int64_t>(significand)) + u"E" + Int64ToUnicodeString(exponent) +
+                u", expected " + UnicodeString(buffer, length, US_INV) + u"E" + Int64ToUnicodeString(point - length));
+        }
+    };
+
+    static const uint64_t mantissas[] = {0, 1, 2, 3, 0x8000000000000, 0xfffffffffffff};
+    for (uint64_t exponent = 0; exponent < 0x7ff; exponent++) {
+        for (uint64_t mantissa : mantissas) {
+            if (exponent != 0 || mantissa != 0) {
+                check((exponent << 52) | mantissa);
+            }
+        }
+    }
+
+    uint32_t floatStride = quick ? 1000003 : 997;
+    for (uint32_t floatBits = 1; floatBits < 0x7f800000; floatBits += floatStride) {
+        float f;
+        uprv_memcpy(&f, &floatBits, sizeof(f));
+        double d = f;
+        uint64_t bits;
+        uprv_memcpy(&bits, &d, sizeof(d));
+        check(bits);
+    }
+
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    int32_t count = quick ? 100000 : 10000000;
+    for (int32_t i = 0; i < count; i++) {
+        // xorshift64*
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        uint64_t bits = (state * 0x2545f4914f6cdd1dULL) & 0x7fffffffffffffffULL;
+        if (bits != 0 && (bits >> 52) != 0x7ff) {
+            check(bits);
+        }
+    }
+    assertEquals("Total mismatches", 0, failures);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
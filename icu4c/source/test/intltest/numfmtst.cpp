@@ -256,6 +256,7 @@ void NumberFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &n
   TESTCASE_AUTO(Test21556_CurrencyAsDecimal);
   TESTCASE_AUTO(Test22088_Ethiopic);
   TESTCASE_AUTO(Test22983_LongFraction);
+  TESTCASE_AUTO(TestParseBatch);
   TESTCASE_AUTO_END;
 }
 
@@ -10209,4 +10210,69 @@ void NumberFormatTest::Test22983_LongFraction() {
     DecimalFormat df(u"0.0000000000000001", status);
 }
 
+void NumberFormatTest::TestParseBatch() {
+    IcuTestErrorCode status(*this, "TestParseBatch");
+    // Plain numbers take a fast path in parseBatch(); everything must parse as with parse().
+    static const char16_t* const texts[] = {
+        u"0", u"-0", u"-0.000", u"+5", u"7", u"1234", u"-1234.5", u"0.1", u"0.30000000000000004",
+        u"1,234", u"12,345,678.25", u"-1,234,567", u"1.234", u"1.234.567", u"1.234,5", u"12,34,567.5",
+        u"1,23", u"1,2345", u"1,234,", u"1,,234", u"1.", u".5", u"1,234.", u"1234.5.6",
+        u"9007199254740993", u"9007199254740993.5", u"18446744073709551615", u"12345678901234567890",
+        u"0.00000000000000000001", u"123456789.987654321", u" 12", u"12 ", u"1e3", u"1E-3",
+        u"abc", u"", u"-", u"\u2212" u"5", u"\u0661\u0662", u"12%", u"1\u00A0234"};
+    static const char* const locales[] = {"en", "de", "fr", "en-IN", "ar-EG"};
+    const int32_t count = UPRV_LENGTHOF(texts);
+    UnicodeString inputs[count];
+    for (int32_t i = 0; i < count; i++) {
+        inputs[i] = UnicodeString(texts[i]);
+    }
+    for (const char* localeID : locales) {
+        for (int32_t style = 0; style < 3; style++) {
+            LocalPointer<NumberFormat> nf(style == 2
+                ? NumberFormat::createPercentInstance(localeID, status)
+                : NumberFormat::createInstance(localeID, status));
+            if (status.errDataIfFailureAndReset("createInstance(%s)", localeID)) {
+                continue;
+            }
+            auto* df = dynamic_cast<DecimalFormat*>(nf.getAlias());
+            if (df == nullptr) {
+                continue;
+            }
+            df->setLenient(style == 1);
+            double results[count];
+            int32_t parseEnds[count];
+            int32_t successes = df->parseBatch(inputs, count, results, parseEnds, status);
+            status.errIfFailureAndReset();
+            int32_t expectedSuccesses = 0;
+            for (int32_t i = 0; i < count; i++) {
+                Formattable expected;
+                ParsePosition ppos;
+                df->parse(inputs[i], expected, ppos);
+                int32_t expectedEnd = ppos.getErrorIndex() == -1 ? ppos.getIndex() : -1;
+                double expectedValue = expectedEnd == -1 ? 0.0 : expected.getDouble(status);
+                UnicodeString message = UnicodeString(localeID, -1, US_INV) + u" style " +
+                    Int64ToUnicodeString(style) + u": " + inputs[i];
+                assertEquals(message + u" end", expectedEnd, parseEnds[i]);
+                assertEquals(message, expectedValue, results[i]);
+                assertEquals(message + u" sign", std::signbit(expectedValue), std::signbit(results[i]));
+                if (expectedEnd != -1) {
+                    expectedSuccesses++;
+                }
+            }
+            assertEquals(UnicodeString(localeID, -1, US_INV) + u" successes", expectedSuccesses, successes);
+        }
+    }
+
+    LocalPointer<NumberFormat> nf(NumberFormat::createInstance("en", status));
+    if (status.errDataIfFailureAndReset("createInstance(en)")) {
+        return;
+    }
+    auto* df = dynamic_cast<DecimalFormat*>(nf.getAlias());
+    double result;
+    assertEquals("negative count", 0, df->parseBatch(inputs, -1, &result, nullptr, status));
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    assertEquals("empty batch", 0, df->parseBatch(nullptr, 0, nullptr, nullptr, status));
+    status.errIfFailureAndReset();
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -312,6 +312,7 @@ class NumberFormatTest: public CalendarTimeZoneTest {
     void Test21556_CurrencyAsDecimal();
     void Test22088_Ethiopic();
     void Test22983_LongFraction();
+    void TestParseBatch();
 
  private:
     UBool testFormattableAsUFormattable(const char *file, int line, Formattable &f);
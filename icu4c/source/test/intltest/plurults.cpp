@@ -29,6 +29,7 @@
 #include "cstr.h"
 #include "plurrule_impl.h"
 #include "plurults.h"
+#include "putilimp.h"
 #include "uhash.h"
 #include "number_decimalquantity.h"
 
@@ -71,6 +72,7 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testLocaleExtension);
     TESTCASE_AUTO(testDoubleEqualSign);
     TESTCASE_AUTO(test22638LongNumberValue);
+    TESTCASE_AUTO(testCompiledSelect);
     TESTCASE_AUTO_END;
 }
 
@@ -1670,4 +1672,96 @@ void PluralRulesTest::testLocaleExtension() {
     compareLocaleResults("fr", "fr_CH", "fr@ms=uksystem");
 }
 
+void PluralRulesTest::testCompiledSelect() {
+    IcuTestErrorCode errorCode(*this, "testCompiledSelect");
+    // Compare the compiled select() with a direct evaluation of the parsed rules.
+    LocalPointer<StringEnumeration> locales(PluralRules::getAvailableLocales(errorCode));
+    if (errorCode.errIfFailureAndReset("PluralRules::getAvailableLocales()")) { return; }
+    const char* localeID;
+    while ((localeID = locales->next(nullptr, errorCode)) != nullptr) {
+        for (UPluralType type : {UPLURAL_TYPE_CARDINAL, UPLURAL_TYPE_ORDINAL}) {
+            LocalPointer<PluralRules> rules(PluralRules::forLocale(localeID, type, errorCode));
+            if (errorCode.errIfFailureAndReset("PluralRules::forLocale(%s)", localeID)) { continue; }
+            checkCompiledSelect(*rules, localeID);
+        }
+    }
+
+    static const char16_t* const customRules[] = {
+        u"a: n mod 0 is 1; b: n within 2..4; c: n not in 5,7..9",
+        u"a: i = 0 or n = 1 and v = 0; b: n % 1000000 = 0 and e = 0; c: f = 5 or t != 1..3",
+        u"a: e = 0 and i != 0 and i % 1000000 = 0 and v = 0 or e != 0..5; b: c = 3",
+        u"a: n is not 2; b: n not within 1000..2000; c:",
+    };
+    for (const char16_t* description : customRules) {
+        LocalPointer<PluralRules> rules(PluralRules::createRules(description, errorCode));
+        if (errorCode.errIfFailureAndReset("PluralRules::createRules(%s)", CStr(UnicodeString(description))())) {
+            continue;
+        }
+        checkCompiledSelect(*rules, CStr(UnicodeString(description))());
+    }
+
+    LocalPointer<PluralRules> rules(PluralRules::forLocale("ru", errorCode));
+    LocalPointer<PluralRules> clone(rules->clone());
+    if (errorCode.errIfFailureAndReset("PluralRules::forLocale(ru)")) { return; }
+    assertTrue("clone shares the compiled rules",
+               rules->mProgram != nullptr && rules->mProgram == clone->mProgram);
+}
+
+void PluralRulesTest::checkCompiledSelect(const PluralRules& rules, const char* name) {
+    IcuTestErrorCode errorCode(*this, "checkCompiledSelect");
+    static const int32_t largeIntegers[] = {
+        1000, 1001, 1011, 1100, 10000, 100000, 1000000, 1000001, 2000000, 10000000, 123456789,
+        INT32_MAX, INT32_MIN + 1, INT32_MIN
+    };
+    for (int32_t i = -1100; i <= 1100; i++) {
+        if (!assertEquals(UnicodeString(name) + u" select(" + i + u")",
+                          rules.mRules->select(FixedDecimal(i)), rules.select(i))) {
+            return;
+        }
+    }
+    for (int32_t i : largeIntegers) {
+        if (!assertEquals(UnicodeString(name) + u" select(" + i + u")",
+                          rules.mRules->select(FixedDecimal(i)), rules.select(i))) {
+            return;
+        }
+    }
+    static const double doubles[] = {
+        0.0, -0.0, 0.5, 1.0, 1.5, 2.25, 10.1, 100.999, 1e6, 1e15, 9007199254740992.0, 1e20,
+        -3.0, uprv_getNaN(), uprv_getInfinity()
+    };
+    for (int32_t i = 0; i < 2000; i += 7) {
+        double d = i / 100.0;
+        if (!assertEquals(UnicodeString(name) + u" select(" + d + u")",
+                          rules.mRules->select(FixedDecimal(d)), rules.select(d))) {
+            return;
+        }
+    }
+    for (double d : doubles) {
+        if (!assertEquals(UnicodeString(name) + u" select(" + d + u")",
+                          rules.mRules->select(FixedDecimal(d)), rules.select(d))) {
+            return;
+        }
+    }
+    static const char16_t* const decimals[] = {
+        u"0", u"1", u"1.0", u"1.00", u"2.50", u"11", u"21.0", u"101", u"0.1", u"0.01", u"1000000",
+        u"1c6", u"1.2c6", u"2e3", u"1000000.0", u"1234567", u"12345678901234567890", u"-5", u"-1.0"
+    };
+    for (const char16_t* decimal : decimals) {
+        DecimalQuantity dq = DecimalQuantity::fromExponentString(decimal, errorCode);
+        if (errorCode.errIfFailureAndReset("DecimalQuantity::fromExponentString(%s)", CStr(UnicodeString(decimal))())) {
+            continue;
+        }
+        if (!assertEquals(UnicodeString(name) + u" select(" + decimal + u")",
+                          rules.mRules->select(dq), rules.select(dq))) {
+            return;
+        }
+        FixedDecimal fd(dq.toDouble(), dq.getPluralOperand(PLURAL_OPERAND_V),
+                        static_cast<int64_t>(dq.getPluralOperand(PLURAL_OPERAND_F)));
+        if (!assertEquals(UnicodeString(name) + u" select(FixedDecimal " + decimal + u")",
+                          rules.mRules->select(fd), rules.select(fd))) {
+            return;
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -52,7 +52,9 @@ class PluralRulesTest : public IntlTest {
     void testLocaleExtension();
     void testDoubleEqualSign();
     void test22638LongNumberValue();
+    void testCompiledSelect();
 
+    void checkCompiledSelect(const PluralRules& rules, const char* name);
     void assertRuleValue(const UnicodeString& rule, double expected);
     void assertRuleKeyValue(const UnicodeString& rule, const UnicodeString& key,
                             double expected);
@@ -22,6 +22,7 @@
 #include "unicode/uchar.h"
 #include "unicode/unifilt.h"
 #include "unicode/uniset.h"
+#include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/usetiter.h"
 #include "unicode/uscript.h"
@@ -30,6 +31,7 @@
 #include "nultrans.h"
 #include "rbt.h"
 #include "rbt_pars.h"
+#include "rbt_bin.h"
 #include "anytrans.h"
 #include "esctrn.h"
 #include "name2uni.h"
@@ -197,6 +199,9 @@ TransliteratorTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(83,TestThai);
         TESTCASE(84,TestAny);
         TESTCASE(85,TestBasicTransliteratorEvenWithoutData);
+        TESTCASE(86,TestCreateInstanceCache);
+        TESTCASE(87,TestCompiledRules);
+        TESTCASE(88,TestUnaffectedRuns);
         default: name = ""; break;
     }
 }
@@ -4627,6 +4632,155 @@ void TransliteratorTest::TestRegisterAlias() {
     Transliterator::unregister(fakeID);
 }
 
+void TransliteratorTest::TestCreateInstanceCache() {
+    UnicodeString id("Any-Latin; Latin-ASCII");
+    int32_t hitsBefore, missesBefore;
+    Transliterator::getCacheStatistics(hitsBefore, missesBefore);
+
+    UErrorCode err = U_ZERO_ERROR;
+    LocalPointer<Transliterator> t1(Transliterator::createInstance(id, UTRANS_FORWARD, err));
+    LocalPointer<Transliterator> t2(Transliterator::createInstance(id, UTRANS_FORWARD, err));
+    if (U_FAILURE(err)) {
+        dataerrln("FAIL: createInstance(" + id + ") failed - " + u_errorName(err));
+        return;
+    }
+    int32_t hits, misses;
+    Transliterator::getCacheStatistics(hits, misses);
+    assertTrue("second createInstance() is a cache hit", hits > hitsBefore);
+    assertTrue("instances are distinct", t1.getAlias() != t2.getAlias());
+    assertEquals("cached instance ID", t1->getID(), t2->getID());
+
+    // Changing one instance must not affect the cache or other instances.
+    t1->adoptFilter(new UnicodeSet(u"[a-z]", err));
+    LocalPointer<Transliterator> t3(Transliterator::createInstance(id, UTRANS_FORWARD, err));
+    if (!assertSuccess("createInstance() after adoptFilter()", err)) {
+        return;
+    }
+    assertTrue("cached instance has no filter", t3->getFilter() == nullptr);
+    UnicodeString s1(u"\u041F\u0440"), s2(s1);
+    t1->transliterate(s1);
+    t3->transliterate(s2);
+    assertEquals("filtered instance", u"\u041F\u0440", s1);
+    assertEquals("cached instance", u"Pr", s2);
+
+    // Registry changes must invalidate cached instances.
+    UnicodeString cacheID("Any-CacheTest");
+    UParseError pe;
+    LocalPointer<Transliterator> rbt(Transliterator::createFromRules(
+            cacheID, u"a > b;", UTRANS_FORWARD, pe, err));
+    if (!assertSuccess("createFromRules()", err)) {
+        return;
+    }
+    Transliterator::registerInstance(rbt.orphan());
+    LocalPointer<Transliterator> t4(Transliterator::createInstance(cacheID, UTRANS_FORWARD, err));
+    assertSuccess("createInstance() of registered ID", err);
+    Transliterator::unregister(cacheID);
+    LocalPointer<Transliterator> t5(Transliterator::createInstance(cacheID, UTRANS_FORWARD, err));
+    if (U_SUCCESS(err)) {
+        errln("Instantiation of cached ID succeeded after it was unregistered");
+    }
+}
+
+void TransliteratorTest::TestCompiledRules() {
+    // Transliterators built from the precompiled rules in the data must
+    // behave like ones parsed from the rule text.
+    static const char* const ids[] = {
+        "Any-Publishing", "Grek-Latn", "Latn-Grek", "Hira-Kana", "Kana-Hira",
+        "Cyrl-Latn", "Latn-Cyrl", "Hang-Latn"
+    };
+    UnicodeString text(u"\"Quoted\" -- \u00C0\u00E9\u00EE\u00F5\u00FC \u00DF \u00C6 "
+                       u"\u03A9\u03BC\u03AD\u03B3\u03B1 \u3072\u3089\u304C\u306A "
+                       u"\u30AB\u30BF\u30AB\u30CA \u043A\u0438\u0440\u0438\u043B\u043B\u0438\u0446\u0430 "
+                       u"\uD55C\uAE00 omega hiragana kirillitsa");
+    UErrorCode err = U_ZERO_ERROR;
+    LocalUResourceBundlePointer bundle(ures_openDirect(U_ICUDATA_TRANSLIT, "root", &err));
+    LocalUResourceBundlePointer transIDs(
+        ures_getByKey(bundle.getAlias(), "RuleBasedTransliteratorIDs", nullptr, &err));
+    if (U_FAILURE(err)) {
+        dataerrln("FAIL: unable to open the transliterator index - %s", u_errorName(err));
+        return;
+    }
+    for (const char* id : ids) {
+        err = U_ZERO_ERROR;
+        LocalUResourceBundlePointer entry(ures_getByKey(transIDs.getAlias(), id, nullptr, &err));
+        LocalUResourceBundlePointer file(ures_getByKey(entry.getAlias(), "file", nullptr, &err));
+        UnicodeString rules = ures_getUnicodeStringByKey(file.getAlias(), "resource", &err);
+        UTransDirection dir =
+            ures_getUnicodeStringByKey(file.getAlias(), "direction", &err).charAt(0) == u'F' ?
+            UTRANS_FORWARD : UTRANS_REVERSE;
+        int32_t compiledLength = 0;
+        LocalUResourceBundlePointer compiled(ures_getByKey(file.getAlias(), "compiled", nullptr, &err));
+        ures_getBinary(compiled.getAlias(), &compiledLength, &err);
+        if (U_FAILURE(err)) {
+            errln("FAIL: no compiled rules for %s - %s", id, u_errorName(err));
+            continue;
+        }
+
+        // The data must match what compileRules() produces now.
+        UParseError pe;
+        int32_t length = TransliterationRuleBinary::compileRules(rules, dir, nullptr, 0, pe, err);
+        if (err == U_BUFFER_OVERFLOW_ERROR) {
+            err = U_ZERO_ERROR;
+        }
+        if (!assertSuccess(UnicodeString("compileRules() preflighting ") + id, err)) {
+            continue;
+        }
+        assertEquals(UnicodeString("compiled length of ") + id, compiledLength, length);
+
+        UnicodeString unicodeID(id, -1, US_INV);
+        LocalPointer<Transliterator> fromData(Transliterator::createInstance(unicodeID, UTRANS_FORWARD, err));
+        LocalPointer<Transliterator> fromRules(Transliterator::createFromRules(unicodeID, rules, dir, pe, err));
+        if (!assertSuccess(UnicodeString("createInstance()/createFromRules() ") + id, err)) {
+            continue;
+        }
+        UnicodeString expected(text), actual(text);
+        fromRules->transliterate(expected);
+        fromData->transliterate(actual);
+        assertEquals(UnicodeString("transliterate() with ") + id, expected, actual);
+    }
+
+    // Errors are reported as for createFromRules().
+    err = U_ZERO_ERROR;
+    UParseError pe;
+    uint8_t buffer[64];
+    TransliterationRuleBinary::compileRules(u"a > $undefined;", UTRANS_FORWARD,
+                                            buffer, UPRV_LENGTHOF(buffer), pe, err);
+    if (U_SUCCESS(err)) {
+        errln("FAIL: compileRules() succeeded on a syntax error");
+    }
+    err = U_ZERO_ERROR;
+    int32_t length = TransliterationRuleBinary::compileRules(u"[a-z] > x; ::Null;", UTRANS_FORWARD,
+                                                             buffer, 4, pe, err);
+    assertEquals("compileRules() overflow", U_BUFFER_OVERFLOW_ERROR, err);
+    assertTrue("compileRules() length", length > 4);
+}
+
+void TransliteratorTest::TestUnaffectedRuns() {
+    // Text at which no rule can start to match is skipped in runs; make
+    // sure that rules whose key may start after an empty match, or
+    // that have no key, still apply.
+    expect(u"x* y > Q;", u"abxxyc y", u"abQc Q");
+    expect(u"([ab]*) c > d$1;", u"zzc zac", u"zzd zda");
+    expect(u"x {} y > '-';", u"axyb xy", u"ax-yb x-y");
+    expect(u"[{ab}c] > X;", u"zabzcz", u"zXzXz");
+    expect(u"::[^b]; a > c;", u"abab", u"cbcb");
+    expect(u"b { a > c; ::NFD; \u0301 > ;", u"ba\u00E9 a\u00E9", u"bce ae");
+
+    // Long, mostly unaffected runs with a filter, normalization and rules
+    UnicodeString source, expected;
+    for (int32_t i = 0; i < 50; ++i) {
+        source.append(u"The na\u00EFve caf\u00E9 owner said \u201Cvoil\u00E0!\u201D \u2014 twice. ");
+        expected.append(u"The naive cafe owner said \"voila!\" - twice. ");
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Transliterator> t(Transliterator::createInstance(u"Latin-ASCII", UTRANS_FORWARD, status));
+    if (U_FAILURE(status)) {
+        dataerrln("FAIL: createInstance(Latin-ASCII) failed - %s", u_errorName(status));
+        return;
+    }
+    expect(*t, source, expected);
+}
+
 void TransliteratorTest::TestRuleStripping() {
     /*
 #
@@ -370,6 +370,21 @@ class TransliteratorTest : public IntlTest {
     void TestRegisterAlias();
 
     void TestBasicTransliteratorEvenWithoutData();
+
+    /**
+     * Tests the cache behind createInstance()
+     */
+    void TestCreateInstanceCache();
+
+    /**
+     * Tests the precompiled rules in the transliterator data
+     */
+    void TestCompiledRules();
+
+    /**
+     * Tests skipping text that no rule can change
+     */
+    void TestUnaffectedRuns();
     //======================================================================
     // Support methods
     //======================================================================
@@ -52,6 +52,8 @@ MultithreadTest::~MultithreadTest()
 #include "unicode/locid.h"
 #include "unicode/coll.h"
 #include "unicode/calendar.h"
+#include "unicode/messageformat2.h"
+#include "unicode/messageformat2_arguments.h"
 #include "ucaconf.h"
 
 
@@ -79,6 +81,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FORMATTING && !UCONFIG_NO_MF2
+    TESTCASE_AUTO(TestMessageFormat2NumberCache);
+#endif
     TESTCASE_AUTO_END;
 }
 
@@ -1368,3 +1373,88 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+#if !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FORMATTING && !UCONFIG_NO_MF2
+// Formats with one MessageFormatter from several threads. The :number function
+// keeps a few number formatters and plural rules across calls, and the number of
+// distinct options makes the threads replace each other's formatters all the time.
+
+static message2::MessageFormatter *gSharedMessageFormatter = nullptr;
+static constexpr int32_t MF2_OPTION_COUNT = 9;
+static UnicodeString gMF2Expected[MF2_OPTION_COUNT][4];
+
+static UnicodeString formatMF2(int32_t digits, int32_t count, UErrorCode &status) {
+    std::map<UnicodeString, message2::Formattable> argsBuilder;
+    argsBuilder[u"n"] = message2::Formattable(static_cast<double>(count));
+    argsBuilder[u"m"] = message2::Formattable(static_cast<int64_t>(count));
+    argsBuilder[u"d"] = message2::Formattable(static_cast<int64_t>(digits));
+    message2::MessageArguments args(argsBuilder, status);
+    return gSharedMessageFormatter->formatToString(args, status);
+}
+
+class MF2NumberCacheThread : public SimpleThread {
+public:
+    MF2NumberCacheThread(int32_t start) : fStart(start), fFailures(0) {}
+    virtual void run() override;
+    int32_t fStart;
+    int32_t fFailures;
+};
+
+void MF2NumberCacheThread::run() {
+    for (int32_t i = 0; i < 2000; ++i) {
+        int32_t digits = (fStart + i) % MF2_OPTION_COUNT;
+        int32_t count = 1 + i % 4;
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString result = formatMF2(digits, count, status);
+        if (U_FAILURE(status) || result != gMF2Expected[digits][count - 1]) {
+            ++fFailures;
+        }
+    }
+}
+
+void MultithreadTest::TestMessageFormat2NumberCache() {
+    IcuTestErrorCode status(*this, "TestMessageFormat2NumberCache");
+    UParseError parseError;
+    message2::MessageFormatter::Builder builder(status);
+    builder.setLocale(Locale::getEnglish())
+        .setPattern(UnicodeString(u".input {$n :number minimumFractionDigits=$d}\n"
+                    u".input {$m :number select=ordinal}\n"
+                    u".match $n $m\n"
+                    u"one one {{{$n} is the {$m}st}}\n"
+                    u"* two {{{$n} is the {$m}nd}}\n"
+                    u"* * {{{$n} is the {$m}th}}"),
+                    parseError, status);
+    message2::MessageFormatter mf = builder.build(status);
+    if (status.errIfFailureAndReset("building the formatter")) {
+        return;
+    }
+    gSharedMessageFormatter = &mf;
+    for (int32_t digits = 0; digits < MF2_OPTION_COUNT; ++digits) {
+        for (int32_t count = 1; count <= 4; ++count) {
+            gMF2Expected[digits][count - 1] = formatMF2(digits, count, status);
+        }
+    }
+    assertEquals(WHERE, UnicodeString(u"1 is the 1st"), gMF2Expected[0][0]);
+    assertEquals(WHERE, UnicodeString(u"2.00 is the 2nd"), gMF2Expected[2][1]);
+    assertEquals(WHERE, UnicodeString(u"4.000 is the 4th"), gMF2Expected[3][3]);
+
+    static constexpr int NUM_THREADS = 4;
+    MF2NumberCacheThread *threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i] = new MF2NumberCacheThread(2 * i);
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        assertEquals(WHERE, 0, threads[i]->fFailures);
+        delete threads[i];
+    }
+    gSharedMessageFormatter = nullptr;
+    for (auto &expected : gMF2Expected) {
+        for (auto &s : expected) {
+            s.remove();
+        }
+    }
+}
+#endif /* !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FORMATTING && !UCONFIG_NO_MF2 */
@@ -90,6 +90,7 @@ TimeZoneFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &name
         TESTCASE(10, TestBogusLocale);
         TESTCASE(11, Test22614GetMetaZoneNamesNotCrash);
         TESTCASE(12, Test22615NonASCIIID);
+        TESTCASE(13, TestParseThreadSafe);
     default: name = ""; break;
     }
 }
@@ -755,6 +756,56 @@ void TimeZoneFormatTest::RunAdoptDefaultThreadSafeTests(int32_t threadNumber) {
     }
 }
 
+void
+TimeZoneFormatTest::TestParseThreadSafe() {
+    ThreadPool<TimeZoneFormatTest> threads(this, threadCount, &TimeZoneFormatTest::RunParseThreadSafeTests);
+    threads.start();   // Start all threads.
+    threads.join();    // Wait for all threads to finish.
+}
+
+// Threads format and parse zone names of the same locale at the same time,
+// each starting at a different zone and style, so that some of them search
+// the name tries while others still load names into them.
+void TimeZoneFormatTest::RunParseThreadSafeTests(int32_t threadNumber) {
+    static const char* const ZONES[] = {
+        "America/Los_Angeles", "Europe/Paris", "Asia/Tokyo",
+        "Australia/Sydney", "America/Sao_Paulo", "Europe/Berlin"
+    };
+    static const UTimeZoneFormatStyle STYLES[] = {
+        UTZFMT_STYLE_SPECIFIC_LONG, UTZFMT_STYLE_SPECIFIC_SHORT,
+        UTZFMT_STYLE_GENERIC_LONG, UTZFMT_STYLE_GENERIC_LOCATION
+    };
+    const int32_t count = UPRV_LENGTHOF(ZONES) * UPRV_LENGTHOF(STYLES);
+    const UDate date = 1358208000000.0;  // 2013-01-15T00:00:00Z
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<TimeZoneFormat> tzfmt(TimeZoneFormat::createInstance(Locale("fr"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("Fail TimeZoneFormat::createInstance: %s", u_errorName(status));
+        return;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        int32_t n = (i + threadNumber) % count;
+        UTimeZoneFormatStyle style = STYLES[n % UPRV_LENGTHOF(STYLES)];
+        LocalPointer<TimeZone> tz(TimeZone::createTimeZone(ZONES[n / UPRV_LENGTHOF(STYLES)]));
+        UnicodeString name;
+        tzfmt->format(style, *tz, date, name);
+        if (name.isEmpty()) {
+            continue;
+        }
+        ParsePosition pos(0);
+        LocalPointer<TimeZone> parsed(tzfmt->parse(style, name, pos));
+        UnicodeString parsedName;
+        if (parsed.isValid()) {
+            tzfmt->format(style, *parsed, date, parsedName);
+        }
+        if (pos.getIndex() != name.length() || parsedName != name) {
+            errln(UnicodeString("Thread ") + threadNumber + ": \"" + name +
+                  "\" parsed to \"" + parsedName + "\", length " + pos.getIndex());
+        }
+    }
+}
+
 typedef struct {
     const char*     text;
     int32_t         inPos;
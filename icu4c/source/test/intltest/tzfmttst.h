@@ -34,9 +34,11 @@ class TimeZoneFormatTest : public IntlTest {
     void TestBogusLocale();
     void Test22614GetMetaZoneNamesNotCrash();
     void Test22615NonASCIIID();
+    void TestParseThreadSafe();
 
     void RunTimeRoundTripTests(int32_t threadNumber);
     void RunAdoptDefaultThreadSafeTests(int32_t threadNumber);
+    void RunParseThreadSafeTests(int32_t threadNumber);
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
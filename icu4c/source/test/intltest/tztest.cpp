@@ -17,6 +17,8 @@
 #include "unicode/localpointer.h"
 #include "unicode/resbund.h"
 #include "unicode/strenum.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/ustring.h"
 #include "unicode/uversion.h"
 #include "tztest.h"
@@ -81,6 +83,7 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestRawOffsetAndOffsetConsistency22041);
     TESTCASE_AUTO(TestGetIanaID);
     TESTCASE_AUTO(TestGMTMinus24ICU22526);
+    TESTCASE_AUTO(TestOffsetsAroundTransitions);
     TESTCASE_AUTO_END;
 }
 
@@ -2701,4 +2704,65 @@ void TimeZoneTest::TestGMTMinus24ICU22526() {
     gc.setTime(123456789, status);
     gc.get(UCAL_MONTH, status);
 }
+
+// The offsets of a zone must change exactly at its transitions, both in the
+// historical data and in the final rule, as far as the rule is expanded
+// into a table and beyond.
+void TimeZoneTest::TestOffsetsAroundTransitions() {
+    IcuTestErrorCode status(*this, "TestOffsetsAroundTransitions");
+    LocalPointer<StringEnumeration> s(TimeZone::createEnumeration(status));
+    if (status.errDataIfFailureAndReset("Unable to create TimeZone enumeration")) {
+        return;
+    }
+    static const UTimeZoneLocalOption options[] = {
+        UCAL_TZ_LOCAL_FORMER, UCAL_TZ_LOCAL_LATTER,
+        UCAL_TZ_LOCAL_STANDARD_FORMER, UCAL_TZ_LOCAL_STANDARD_LATTER,
+        UCAL_TZ_LOCAL_DAYLIGHT_FORMER, UCAL_TZ_LOCAL_DAYLIGHT_LATTER
+    };
+    const UDate start = -3786825600000.0;  // 1850-01-01T00:00Z
+    const UDate end = 5680281600000.0;     // 2150-01-01T00:00Z
+    const char* id;
+    while ((id = s->next(nullptr, status)) != nullptr && status.isSuccess()) {
+        LocalPointer<BasicTimeZone> tz(dynamic_cast<BasicTimeZone*>(TimeZone::createTimeZone(id)));
+        if (tz.isNull()) {
+            continue;
+        }
+        LocalPointer<BasicTimeZone> clone(tz->clone());
+        TimeZoneTransition tzt;
+        UDate t = start;
+        while (tz->getNextTransition(t, false, tzt) && tzt.getTime() < end) {
+            UDate next = tzt.getTime();
+            int32_t fromRaw = tzt.getFrom()->getRawOffset();
+            int32_t fromDst = tzt.getFrom()->getDSTSavings();
+            int32_t toRaw = tzt.getTo()->getRawOffset();
+            int32_t toDst = tzt.getTo()->getDSTSavings();
+            int32_t raw, dst;
+            tz->getOffset(next - 1, false, raw, dst, status);
+            if (raw != fromRaw || dst != fromDst) {
+                errln("FAIL: %s offsets before transition at %.0f are %d/%d, expected %d/%d",
+                      id, next, raw, dst, fromRaw, fromDst);
+            }
+            clone->getOffset(next, false, raw, dst, status);
+            if (raw != toRaw || dst != toDst) {
+                errln("FAIL: %s offsets at transition at %.0f are %d/%d, expected %d/%d",
+                      id, next, raw, dst, toRaw, toDst);
+            }
+            // A local time in the middle of the previous period is unambiguous.
+            if (t > start) {
+                UDate local = t + (next - t) / 2 + fromRaw + fromDst;
+                for (auto nonExisting : options) {
+                    for (auto duplicated : options) {
+                        tz->getOffsetFromLocal(local, nonExisting, duplicated, raw, dst, status);
+                        if (raw != fromRaw || dst != fromDst) {
+                            errln("FAIL: %s offsets from local time %.0f are %d/%d, expected %d/%d",
+                                  id, local, raw, dst, fromRaw, fromDst);
+                        }
+                    }
+                }
+            }
+            t = next;
+        }
+        status.errIfFailureAndReset("%s", id);
+    }
+}
 #endif /* #if !UCONFIG_NO_FORMATTING */
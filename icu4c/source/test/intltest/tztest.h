@@ -106,6 +106,7 @@ class TimeZoneTest: public CalendarTimeZoneTest {
     void TestCasablancaNameAndOffset22041();
     void TestRawOffsetAndOffsetConsistency22041();
     void TestGMTMinus24ICU22526();
+    void TestOffsetsAroundTransitions();
 
     void TestGetIanaID();
 
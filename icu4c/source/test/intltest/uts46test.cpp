@@ -19,6 +19,8 @@
 #if !UCONFIG_NO_IDNA
 
 #include <string.h>
+#include <string>
+#include <vector>
 #include "unicode/bytestream.h"
 #include "unicode/idna.h"
 #include "unicode/localpointer.h"
@@ -34,7 +36,7 @@
 
 class UTS46Test : public IntlTest {
 public:
-    UTS46Test() : trans(nullptr), nontrans(nullptr) {}
+    UTS46Test() : trans(nullptr), nontrans(nullptr), labelCache(nullptr) {}
     virtual ~UTS46Test();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=nullptr) override;
@@ -45,6 +47,8 @@ class UTS46Test : public IntlTest {
     void TestDefaultNontransitional();
     void TestTooLong();
     void TestSomeCases();
+    void TestUTF8IllFormedAndLong();
+    void TestNameToASCIIBatch();
     void IdnaTest();
 
     void checkIdnaTestResult(const char *line, const char *type,
@@ -54,6 +58,7 @@ class UTS46Test : public IntlTest {
 
 private:
     IDNA *trans, *nontrans;
+    IDNALabelCache *labelCache;  // shared by all lines of IdnaTestV2.txt
 };
 
 extern IntlTest *createUTS46Test() {
@@ -92,6 +97,8 @@ void UTS46Test::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestDefaultNontransitional);
     TESTCASE_AUTO(TestTooLong);
     TESTCASE_AUTO(TestSomeCases);
+    TESTCASE_AUTO(TestUTF8IllFormedAndLong);
+    TESTCASE_AUTO(TestNameToASCIIBatch);
     TESTCASE_AUTO(IdnaTest);
     TESTCASE_AUTO_END;
 }
@@ -1040,6 +1047,181 @@ void UTS46Test::TestSomeCases() {
     }
 }
 
+void UTS46Test::TestUTF8IllFormedAndLong() {
+    // The UTF-8 functions process UTF-8 natively.
+    // Ill-formed sequences must behave like the U+FFFD that fromUTF8() turns them into,
+    // and inputs longer than the ASCII fastpath buffer must work like shorter ones.
+    IcuTestErrorCode errorCode(*this, "TestUTF8IllFormedAndLong()");
+    std::string longName;
+    while(longName.length()<300) {
+        longName.append("b\xC3\xBC" "cher.example.");
+    }
+    longName.append("de");
+    std::string longLabel(100, 'a');
+    longLabel.append("\xC3\xA4");
+    // Non-ASCII labels that are longer in UTF-8 bytes than the Punycode input limit
+    // but not in UTF-16 code units.
+    std::string cjkLabel;
+    for(int32_t i=0; i<400; ++i) {
+        cjkLabel.append("\xE4\xBE\x8B");  // U+4F8B
+    }
+    std::string maxCJKLabel;
+    for(int32_t i=0; i<1000; ++i) {
+        maxCJKLabel.append("\xE4\xBE\x8B");
+    }
+    std::string supplementaryLabel;
+    for(int32_t i=0; i<300; ++i) {
+        supplementaryLabel.append("\xF0\xA0\x80\x80");  // U+20000
+    }
+    const std::string inputs[] = {
+        std::string("a\x80" "b.de"),  // lone trail byte
+        std::string("www.a\xC3.de"),  // truncated sequence
+        std::string("www.\xED\xA0\x80" "x.com"),  // surrogate
+        std::string("\xF4\x90\x80\x80.de"),  // beyond U+10FFFF
+        std::string("\xC0\xAE" "de"),  // non-shortest form of "."
+        std::string("ab--\xC3\xBC.de"),  // hyphens 3 & 4
+        std::string("-b\xC3\xBC" "cher-.de"),
+        std::string("fa\xC3\x9F.d\xC3\xA9\xE2\x80\x8C.com"),  // sharp s, ZWNJ
+        std::string("\xD7\x90\xD7\x91.1a.com"),  // BiDi with a leading digit label
+        std::string("www.example.com.\xCC\x81x"),  // leading combining mark
+        longName,
+        longName+"\xFF",
+        longLabel+".com",
+        cjkLabel+".com",
+        maxCJKLabel+".com",
+        supplementaryLabel+".com",
+    };
+    for(int32_t i=0; i<UPRV_LENGTHOF(inputs); ++i) {
+        const std::string &input8=inputs[i];
+        UnicodeString input=UnicodeString::fromUTF8(input8);
+        for(int32_t j=0; j<8; ++j) {
+            const IDNA &idna=(j&1)==0 ? *trans : *nontrans;
+            bool isLabel=(j&2)!=0;
+            bool toASCII=(j&4)!=0;
+            UnicodeString result;
+            IDNAInfo info;
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            IDNAInfo info8;
+            if(isLabel) {
+                if(toASCII) {
+                    idna.labelToASCII(input, result, info, errorCode);
+                    idna.labelToASCII_UTF8(input8, sink, info8, errorCode);
+                } else {
+                    idna.labelToUnicode(input, result, info, errorCode);
+                    idna.labelToUnicodeUTF8(input8, sink, info8, errorCode);
+                }
+            } else {
+                if(toASCII) {
+                    idna.nameToASCII(input, result, info, errorCode);
+                    idna.nameToASCII_UTF8(input8, sink, info8, errorCode);
+                } else {
+                    idna.nameToUnicode(input, result, info, errorCode);
+                    idna.nameToUnicodeUTF8(input8, sink, info8, errorCode);
+                }
+            }
+            if(errorCode.errIfFailureAndReset("[%d] variant %d", static_cast<int>(i),
+                                              static_cast<int>(j))) {
+                continue;
+            }
+            if(UnicodeString::fromUTF8(result8)!=result) {
+                errln("[%d] variant %d: UTF-8 vs. UTF-16 processing different string results",
+                      static_cast<int>(i), static_cast<int>(j));
+            }
+            if(info8.getErrors()!=info.getErrors()) {
+                errln("[%d] variant %d: UTF-8 vs. UTF-16 processing different errors %04lx vs. %04lx",
+                      static_cast<int>(i), static_cast<int>(j),
+                      static_cast<long>(info8.getErrors()), static_cast<long>(info.getErrors()));
+            }
+            if(info8.isTransitionalDifferent()!=info.isTransitionalDifferent()) {
+                errln("[%d] variant %d: UTF-8 vs. UTF-16 processing different isTransitionalDifferent()",
+                      static_cast<int>(i), static_cast<int>(j));
+            }
+        }
+    }
+}
+
+void UTS46Test::TestNameToASCIIBatch() {
+    IcuTestErrorCode errorCode(*this, "TestNameToASCIIBatch()");
+    // All of the test cases, twice so that the second time they come from the cache,
+    // plus some that cannot be processed label by label.
+    std::vector<std::string> inputs;
+    for(int32_t round=0; round<2; ++round) {
+        for(int32_t i=0; i<UPRV_LENGTHOF(testCases); ++i) {
+            std::string input8;
+            inputs.push_back(ctou(testCases[i].s).toUTF8String(input8));
+        }
+    }
+    inputs.push_back("a\xE3\x80\x82" "b.com");  // ideographic full stop maps to a dot
+    inputs.push_back("a.\xC2\xAD.com");  // soft hyphen maps to nothing
+    inputs.push_back("www.a\xC3.de");  // ill-formed
+    inputs.push_back(std::string("www.a\0b.de", 11));  // NUL
+    inputs.push_back(std::string(300, 'a')+".\xC3\xA4");  // too long to cache
+    std::vector<StringPiece> names;
+    for(const std::string &input : inputs) {
+        names.push_back(input);
+    }
+    int32_t count=static_cast<int32_t>(names.size());
+    std::vector<int32_t> limits(count), preflightLimits(count);
+    std::vector<uint32_t> errors(count);
+
+    // A small cache to exercise clearing it when it is full,
+    // shared by instances with different options.
+    IDNALabelCache cache(20, errorCode);
+    const IDNA *instances[] = { trans, nontrans, trans };
+    for(int32_t j=0; j<UPRV_LENGTHOF(instances); ++j) {
+        const IDNA &idna=*instances[j];
+        for(IDNALabelCache *c : { static_cast<IDNALabelCache *>(nullptr), &cache }) {
+            int32_t length=idna.nameToASCIIBatch(names.data(), count, nullptr, 0,
+                                                 preflightLimits.data(), nullptr,
+                                                 c, errorCode);
+            assertEquals("preflighting", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+            std::string dest(length+1, 'x');
+            assertEquals("batch length", length,
+                         idna.nameToASCIIBatch(names.data(), count, dest.data(), length+1,
+                                               limits.data(), errors.data(), c, errorCode));
+            if(errorCode.errIfFailureAndReset("[%d] nameToASCIIBatch()", static_cast<int>(j))) {
+                continue;
+            }
+            assertTrue("NUL-terminated", dest[length]==0);
+            if(c!=nullptr) {
+                assertTrue("the cache is used", cache.size()>0);
+            }
+            int32_t start=0;
+            for(int32_t i=0; i<count; ++i) {
+                std::string expected;
+                StringByteSink<std::string> sink(&expected);
+                IDNAInfo info;
+                idna.nameToASCII_UTF8(names[i], sink, info, errorCode);
+                std::string actual=dest.substr(start, limits[i]-start);
+                if(actual!=expected || errors[i]!=info.getErrors() ||
+                        preflightLimits[i]!=limits[i]) {
+                    errln("[%d] nameToASCIIBatch(%s) cache=%d different from nameToASCII_UTF8(): "
+                          "\"%s\" errors %04lx vs. \"%s\" errors %04lx",
+                          static_cast<int>(j), inputs[i].c_str(), c!=nullptr,
+                          actual.c_str(), static_cast<long>(errors[i]),
+                          expected.c_str(), static_cast<long>(info.getErrors()));
+                }
+                start=limits[i];
+            }
+        }
+    }
+    cache.clear();
+    assertEquals("cleared", 0, cache.size());
+
+    IDNALabelCache badCache(0, errorCode);
+    assertEquals("capacity 0", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    char dest[20];
+    int32_t limit;
+    trans->nameToASCIIBatch(names.data(), -1, dest, UPRV_LENGTHOF(dest), &limit, nullptr,
+                            nullptr, errorCode);
+    assertEquals("count<0", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    assertEquals("no names", 0,
+                 trans->nameToASCIIBatch(nullptr, 0, dest, UPRV_LENGTHOF(dest), nullptr, nullptr,
+                                         nullptr, errorCode));
+    errorCode.errIfFailureAndReset("no names");
+}
+
 namespace {
 
 const int32_t kNumFields = 7;
@@ -1174,6 +1356,22 @@ void UTS46Test::idnaTestOneLine(char *fields[][2], UErrorCode &errorCode) {
     trans->nameToASCII(source, aT, aTInfo, errorCode);
     checkIdnaTestResult(fields[0][0], "toASCIITrans", toAsciiT, aT,
                         toAsciiTStatus.c_str(), aTInfo);
+    if (labelCache != nullptr) {
+        // The batch function with cached labels must yield the same results.
+        std::string source8;
+        source.toUTF8String(source8);
+        StringPiece name(source8);
+        char dest[1000];
+        int32_t limit;
+        uint32_t errors;
+        int32_t length = nontrans->nameToASCIIBatch(&name, 1, dest, UPRV_LENGTHOF(dest),
+                                                    &limit, &errors, labelCache, errorCode);
+        if (U_SUCCESS(errorCode) &&
+                (UnicodeString::fromUTF8(StringPiece(dest, length)) != aN ||
+                 errors != aNInfo.getErrors())) {
+            errln("%s: nameToASCIIBatch() with cache differs from nameToASCII()", fields[0][0]);
+        }
+    }
 }
 
 namespace {
@@ -1202,7 +1400,10 @@ void UTS46Test::IdnaTest() {
     // Leading and trailing spaces and tabs in each column are ignored.
     // Comments are indicated with hash marks.
     char *fields[kNumFields][2];
+    LocalPointer<IDNALabelCache> cache(new IDNALabelCache(1000, errorCode), errorCode);
+    labelCache = cache.getAlias();
     u_parseDelimitedFile(path.data(), ';', fields, kNumFields, idnaTestLineFn, this, errorCode);
+    labelCache = nullptr;
     if (errorCode.errIfFailureAndReset("error parsing IdnaTestV2.txt")) {
         return;
     }
@@ -60,6 +60,33 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25,DateParseZone250);
+        TESTCASE(26,DateParseZoneThreads250);
+        TESTCASE(27,DateParseGenericZone250);
+        TESTCASE(28,DateParseGenericZoneThreads250);
+        TESTCASE(29,TimeZoneOffsetHistorical);
+        TESTCASE(30,TimeZoneOffsetFuture);
+        TESTCASE(31,TimeZoneOffsetFromLocalHistorical);
+        TESTCASE(32,TimeZoneOffsetFromLocalFuture);
+        TESTCASE(33,DatePatternFmtNumeric);
+        TESTCASE(34,DatePatternFmtNumericZone);
+        TESTCASE(35,DatePatternFmtText);
+        TESTCASE(36,DatePatternParseNumeric);
+        TESTCASE(37,DatePatternParseAbutting);
+        TESTCASE(38,DatePatternParseText);
+        TESTCASE(39,CalendarFmtHebrew);
+        TESTCASE(40,CalendarFmtHebrewThreads);
+        TESTCASE(41,CalendarFmtIslamic);
+        TESTCASE(42,CalendarFmtIslamicThreads);
+        TESTCASE(43,CalendarFmtChinese);
+        TESTCASE(44,CalendarFmtChineseThreads);
+        TESTCASE(45,CalendarConvertHebrew);
+        TESTCASE(46,CalendarConvertIslamic);
+        TESTCASE(47,CalendarConvertIslamicCivil);
+        TESTCASE(48,CalendarConvertIslamicTBLA);
+        TESTCASE(49,CalendarConvertIslamicUmalqura);
+        TESTCASE(50,CalendarFieldsEach);
+        TESTCASE(51,CalendarFieldsBatch);
 
 
         default: 
@@ -85,6 +112,124 @@ UPerfFunction* DateFormatPerfTest::DateFmt100000(){
     return func;
 }
 
+UPerfFunction* DateFormatPerfTest::DateParseZone250(){
+    DateParseZoneFunction* func= new DateParseZoneFunction(1, locale, "yyyy-MM-dd HH:mm zzzz", 1);
+    return func;
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseZoneThreads250(){
+    DateParseZoneFunction* func= new DateParseZoneFunction(1, locale, "yyyy-MM-dd HH:mm zzzz", 4);
+    return func;
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseGenericZone250(){
+    DateParseZoneFunction* func= new DateParseZoneFunction(1, locale, "yyyy-MM-dd HH:mm vvvv", 1);
+    return func;
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseGenericZoneThreads250(){
+    DateParseZoneFunction* func= new DateParseZoneFunction(1, locale, "yyyy-MM-dd HH:mm vvvv", 4);
+    return func;
+}
+
+// Historical dates are governed by the transitions of a zone,
+// future ones by its final rule.
+UPerfFunction* DateFormatPerfTest::TimeZoneOffsetHistorical(){
+    return new TimeZoneOffsetFunction(1900, 2000, false);
+}
+
+UPerfFunction* DateFormatPerfTest::TimeZoneOffsetFuture(){
+    return new TimeZoneOffsetFunction(2030, 2070, false);
+}
+
+UPerfFunction* DateFormatPerfTest::TimeZoneOffsetFromLocalHistorical(){
+    return new TimeZoneOffsetFunction(1900, 2000, true);
+}
+
+UPerfFunction* DateFormatPerfTest::TimeZoneOffsetFromLocalFuture(){
+    return new TimeZoneOffsetFunction(2030, 2070, true);
+}
+
+// All-numeric patterns in the Gregorian calendar are formatted without
+// setting up a Calendar.
+UPerfFunction* DateFormatPerfTest::DatePatternFmtNumeric(){
+    return new DatePatternFmtFunction(locale, "yyyy-MM-dd HH:mm:ss.SSS", "GMT");
+}
+
+UPerfFunction* DateFormatPerfTest::DatePatternFmtNumericZone(){
+    return new DatePatternFmtFunction(locale, "yyyy-MM-dd HH:mm:ss.SSS", "America/New_York");
+}
+
+UPerfFunction* DateFormatPerfTest::DatePatternFmtText(){
+    return new DatePatternFmtFunction(locale, "EEEE, MMMM d, y 'at' h:mm:ss a", "GMT");
+}
+
+UPerfFunction* DateFormatPerfTest::DatePatternParseNumeric(){
+    return new DatePatternFmtFunction(locale, "yyyy-MM-dd HH:mm:ss.SSS", "GMT", true);
+}
+
+UPerfFunction* DateFormatPerfTest::DatePatternParseAbutting(){
+    return new DatePatternFmtFunction(locale, "yyyyMMddHHmmss", "GMT", true);
+}
+
+UPerfFunction* DateFormatPerfTest::DatePatternParseText(){
+    return new DatePatternFmtFunction(locale, "EEEE, MMMM d, y 'at' h:mm:ss a", "GMT", true);
+}
+
+// Lunar and lunisolar calendars look up month and year starts in a
+// cache shared by all threads.
+UPerfFunction* DateFormatPerfTest::CalendarFmtHebrew(){
+    return new CalendarFmtFunction("he@calendar=hebrew", 1);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFmtHebrewThreads(){
+    return new CalendarFmtFunction("he@calendar=hebrew", 4);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFmtIslamic(){
+    return new CalendarFmtFunction("ar@calendar=islamic", 1);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFmtIslamicThreads(){
+    return new CalendarFmtFunction("ar@calendar=islamic", 4);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFmtChinese(){
+    return new CalendarFmtFunction("zh@calendar=chinese", 1);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFmtChineseThreads(){
+    return new CalendarFmtFunction("zh@calendar=chinese", 4);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarConvertHebrew(){
+    return new CalendarConvertFunction("he@calendar=hebrew");
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarConvertIslamic(){
+    return new CalendarConvertFunction("ar@calendar=islamic");
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarConvertIslamicCivil(){
+    return new CalendarConvertFunction("ar@calendar=islamic-civil");
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarConvertIslamicTBLA(){
+    return new CalendarConvertFunction("ar@calendar=islamic-tbla");
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarConvertIslamicUmalqura(){
+    return new CalendarConvertFunction("ar@calendar=islamic-umalqura");
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFieldsEach(){
+    return new CalendarFieldsFunction(false);
+}
+
+UPerfFunction* DateFormatPerfTest::CalendarFieldsBatch(){
+    return new CalendarFieldsFunction(true);
+}
+
 UPerfFunction* DateFormatPerfTest::BreakItWord250(){
     BreakItFunction* func= new BreakItFunction(250, true);
     return func;
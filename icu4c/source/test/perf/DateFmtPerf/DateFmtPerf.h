@@ -21,7 +21,10 @@
 #include "unicode/dtitvfmt.h"
 #include "unicode/utypes.h"
 #include "unicode/datefmt.h"
+#include "unicode/localpointer.h"
+#include "unicode/smpdtfmt.h"
 #include "unicode/calendar.h"
+#include "unicode/basictz.h"
 #include "unicode/uclean.h"
 #include "unicode/brkiter.h"
 #include "unicode/numfmt.h"
@@ -36,6 +39,8 @@
 #include <string.h>
 
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include <iostream>
 using namespace std;
@@ -236,6 +241,86 @@ class DateFmtFunction : public UPerfFunction
 
 };
 
+// Parses dates with time zone names, in one or more threads at once.
+// The threads share the time zone names of the locale, and with them the
+// tries that the names are looked up in.
+class DateParseZoneFunction : public UPerfFunction
+{
+
+private:
+	int num;
+	int threadCount;
+	LocalPointer<DateFormat> fmt;
+	std::vector<UnicodeString> dates;
+
+	void parseAll(UErrorCode *status)
+	{
+		LocalPointer<DateFormat> clone(fmt->clone());
+		for(int j = 0; j < num; j++)
+			for(int i = 0; i < NUM_DATES; i++)
+			{
+				UErrorCode status2 = U_ZERO_ERROR;
+				clone->parse(dates[i], status2);
+				if (U_FAILURE(status2)) {
+					*status = status2;
+				}
+			}
+	}
+
+public:
+
+	DateParseZoneFunction(int a, const char* loc, const char* pat, int threads)
+	{
+		// Format the dates (imported from datedata.h) in zones with
+		// different names.
+		static const char* const zones[] = {
+			"America/Los_Angeles", "America/New_York", "Europe/Paris",
+			"Europe/London", "Asia/Tokyo", "Australia/Sydney"
+		};
+		UErrorCode status = U_ZERO_ERROR;
+		num = a;
+		threadCount = threads;
+		fmt.adoptInstead(new SimpleDateFormat(UnicodeString(pat, -1, US_INV), Locale(loc), status));
+		LocalPointer<Calendar> cal(Calendar::createInstance(status));
+		if (U_FAILURE(status)) {
+			printf("ERROR: %s (DateParseZoneFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		dates.resize(NUM_DATES);
+		for(int i = 0; i < NUM_DATES; i++)
+		{
+			fmt->adoptTimeZone(TimeZone::createTimeZone(zones[i % UPRV_LENGTHOF(zones)]));
+			cal->clear();
+			cal->set(years[i], months[i], days[i]);
+			fmt->format(cal->getTime(status), dates[i]);
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		if (threadCount <= 1) {
+			parseAll(status);
+			return;
+		}
+		std::vector<std::thread> threads;
+		std::vector<UErrorCode> statuses(threadCount, U_ZERO_ERROR);
+		for (int t = 0; t < threadCount; t++) {
+			threads.emplace_back(&DateParseZoneFunction::parseAll, this, &statuses[t]);
+		}
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].join();
+			if (U_FAILURE(statuses[t])) {
+				*status = statuses[t];
+			}
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return NUM_DATES * num * threadCount;
+	}
+};
+
 class DateFmtCreateFunction : public UPerfFunction
 {
 
@@ -415,6 +500,317 @@ class TimeZoneCreateFunction : public UPerfFunction
 
 };
 
+// Gets the offsets of time zones for dates spread over a range of years,
+// from UTC or from local time.
+class TimeZoneOffsetFunction : public UPerfFunction
+{
+
+private:
+	enum { NUM_OFFSET_DATES = 1000 };
+	UBool local;
+	std::vector<LocalPointer<BasicTimeZone>> zones;
+	double dates[NUM_OFFSET_DATES];
+
+public:
+
+	TimeZoneOffsetFunction(int32_t startYear, int32_t endYear, UBool fromLocal)
+	{
+		static const char* const ids[] = {
+			"America/New_York", "America/Los_Angeles", "America/Sao_Paulo",
+			"Europe/London", "Europe/Berlin", "Australia/Sydney"
+		};
+		local = fromLocal;
+		for (int32_t i = 0; i < UPRV_LENGTHOF(ids); i++) {
+			zones.emplace_back(dynamic_cast<BasicTimeZone*>(
+				TimeZone::createTimeZone(UnicodeString(ids[i], -1, US_INV))));
+			if (zones.back().isNull()) {
+				printf("ERROR: no BasicTimeZone for %s\n", ids[i]);
+				exit(1);
+			}
+		}
+		UErrorCode status = U_ZERO_ERROR;
+		LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), status));
+		if (U_FAILURE(status)) {
+			printf("ERROR: %s (TimeZoneOffsetFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		cal->clear();
+		cal->set(startYear, UCAL_JANUARY, 1);
+		double start = cal->getTime(status);
+		cal->set(endYear, UCAL_JANUARY, 1);
+		double step = (cal->getTime(status) - start) / NUM_OFFSET_DATES;
+		for (int32_t i = 0; i < NUM_OFFSET_DATES; i++) {
+			// Spread the dates over the hours of the day, too.
+			dates[i] = start + i * step + (i % 24) * 3600000.0;
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		int32_t raw, dst;
+		for (const auto& zone : zones) {
+			for (int32_t i = 0; i < NUM_OFFSET_DATES; i++) {
+				if (local) {
+					zone->getOffsetFromLocal(dates[i], UCAL_TZ_LOCAL_FORMER, UCAL_TZ_LOCAL_LATTER,
+						raw, dst, *status);
+				} else {
+					zone->getOffset(dates[i], false, raw, dst, *status);
+				}
+			}
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return static_cast<long>(zones.size()) * NUM_OFFSET_DATES;
+	}
+};
+
+// Formats the dates from datedata.h with a SimpleDateFormat pattern,
+// in a fixed time zone, or parses the formatted dates.
+class DatePatternFmtFunction : public UPerfFunction
+{
+
+private:
+	LocalPointer<SimpleDateFormat> fmt;
+	std::vector<UDate> dates;
+	std::vector<UnicodeString> strings;
+	UBool parse;
+
+public:
+
+	DatePatternFmtFunction(const char* loc, const char* pattern, const char* zoneID, UBool parseDates = false)
+	{
+		UErrorCode status = U_ZERO_ERROR;
+		TimeZone* zone = TimeZone::createTimeZone(UnicodeString(zoneID, -1, US_INV));
+		fmt.adoptInsteadAndCheckErrorCode(
+			new SimpleDateFormat(UnicodeString(pattern, -1, US_INV), Locale(loc), status), status);
+		LocalPointer<Calendar> cal(Calendar::createInstance(zone->clone(), status));
+		if (U_FAILURE(status)) {
+			printf("ERROR: %s (DatePatternFmtFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		fmt->adoptTimeZone(zone);
+		parse = parseDates;
+		dates.resize(NUM_DATES);
+		strings.resize(NUM_DATES);
+		for (int32_t i = 0; i < NUM_DATES; i++) {
+			cal->clear();
+			cal->set(years[i], months[i], days[i], i % 24, (i * 7) % 60, (i * 13) % 60);
+			dates[i] = cal->getTime(status) + i % 1000;
+			fmt->format(dates[i], strings[i]);
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		if (parse) {
+			for (int32_t i = 0; i < NUM_DATES; i++) {
+				fmt->parse(strings[i], *status);
+			}
+			return;
+		}
+		UnicodeString str;
+		for (int32_t i = 0; i < NUM_DATES; i++) {
+			str.remove();
+			fmt->format(dates[i], str, *status);
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return NUM_DATES;
+	}
+};
+
+class CalendarFmtFunction : public UPerfFunction
+{
+
+private:
+	int threadCount;
+	LocalPointer<DateFormat> fmt;
+	std::vector<UDate> dates;
+
+	void formatAll(UErrorCode *status)
+	{
+		LocalPointer<DateFormat> clone(fmt->clone());
+		if (clone.isNull()) {
+			*status = U_MEMORY_ALLOCATION_ERROR;
+			return;
+		}
+		UnicodeString str;
+		for(int i = 0; i < NUM_DATES; i++)
+		{
+			str.remove();
+			clone->format(dates[i], str);
+		}
+	}
+
+public:
+
+	// Formats the dates (imported from datedata.h) in the calendar of the
+	// locale, with each thread using its own clone of the formatter.
+	CalendarFmtFunction(const char* loc, int threads)
+	{
+		UErrorCode status = U_ZERO_ERROR;
+		threadCount = threads;
+		fmt.adoptInstead(DateFormat::createDateInstance(DateFormat::kLong, Locale(loc)));
+		LocalPointer<Calendar> cal(Calendar::createInstance(status));
+		if (U_FAILURE(status) || fmt.isNull()) {
+			printf("ERROR: %s (CalendarFmtFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		dates.resize(NUM_DATES);
+		for(int i = 0; i < NUM_DATES; i++)
+		{
+			cal->clear();
+			cal->set(years[i], months[i], days[i]);
+			dates[i] = cal->getTime(status);
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		if (threadCount <= 1) {
+			formatAll(status);
+			return;
+		}
+		std::vector<std::thread> threads;
+		std::vector<UErrorCode> statuses(threadCount, U_ZERO_ERROR);
+		for (int t = 0; t < threadCount; t++) {
+			threads.emplace_back(&CalendarFmtFunction::formatAll, this, &statuses[t]);
+		}
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].join();
+			if (U_FAILURE(statuses[t])) {
+				*status = statuses[t];
+			}
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return NUM_DATES * threadCount;
+	}
+};
+
+class CalendarConvertFunction : public UPerfFunction
+{
+
+private:
+	LocalPointer<Calendar> cal;
+	std::vector<UDate> dates;
+
+public:
+
+	// Converts each of the dates (imported from datedata.h) to the fields
+	// of the calendar of the locale, and the fields back to a date.
+	CalendarConvertFunction(const char* loc)
+	{
+		UErrorCode status = U_ZERO_ERROR;
+		cal.adoptInstead(Calendar::createInstance(TimeZone::getGMT()->clone(), Locale(loc), status));
+		LocalPointer<Calendar> gregorian(Calendar::createInstance(status));
+		if (U_FAILURE(status)) {
+			printf("ERROR: %s (CalendarConvertFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		dates.resize(NUM_DATES);
+		for(int i = 0; i < NUM_DATES; i++)
+		{
+			gregorian->clear();
+			gregorian->set(years[i], months[i], days[i]);
+			dates[i] = gregorian->getTime(status);
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		for(int i = 0; i < NUM_DATES; i++)
+		{
+			cal->setTime(dates[i], *status);
+			int32_t year = cal->get(UCAL_EXTENDED_YEAR, *status);
+			int32_t month = cal->get(UCAL_MONTH, *status);
+			int32_t day = cal->get(UCAL_DAY_OF_MONTH, *status);
+			cal->clear();
+			cal->set(UCAL_EXTENDED_YEAR, year);
+			cal->set(UCAL_MONTH, month);
+			cal->set(UCAL_DATE, day);
+			cal->getTime(*status);
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return NUM_DATES;
+	}
+};
+
+class CalendarFieldsFunction : public UPerfFunction
+{
+
+private:
+	LocalPointer<Calendar> cal;
+	bool batch;
+	std::vector<UDate> dates;
+	std::vector<int32_t> values;
+	std::vector<int32_t*> results;
+
+	static constexpr int32_t kDateCount = 10000;
+	static constexpr UCalendarDateFields kFields[] = {
+		UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_DAY_OF_WEEK, UCAL_HOUR_OF_DAY, UCAL_MINUTE
+	};
+	static constexpr int32_t kFieldCount = UPRV_LENGTHOF(kFields);
+
+public:
+
+	// Computes the fields of hourly dates (a log-like ascending sequence)
+	// in America/Los_Angeles, either one date at a time with setTime() and get(),
+	// or with one computeFieldsBatch() call.
+	CalendarFieldsFunction(bool useBatch)
+	{
+		UErrorCode status = U_ZERO_ERROR;
+		cal.adoptInstead(Calendar::createInstance(
+			TimeZone::createTimeZone("America/Los_Angeles"), Locale("en_US"), status));
+		if (U_FAILURE(status)) {
+			printf("ERROR: %s (CalendarFieldsFunction)\n", u_errorName(status));
+			exit(1);
+		}
+		batch = useBatch;
+		dates.resize(kDateCount);
+		for(int i = 0; i < kDateCount; i++)
+		{
+			dates[i] = 1767225600000.0 + i * 3600000.0 + (i * 7919) % 3600000;
+		}
+		values.resize(kFieldCount * kDateCount);
+		results.resize(kFieldCount);
+		for(int j = 0; j < kFieldCount; j++)
+		{
+			results[j] = values.data() + j * kDateCount;
+		}
+	}
+
+	void call(UErrorCode* status) override
+	{
+		if (batch) {
+			cal->computeFieldsBatch(dates.data(), kDateCount, kFields, kFieldCount, results.data(), *status);
+			return;
+		}
+		for(int i = 0; i < kDateCount; i++)
+		{
+			cal->setTime(dates[i], *status);
+			for(int j = 0; j < kFieldCount; j++)
+			{
+				results[j][i] = cal->get(kFields[j], *status);
+			}
+		}
+	}
+
+	long getOperationsPerIteration() override
+	{
+		return kDateCount;
+	}
+};
+
 class DTPatternGeneratorCreateFunction : public UPerfFunction
 {
 
@@ -842,6 +1238,33 @@ class DateFormatPerfTest : public UPerfTest
     UPerfFunction* DTPatternGeneratorCopy10000();
     UPerfFunction* DTPatternGeneratorBestValue250();
     UPerfFunction* DTPatternGeneratorBestValue10000();
+    UPerfFunction* DateParseZone250();
+    UPerfFunction* DateParseZoneThreads250();
+    UPerfFunction* DateParseGenericZone250();
+    UPerfFunction* DateParseGenericZoneThreads250();
+    UPerfFunction* TimeZoneOffsetHistorical();
+    UPerfFunction* TimeZoneOffsetFuture();
+    UPerfFunction* TimeZoneOffsetFromLocalHistorical();
+    UPerfFunction* TimeZoneOffsetFromLocalFuture();
+    UPerfFunction* DatePatternFmtNumeric();
+    UPerfFunction* DatePatternFmtNumericZone();
+    UPerfFunction* DatePatternFmtText();
+    UPerfFunction* DatePatternParseNumeric();
+    UPerfFunction* DatePatternParseAbutting();
+    UPerfFunction* DatePatternParseText();
+    UPerfFunction* CalendarFmtHebrew();
+    UPerfFunction* CalendarFmtHebrewThreads();
+    UPerfFunction* CalendarFmtIslamic();
+    UPerfFunction* CalendarFmtIslamicThreads();
+    UPerfFunction* CalendarFmtChinese();
+    UPerfFunction* CalendarFmtChineseThreads();
+    UPerfFunction* CalendarConvertHebrew();
+    UPerfFunction* CalendarConvertIslamic();
+    UPerfFunction* CalendarConvertIslamicCivil();
+    UPerfFunction* CalendarConvertIslamicTBLA();
+    UPerfFunction* CalendarConvertIslamicUmalqura();
+    UPerfFunction* CalendarFieldsEach();
+    UPerfFunction* CalendarFieldsBatch();
 };
 
 #endif // DateFmtPerf
@@ -0,0 +1,240 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include "unicode/bytestream.h"
+#include "unicode/idna.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uperf.h"
+
+using icu::CheckedArrayByteSink;
+using icu::IDNA;
+using icu::IDNAInfo;
+using icu::IDNALabelCache;
+using icu::StringPiece;
+using icu::UnicodeString;
+
+namespace {
+
+// Host names as they come out of URLs: mostly ASCII, some of them upper case,
+// with an occasional internationalized one.
+const char* const kMostlyASCIINames[] = {
+    "www.example.com",
+    "mail.google.com",
+    "WWW.Unicode.ORG",
+    "api.github.com",
+    "cdn.jsdelivr.net",
+    "en.wikipedia.org",
+    "b\xC3\xBC" "cher.example.de",                              // bücher
+    "static.xx.fbcdn.net",
+    "login.microsoftonline.com",
+    "s3.us-east-1.amazonaws.com",
+    "news.ycombinator.com",
+    "xn--mnchen-3ya.de",
+    "fonts.googleapis.com",
+    "docs.python.org",
+    "www.bbc.co.uk",
+    "\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88",  // 例え.テスト
+};
+
+// Internationalized host names only.
+const char* const kIDNNames[] = {
+    "b\xC3\xBC" "cher.example.de",                              // bücher
+    "M\xC3\xBCnchen.de",                                        // München
+    "\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88",  // 例え.テスト
+    "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xBC\xD0\xB5\xD1\x80.\xD1\x80\xD1\x84",  // пример.рф
+    "fa\xC3\x9F.de",                                            // faß
+    "\xCE\xB5\xCE\xBB\xCE\xBB\xCE\xB7\xCE\xBD\xCE\xB9\xCE\xBA\xCE\xAC.gr",  // ελληνικά
+    "\xD8\xA7\xD9\x84\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A\xD8\xA9.example",  // العربية
+    "caf\xC3\xA9.fr",                                           // café
+};
+
+template<int32_t count>
+int32_t countOf(const char* const (&)[count]) { return count; }
+
+enum Operation { TO_ASCII, TO_UNICODE };
+
+// Converts each name of a list with the UTF-8 API.
+class IDNAUTF8PerfFunction : public UPerfFunction {
+public:
+    IDNAUTF8PerfFunction(const IDNA& idna, Operation op, const char* const names[], int32_t count)
+            : fIDNA(idna), fOperation(op), fNames(names), fCount(count) {}
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < fCount; ++i) {
+            CheckedArrayByteSink sink(fBuffer, sizeof(fBuffer));
+            IDNAInfo info;
+            if (fOperation == TO_ASCII) {
+                fIDNA.nameToASCII_UTF8(fNames[i], sink, info, *status);
+            } else {
+                fIDNA.nameToUnicodeUTF8(fNames[i], sink, info, *status);
+            }
+        }
+    }
+    long getOperationsPerIteration() override { return fCount; }
+    long getEventsPerIteration() override { return fCount; }
+private:
+    const IDNA& fIDNA;
+    Operation fOperation;
+    const char* const* fNames;
+    int32_t fCount;
+    char fBuffer[256];
+};
+
+// Converts each name of a list with the UTF-16 API, for comparison.
+class IDNAUTF16PerfFunction : public UPerfFunction {
+public:
+    IDNAUTF16PerfFunction(const IDNA& idna, Operation op, const char* const names[], int32_t count)
+            : fIDNA(idna), fOperation(op), fCount(count) {
+        for (int32_t i = 0; i < count && i < kMaxCount; ++i) {
+            fNames[i] = UnicodeString::fromUTF8(names[i]);
+        }
+    }
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < fCount; ++i) {
+            IDNAInfo info;
+            if (fOperation == TO_ASCII) {
+                fIDNA.nameToASCII(fNames[i], fResult, info, *status);
+            } else {
+                fIDNA.nameToUnicode(fNames[i], fResult, info, *status);
+            }
+        }
+    }
+    long getOperationsPerIteration() override { return fCount; }
+    long getEventsPerIteration() override { return fCount; }
+private:
+    static constexpr int32_t kMaxCount = 16;
+    const IDNA& fIDNA;
+    Operation fOperation;
+    int32_t fCount;
+    UnicodeString fNames[kMaxCount];
+    UnicodeString fResult;
+};
+
+// Converts a list of names with one nameToASCIIBatch() call,
+// optionally with a label cache that is kept across calls.
+class IDNABatchPerfFunction : public UPerfFunction {
+public:
+    IDNABatchPerfFunction(const IDNA& idna, const char* const names[], int32_t count,
+                          bool useCache, UErrorCode& status)
+            : fIDNA(idna), fCount(count), fCache(useCache ? new IDNALabelCache(100, status) : nullptr) {
+        for (int32_t i = 0; i < count && i < kMaxCount; ++i) {
+            fNames[i] = names[i];
+        }
+    }
+    ~IDNABatchPerfFunction() override { delete fCache; }
+    void call(UErrorCode* status) override {
+        fIDNA.nameToASCIIBatch(fNames, fCount, fBuffer, sizeof(fBuffer),
+                               fLimits, fErrors, fCache, *status);
+    }
+    long getOperationsPerIteration() override { return fCount; }
+    long getEventsPerIteration() override { return fCount; }
+private:
+    static constexpr int32_t kMaxCount = 16;
+    const IDNA& fIDNA;
+    int32_t fCount;
+    IDNALabelCache* fCache;
+    StringPiece fNames[kMaxCount];
+    int32_t fLimits[kMaxCount];
+    uint32_t fErrors[kMaxCount];
+    char fBuffer[kMaxCount * 256];
+};
+
+}  // namespace
+
+class IDNAPerfTest : public UPerfTest {
+public:
+    IDNAPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
+            : UPerfTest(argc, argv, nullptr, 0, "idnaperf", status),
+              fIDNA(IDNA::createUTS46Instance(UIDNA_NONTRANSITIONAL_TO_ASCII |
+                                              UIDNA_NONTRANSITIONAL_TO_UNICODE |
+                                              UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ,
+                                              status)) {}
+    ~IDNAPerfTest() override { delete fIDNA; }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* TestNameToASCII_UTF8() {
+        return new IDNAUTF8PerfFunction(*fIDNA, TO_ASCII, kMostlyASCIINames, countOf(kMostlyASCIINames));
+    }
+    UPerfFunction* TestNameToASCII_UTF16() {
+        return new IDNAUTF16PerfFunction(*fIDNA, TO_ASCII, kMostlyASCIINames, countOf(kMostlyASCIINames));
+    }
+    UPerfFunction* TestNameToUnicodeUTF8() {
+        return new IDNAUTF8PerfFunction(*fIDNA, TO_UNICODE, kMostlyASCIINames, countOf(kMostlyASCIINames));
+    }
+    UPerfFunction* TestIDNToASCII_UTF8() {
+        return new IDNAUTF8PerfFunction(*fIDNA, TO_ASCII, kIDNNames, countOf(kIDNNames));
+    }
+    UPerfFunction* TestIDNToASCII_UTF16() {
+        return new IDNAUTF16PerfFunction(*fIDNA, TO_ASCII, kIDNNames, countOf(kIDNNames));
+    }
+    UPerfFunction* TestIDNToUnicodeUTF8() {
+        return new IDNAUTF8PerfFunction(*fIDNA, TO_UNICODE, kIDNNames, countOf(kIDNNames));
+    }
+    UPerfFunction* TestNameToASCIIBatch() {
+        return createBatch(kMostlyASCIINames, countOf(kMostlyASCIINames), false);
+    }
+    UPerfFunction* TestNameToASCIIBatchCached() {
+        return createBatch(kMostlyASCIINames, countOf(kMostlyASCIINames), true);
+    }
+    UPerfFunction* TestIDNToASCIIBatch() {
+        return createBatch(kIDNNames, countOf(kIDNNames), false);
+    }
+    UPerfFunction* TestIDNToASCIIBatchCached() {
+        return createBatch(kIDNNames, countOf(kIDNNames), true);
+    }
+
+    UPerfFunction* createBatch(const char* const names[], int32_t count, bool useCache) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction* function = new IDNABatchPerfFunction(*fIDNA, names, count, useCache, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Error creating the label cache: %s\n", u_errorName(status));
+            delete function;
+            return nullptr;
+        }
+        return function;
+    }
+
+    IDNA* fIDNA;
+};
+
+UPerfFunction*
+IDNAPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestNameToASCII_UTF8);
+    TESTCASE_AUTO(TestNameToASCII_UTF16);
+    TESTCASE_AUTO(TestNameToUnicodeUTF8);
+    TESTCASE_AUTO(TestIDNToASCII_UTF8);
+    TESTCASE_AUTO(TestIDNToASCII_UTF16);
+    TESTCASE_AUTO(TestIDNToUnicodeUTF8);
+    TESTCASE_AUTO(TestNameToASCIIBatch);
+    TESTCASE_AUTO(TestNameToASCIIBatchCached);
+    TESTCASE_AUTO(TestIDNToASCIIBatch);
+    TESTCASE_AUTO(TestIDNToASCIIBatchCached);
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    IDNAPerfTest test(argc, argv, status);
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
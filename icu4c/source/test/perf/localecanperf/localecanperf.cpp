@@ -9,8 +9,13 @@
 #include <vector>
 #include <string>
 
+#include "unicode/localematcher.h"
 #include "unicode/locid.h"
+#include "unicode/uloc.h"
 #include "unicode/uperf.h"
+#include "cmemory.h"
+#include "localeprioritylist.h"
+#include "loccache.h"
 
 //
 // Test case ...
@@ -39,6 +44,108 @@ class LocaleCreateCanonical : public UPerfFunction {
     std::vector<std::string> testCases;
 };
 
+//
+// Resolves the same few tags over and over (cache hits),
+// or more distinct tags than the LocaleIDCache holds (cache misses).
+//
+class LocaleResolve : public UPerfFunction {
+public:
+    enum Operation { CREATE_CANONICAL, FOR_LANGUAGE_TAG, ADD_LIKELY_SUBTAGS };
+
+    LocaleResolve(Operation operation, bool distinct) : operation(operation) {
+        static const char *const tags[] = {
+            "en", "en-US", "ja-JP", "zh-Hant-CN", "hy-SU", "de-AT", "es-419", "pt-BR"
+        };
+        if (distinct) {
+            for (int32_t i = 0; i < 4 * icu::LocaleIDCache::CAPACITY; ++i) {
+                testCases.push_back(std::string(tags[i % 8]) + "-x-p" + std::to_string(i));
+            }
+        } else {
+            testCases.assign(std::begin(tags), std::end(tags));
+        }
+    }
+    void call(UErrorCode* status) override
+    {
+        for (const std::string& s : testCases) {
+            switch (operation) {
+            case CREATE_CANONICAL:
+                Locale::createCanonical(s.c_str());
+                break;
+            case FOR_LANGUAGE_TAG:
+                Locale::forLanguageTag(s, *status);
+                break;
+            case ADD_LIKELY_SUBTAGS:
+                char buffer[ULOC_FULLNAME_CAPACITY];
+                uloc_addLikelySubtags(s.c_str(), buffer, ULOC_FULLNAME_CAPACITY, status);
+                break;
+            }
+        }
+    }
+    long getOperationsPerIteration() override { return testCases.size(); }
+    long getEventsPerIteration() override { return testCases.size(); }
+private:
+    Operation operation;
+    std::vector<std::string> testCases;
+};
+
+//
+// Matches typical Accept-Language headers against the first 400 available locales,
+// either as list strings (repeated, as a server sees them) or as parsed locale lists.
+//
+class LocaleMatch : public UPerfFunction {
+public:
+    LocaleMatch(bool listStrings, UErrorCode &status) : listStrings(listStrings) {
+        int32_t count = 0;
+        const Locale *available = Locale::getAvailableLocales(count);
+        LocaleMatcher::Builder builder;
+        builder.setSupportedLocales(available, available + std::min(count, 400));
+        matcher = new LocaleMatcher(builder.build(status));
+        for (const char *header : headers) {
+            LocalePriorityList list(header, status);
+            std::vector<Locale> locales;
+            for (int32_t i = 0; i < list.getLength(); ++i) {
+                if (list.localeAt(i) != nullptr) {
+                    locales.push_back(*list.localeAt(i));
+                }
+            }
+            desiredLists.push_back(locales);
+        }
+    }
+    ~LocaleMatch() { delete matcher; }
+    void call(UErrorCode* status) override
+    {
+        if (listStrings) {
+            for (const char *header : headers) {
+                matcher->getBestMatchForListString(header, *status);
+            }
+        } else {
+            for (const std::vector<Locale> &locales : desiredLists) {
+                Locale::RangeIterator<std::vector<Locale>::const_iterator> iter(
+                    locales.begin(), locales.end());
+                matcher->getBestMatch(iter, *status);
+            }
+        }
+    }
+    long getOperationsPerIteration() override { return UPRV_LENGTHOF(headers); }
+    long getEventsPerIteration() override { return UPRV_LENGTHOF(headers); }
+private:
+    static constexpr const char *headers[] = {
+        "en-US,en;q=0.9",
+        "fr-CH, fr;q=0.9, en;q=0.8, de;q=0.7, *;q=0.5",
+        "de-DE,de;q=0.9,en-US;q=0.8,en;q=0.7",
+        "zh-TW,zh;q=0.9,en-US;q=0.8,en;q=0.7,ja;q=0.6",
+        "pt-BR,pt;q=0.9,es;q=0.8,en;q=0.7,fr;q=0.6,it;q=0.5",
+        "nb-NO,nb;q=0.9,no;q=0.8,nn;q=0.7,sv;q=0.6,da;q=0.5,en;q=0.4",
+        "sr-Latn-RS,sr;q=0.9,hr;q=0.8,bs;q=0.7,en;q=0.6",
+        "ar-EG,ar;q=0.9,en-GB;q=0.8,en;q=0.7,fr;q=0.6",
+        "xx-YY,yy;q=0.9,zz;q=0.8,en-AU;q=0.7",
+        "es-MX,es-419;q=0.9,es;q=0.8,en;q=0.7,pt;q=0.6,gl;q=0.5,ca;q=0.4"
+    };
+    bool listStrings;
+    LocaleMatcher *matcher = nullptr;
+    std::vector<std::vector<Locale>> desiredLists;
+};
+
 class LocaleCanonicalizationPerfTest : public UPerfTest
 {
 public:
@@ -59,6 +166,36 @@ class LocaleCanonicalizationPerfTest : public UPerfTest
     {
         return new LocaleCreateCanonical();
     }
+    UPerfFunction* TestLocaleCreateCanonicalMiss()
+    {
+        return new LocaleResolve(LocaleResolve::CREATE_CANONICAL, true);
+    }
+    UPerfFunction* TestLocaleForLanguageTag()
+    {
+        return new LocaleResolve(LocaleResolve::FOR_LANGUAGE_TAG, false);
+    }
+    UPerfFunction* TestLocaleForLanguageTagMiss()
+    {
+        return new LocaleResolve(LocaleResolve::FOR_LANGUAGE_TAG, true);
+    }
+    UPerfFunction* TestAddLikelySubtags()
+    {
+        return new LocaleResolve(LocaleResolve::ADD_LIKELY_SUBTAGS, false);
+    }
+    UPerfFunction* TestAddLikelySubtagsMiss()
+    {
+        return new LocaleResolve(LocaleResolve::ADD_LIKELY_SUBTAGS, true);
+    }
+    UPerfFunction* TestLocaleMatcherListString()
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        return new LocaleMatch(true, status);
+    }
+    UPerfFunction* TestLocaleMatcherIterator()
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        return new LocaleMatch(false, status);
+    }
 };
 
 UPerfFunction*
@@ -69,6 +206,13 @@ LocaleCanonicalizationPerfTest::runIndexedTest(
     TESTCASE_AUTO_BEGIN;
 
     TESTCASE_AUTO(TestLocaleCreateCanonical);
+    TESTCASE_AUTO(TestLocaleCreateCanonicalMiss);
+    TESTCASE_AUTO(TestLocaleForLanguageTag);
+    TESTCASE_AUTO(TestLocaleForLanguageTagMiss);
+    TESTCASE_AUTO(TestAddLikelySubtags);
+    TESTCASE_AUTO(TestAddLikelySubtagsMiss);
+    TESTCASE_AUTO(TestLocaleMatcherListString);
+    TESTCASE_AUTO(TestLocaleMatcherIterator);
 
     TESTCASE_AUTO_END;
     return nullptr;
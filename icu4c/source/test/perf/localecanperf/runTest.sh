@@ -20,3 +20,16 @@ LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/
 
 LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
   ./localecanperf TestLocaleCreateCanonical -i 100000
+
+# cache hits and misses of the other operations
+for test in TestLocaleCreateCanonicalMiss TestLocaleForLanguageTag TestLocaleForLanguageTagMiss \
+            TestAddLikelySubtags TestAddLikelySubtagsMiss; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./localecanperf $test -i 1000
+done
+
+# matching Accept-Language headers against many supported locales
+for test in TestLocaleMatcherListString TestLocaleMatcherIterator; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./localecanperf $test -i 1000
+done
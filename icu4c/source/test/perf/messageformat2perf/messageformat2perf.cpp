@@ -0,0 +1,139 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include <map>
+
+#include "unicode/messageformat2.h"
+#include "unicode/uperf.h"
+
+using icu::Locale;
+using icu::UnicodeString;
+using icu::message2::MessageArguments;
+using icu::message2::MessageFormatter;
+
+namespace {
+
+// Formats one message with a fixed set of arguments, varying a numeric
+// argument so that selection goes through different variants.
+class MessageFormatPerfFunction : public UPerfFunction {
+public:
+    MessageFormatPerfFunction(const char* localeID, const char16_t* pattern, UErrorCode& status)
+            : fFormatter(MessageFormatter::Builder(status)
+                             .setLocale(Locale(localeID))
+                             .setPattern(pattern, fParseError, status)
+                             .build(status)) {
+        for (int64_t count = 0; count < kArgumentsCount; count++) {
+            std::map<UnicodeString, icu::message2::Formattable> args;
+            args[u"name"] = icu::message2::Formattable(UnicodeString(u"Maria"));
+            args[u"gender"] = icu::message2::Formattable(UnicodeString(count % 3 == 0 ? u"feminine" : u"other"));
+            args[u"count"] = icu::message2::Formattable(count % 10 == 0 ? count / 10 : count * 37);
+            fArguments[count] = MessageArguments(args, status);
+        }
+    }
+    void call(UErrorCode* status) override {
+        for (const MessageArguments& args : fArguments) {
+            fResult = fFormatter.formatToString(args, *status);
+        }
+    }
+    long getOperationsPerIteration() override { return kArgumentsCount; }
+    long getEventsPerIteration() override { return kArgumentsCount; }
+private:
+    static constexpr int32_t kArgumentsCount = 100;
+    UParseError fParseError;
+    MessageFormatter fFormatter;
+    MessageArguments fArguments[kArgumentsCount];
+    UnicodeString fResult;
+};
+
+}  // namespace
+
+class MessageFormat2PerfTest : public UPerfTest {
+public:
+    MessageFormat2PerfTest(int32_t argc, const char* argv[], UErrorCode& status)
+            : UPerfTest(argc, argv, nullptr, 0, "messageformat2perf", status) {
+        if (locale == nullptr) {
+            locale = "en";
+        }
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* TestFormatText() {
+        return create(u"Hello, world!");
+    }
+    UPerfFunction* TestFormatPlaceholder() {
+        return create(u"Hello, {$name}!");
+    }
+    UPerfFunction* TestFormatNumber() {
+        return create(u"You have {$count :number} new messages.");
+    }
+    UPerfFunction* TestFormatNumberWithOptions() {
+        return create(u"Total: {$count :number minimumFractionDigits=2 useGrouping=never}");
+    }
+    UPerfFunction* TestFormatPlural() {
+        return create(u".input {$count :number}\n"
+                      u".match $count\n"
+                      u"0 {{You have no new messages.}}\n"
+                      u"one {{You have {$count} new message.}}\n"
+                      u"* {{You have {$count} new messages.}}");
+    }
+    UPerfFunction* TestFormatTwoSelectors() {
+        return create(u".input {$gender :string} .input {$count :integer}\n"
+                      u".match $gender $count\n"
+                      u"feminine 1 {{{$name} added a photo to her album.}}\n"
+                      u"feminine * {{{$name} added {$count} photos to her album.}}\n"
+                      u"masculine 1 {{{$name} added a photo to his album.}}\n"
+                      u"masculine * {{{$name} added {$count} photos to his album.}}\n"
+                      u"* 1 {{{$name} added a photo to their album.}}\n"
+                      u"* * {{{$name} added {$count} photos to their album.}}");
+    }
+
+    UPerfFunction* create(const char16_t* pattern) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction* function = new MessageFormatPerfFunction(locale, pattern, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Error creating the message formatter: %s\n", u_errorName(status));
+            delete function;
+            return nullptr;
+        }
+        return function;
+    }
+};
+
+UPerfFunction*
+MessageFormat2PerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestFormatText);
+    TESTCASE_AUTO(TestFormatPlaceholder);
+    TESTCASE_AUTO(TestFormatNumber);
+    TESTCASE_AUTO(TestFormatNumberWithOptions);
+    TESTCASE_AUTO(TestFormatPlural);
+    TESTCASE_AUTO(TestFormatTwoSelectors);
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    MessageFormat2PerfTest test(argc, argv, status);
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,335 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include <string>
+#include <vector>
+
+#include "unicode/decimfmt.h"
+#include "unicode/numberformatter.h"
+#include "unicode/plurrule.h"
+#include "unicode/uperf.h"
+
+using icu::DecimalFormat;
+using icu::Formattable;
+using icu::LocalPointer;
+using icu::NumberFormat;
+using icu::ParsePosition;
+using icu::PluralRules;
+using icu::StringEnumeration;
+using icu::UnicodeString;
+using icu::number::LocalizedNumberFormatter;
+using icu::number::NumberFormatter;
+
+namespace {
+
+// Values typical of a JSON or CSV column: counters, ids and measurements.
+std::vector<int64_t> getIntValues() {
+    std::vector<int64_t> values;
+    int64_t value = 7;
+    for (int32_t i = 0; i < 100; i++) {
+        values.push_back(i % 3 == 0 ? -value : value);
+        value = (value * 31 + 17) % 100000000000LL;
+    }
+    return values;
+}
+
+std::vector<double> getDoubleValues(bool integral) {
+    std::vector<double> values;
+    for (int64_t value : getIntValues()) {
+        values.push_back(integral ? static_cast<double>(value) : static_cast<double>(value) / 1000.0);
+    }
+    return values;
+}
+
+class NumberFormatPerfFunction : public UPerfFunction {
+public:
+    NumberFormatPerfFunction(const char* localeID, const char16_t* skeleton, UErrorCode& status)
+            : fFormatter(NumberFormatter::forSkeleton(skeleton, status).locale(localeID)) {}
+    long getOperationsPerIteration() override { return 100; }
+    long getEventsPerIteration() override { return 100; }
+protected:
+    LocalizedNumberFormatter fFormatter;
+    std::string fString;
+    char fBuffer[100];
+};
+
+class FormatIntToString : public NumberFormatPerfFunction {
+public:
+    using NumberFormatPerfFunction::NumberFormatPerfFunction;
+    void call(UErrorCode* status) override {
+        for (int64_t value : fValues) {
+            fString.clear();
+            fFormatter.formatInt(value, *status).toString(*status).toUTF8String(fString);
+        }
+    }
+private:
+    std::vector<int64_t> fValues = getIntValues();
+};
+
+class FormatIntInto : public NumberFormatPerfFunction {
+public:
+    using NumberFormatPerfFunction::NumberFormatPerfFunction;
+    void call(UErrorCode* status) override {
+        for (int64_t value : fValues) {
+            fFormatter.formatIntInto(value, fBuffer, sizeof(fBuffer), *status);
+        }
+    }
+private:
+    std::vector<int64_t> fValues = getIntValues();
+};
+
+class FormatDoubleToString : public NumberFormatPerfFunction {
+public:
+    FormatDoubleToString(const char* localeID, const char16_t* skeleton, bool integral,
+                         UErrorCode& status)
+            : NumberFormatPerfFunction(localeID, skeleton, status), fValues(getDoubleValues(integral)) {}
+    void call(UErrorCode* status) override {
+        for (double value : fValues) {
+            fString.clear();
+            fFormatter.formatDouble(value, *status).toString(*status).toUTF8String(fString);
+        }
+    }
+private:
+    std::vector<double> fValues;
+};
+
+class FormatDoubleInto : public NumberFormatPerfFunction {
+public:
+    FormatDoubleInto(const char* localeID, const char16_t* skeleton, bool integral,
+                     UErrorCode& status)
+            : NumberFormatPerfFunction(localeID, skeleton, status), fValues(getDoubleValues(integral)) {}
+    void call(UErrorCode* status) override {
+        for (double value : fValues) {
+            fFormatter.formatDoubleInto(value, fBuffer, sizeof(fBuffer), *status);
+        }
+    }
+private:
+    std::vector<double> fValues;
+};
+
+// Parses a column of strings formatted with the skeleton, using the locale's DecimalFormat.
+class NumberParsePerfFunction : public UPerfFunction {
+public:
+    NumberParsePerfFunction(const char* localeID, const char16_t* skeleton, UErrorCode& status)
+            : fFormat(dynamic_cast<DecimalFormat*>(NumberFormat::createInstance(localeID, status))) {
+        if (U_SUCCESS(status) && fFormat.isNull()) {
+            status = U_UNSUPPORTED_ERROR;
+        }
+        LocalizedNumberFormatter formatter = NumberFormatter::forSkeleton(skeleton, status).locale(localeID);
+        for (double value : getDoubleValues(false)) {
+            fTexts.push_back(formatter.formatDouble(value, status).toString(status));
+        }
+        fResults.resize(fTexts.size());
+    }
+    long getOperationsPerIteration() override { return static_cast<long>(fTexts.size()); }
+    long getEventsPerIteration() override { return static_cast<long>(fTexts.size()); }
+protected:
+    LocalPointer<DecimalFormat> fFormat;
+    std::vector<UnicodeString> fTexts;
+    std::vector<double> fResults;
+};
+
+class ParseEach : public NumberParsePerfFunction {
+public:
+    using NumberParsePerfFunction::NumberParsePerfFunction;
+    void call(UErrorCode* status) override {
+        for (size_t i = 0; i < fTexts.size(); i++) {
+            Formattable result;
+            ParsePosition position;
+            fFormat->parse(fTexts[i], result, position);
+            fResults[i] = result.getDouble(*status);
+        }
+    }
+};
+
+class ParseBatch : public NumberParsePerfFunction {
+public:
+    using NumberParsePerfFunction::NumberParsePerfFunction;
+    void call(UErrorCode* status) override {
+        fFormat->parseBatch(fTexts.data(), static_cast<int32_t>(fTexts.size()), fResults.data(),
+                            nullptr, *status);
+    }
+};
+
+// Selects the plural category of a column of numbers with the cardinal rules of every locale.
+class PluralSelectPerfFunction : public UPerfFunction {
+public:
+    explicit PluralSelectPerfFunction(UErrorCode& status) {
+        LocalPointer<StringEnumeration> locales(PluralRules::getAvailableLocales(status), status);
+        const char* localeID;
+        while (U_SUCCESS(status) && (localeID = locales->next(nullptr, status)) != nullptr) {
+            fRules.emplace_back(PluralRules::forLocale(localeID, status));
+        }
+        for (int64_t value : getIntValues()) {
+            // Half small counts, half larger values.
+            int32_t intValue = static_cast<int32_t>(fIntValues.size() < 50 ? fIntValues.size() : value % 10000000);
+            fIntValues.push_back(intValue);
+        }
+        fDoubleValues = getDoubleValues(false);
+    }
+    long getOperationsPerIteration() override { return static_cast<long>(fRules.size() * 100); }
+    long getEventsPerIteration() override { return static_cast<long>(fRules.size() * 100); }
+protected:
+    std::vector<LocalPointer<PluralRules>> fRules;
+    std::vector<int32_t> fIntValues;
+    std::vector<double> fDoubleValues;
+    UnicodeString fKeyword;
+};
+
+class PluralSelectInt : public PluralSelectPerfFunction {
+public:
+    using PluralSelectPerfFunction::PluralSelectPerfFunction;
+    void call(UErrorCode* /*status*/) override {
+        for (const auto& rules : fRules) {
+            for (int32_t value : fIntValues) {
+                fKeyword = rules->select(value);
+            }
+        }
+    }
+};
+
+class PluralSelectDouble : public PluralSelectPerfFunction {
+public:
+    using PluralSelectPerfFunction::PluralSelectPerfFunction;
+    void call(UErrorCode* /*status*/) override {
+        for (const auto& rules : fRules) {
+            for (double value : fDoubleValues) {
+                fKeyword = rules->select(value);
+            }
+        }
+    }
+};
+
+}  // namespace
+
+class NumberFormatPerfTest : public UPerfTest {
+public:
+    NumberFormatPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
+            : UPerfTest(argc, argv, nullptr, 0, "numfmtperf", status) {
+        if (locale == nullptr) {
+            locale = "en";
+        }
+    }
+
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* TestFormatIntToString() {
+        return create<FormatIntToString>(u"");
+    }
+    UPerfFunction* TestFormatIntInto() {
+        return create<FormatIntInto>(u"");
+    }
+    UPerfFunction* TestFormatIntIntoNoGrouping() {
+        return create<FormatIntInto>(u"group-off");
+    }
+    UPerfFunction* TestFormatIntIntoCompact() {
+        return create<FormatIntInto>(u"compact-short");
+    }
+    UPerfFunction* TestFormatDoubleToString() {
+        return create<FormatDoubleToString>(u"", false);
+    }
+    UPerfFunction* TestFormatDoubleInto() {
+        return create<FormatDoubleInto>(u"", false);
+    }
+    UPerfFunction* TestFormatIntegralDoubleToString() {
+        return create<FormatDoubleToString>(u"", true);
+    }
+    UPerfFunction* TestFormatIntegralDoubleInto() {
+        return create<FormatDoubleInto>(u"", true);
+    }
+
+    UPerfFunction* TestParseEach() {
+        return create<ParseEach>(u"");
+    }
+    UPerfFunction* TestParseBatch() {
+        return create<ParseBatch>(u"");
+    }
+    UPerfFunction* TestParseEachNoGrouping() {
+        return create<ParseEach>(u"group-off");
+    }
+    UPerfFunction* TestParseBatchNoGrouping() {
+        return create<ParseBatch>(u"group-off");
+    }
+
+    UPerfFunction* TestPluralSelectInt() {
+        return createPluralSelect<PluralSelectInt>();
+    }
+    UPerfFunction* TestPluralSelectDouble() {
+        return createPluralSelect<PluralSelectDouble>();
+    }
+
+    template<typename T, typename... Args>
+    UPerfFunction* create(const char16_t* skeleton, Args... args) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction* function = new T(locale, skeleton, args..., status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Error creating the number formatter: %s\n", u_errorName(status));
+            delete function;
+            return nullptr;
+        }
+        return function;
+    }
+
+    template<typename T>
+    UPerfFunction* createPluralSelect() {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction* function = new T(status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Error creating the plural rules: %s\n", u_errorName(status));
+            delete function;
+            return nullptr;
+        }
+        return function;
+    }
+};
+
+UPerfFunction*
+NumberFormatPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestFormatIntToString);
+    TESTCASE_AUTO(TestFormatIntInto);
+    TESTCASE_AUTO(TestFormatIntIntoNoGrouping);
+    TESTCASE_AUTO(TestFormatIntIntoCompact);
+    TESTCASE_AUTO(TestFormatDoubleToString);
+    TESTCASE_AUTO(TestFormatDoubleInto);
+    TESTCASE_AUTO(TestFormatIntegralDoubleToString);
+    TESTCASE_AUTO(TestFormatIntegralDoubleInto);
+    TESTCASE_AUTO(TestParseEach);
+    TESTCASE_AUTO(TestParseBatch);
+    TESTCASE_AUTO(TestParseEachNoGrouping);
+    TESTCASE_AUTO(TestParseBatchNoGrouping);
+    TESTCASE_AUTO(TestPluralSelectInt);
+    TESTCASE_AUTO(TestPluralSelectDouble);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    NumberFormatPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uperf.h"
+#include "unicode/uspoof.h"
+#include "cmemory.h"
+
+using icu::CheckedArrayByteSink;
+using icu::SpoofSkeletonIndex;
+using icu::StringPiece;
+using icu::UnicodeString;
+
+namespace {
+
+// User names as they come into a signup service: mostly ASCII,
+// with some internationalized and some deliberately confusable ones.
+const char* const kNames[] = {
+    "alice",
+    "bob_smith",
+    "Charlie1987",
+    "paypal",
+    "pa\xD1\x83" "pal",                             // Cyrillic u
+    "g00gle",
+    "rnicrosoft",
+    "j.doe",
+    "M\xC3\xBC" "ller",                             // Müller
+    "\xC3\x85ngstr\xC3\xB6m",                       // Ångström
+    "admin",
+    "\xD0\xB0\xD0\xB4\xD0\xBC\xD0\xB8\xD0\xBD",     // админ
+    "\xCE\xB5\xCE\xBB\xCE\xBB\xCE\xB7\xCE\xBD\xCE\xB9\xCE\xBA\xCE\xAC",  // ελληνικά
+    "\xE5\xB1\xB1\xE7\x94\xB0\xE5\xA4\xAA\xE9\x83\x8E",                  // 山田太郎
+    "support-team",
+    "\xF0\x9D\x90\x9A\xF0\x9D\x90\x9D\xF0\x9D\x90\xA6\xF0\x9D\x90\xA2\xF0\x9D\x90\xA7",  // bold admin
+};
+
+constexpr int32_t kCount = UPRV_LENGTHOF(kNames);
+
+// Computes the skeleton of each name with the UTF-16 API.
+class SkeletonUTF16PerfFunction : public UPerfFunction {
+public:
+    SkeletonUTF16PerfFunction(const USpoofChecker* sc) : fChecker(sc) {
+        for (int32_t i = 0; i < kCount; ++i) {
+            fNames[i] = UnicodeString::fromUTF8(kNames[i]);
+        }
+    }
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < kCount; ++i) {
+            uspoof_getSkeletonUnicodeString(fChecker, 0, fNames[i], fSkeleton, status);
+        }
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    const USpoofChecker* fChecker;
+    UnicodeString fNames[kCount];
+    UnicodeString fSkeleton;
+};
+
+// Computes the skeleton of each name with the UTF-8 C API.
+class SkeletonUTF8PerfFunction : public UPerfFunction {
+public:
+    SkeletonUTF8PerfFunction(const USpoofChecker* sc) : fChecker(sc) {}
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < kCount; ++i) {
+            uspoof_getSkeletonUTF8(fChecker, 0, kNames[i], -1, fBuffer, sizeof(fBuffer), status);
+        }
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    const USpoofChecker* fChecker;
+    char fBuffer[256];
+};
+
+// Computes the skeleton of each name into a ByteSink.
+class SkeletonByteSinkPerfFunction : public UPerfFunction {
+public:
+    SkeletonByteSinkPerfFunction(const USpoofChecker* sc) : fChecker(sc) {}
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < kCount; ++i) {
+            CheckedArrayByteSink sink(fBuffer, sizeof(fBuffer));
+            uspoof_getSkeletonByteSink(fChecker, kNames[i], sink, status);
+        }
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    const USpoofChecker* fChecker;
+    char fBuffer[256];
+};
+
+// Computes the skeletons of all names with one batch call.
+class SkeletonBatchPerfFunction : public UPerfFunction {
+public:
+    SkeletonBatchPerfFunction(const USpoofChecker* sc) : fChecker(sc) {
+        for (int32_t i = 0; i < kCount; ++i) {
+            fNames[i] = kNames[i];
+        }
+    }
+    void call(UErrorCode* status) override {
+        uspoof_getSkeletonBatchUTF8(fChecker, fNames, kCount, fBuffer, sizeof(fBuffer), fLimits, status);
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    const USpoofChecker* fChecker;
+    StringPiece fNames[kCount];
+    int32_t fLimits[kCount];
+    char fBuffer[kCount * 256];
+};
+
+// Runs the default checks on each name.
+class CheckUTF8PerfFunction : public UPerfFunction {
+public:
+    CheckUTF8PerfFunction(const USpoofChecker* sc) : fChecker(sc) {}
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < kCount; ++i) {
+            uspoof_check2UTF8(fChecker, kNames[i], -1, nullptr, status);
+        }
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    const USpoofChecker* fChecker;
+};
+
+// Checks each name against an index of many existing names.
+class IndexIsConfusablePerfFunction : public UPerfFunction {
+public:
+    IndexIsConfusablePerfFunction(const USpoofChecker* sc, UErrorCode& status) : fIndex(sc, status) {
+        char id[32];
+        for (int32_t i = 0; i < 100000; ++i) {
+            snprintf(id, sizeof(id), "user%d", static_cast<int>(i));
+            fIndex.addUTF8(id, status);
+        }
+    }
+    void call(UErrorCode* status) override {
+        for (int32_t i = 0; i < kCount; ++i) {
+            fIndex.isConfusableUTF8(kNames[i], *status);
+        }
+    }
+    long getOperationsPerIteration() override { return kCount; }
+    long getEventsPerIteration() override { return kCount; }
+private:
+    SpoofSkeletonIndex fIndex;
+};
+
+}  // namespace
+
+class SpoofPerfTest : public UPerfTest {
+public:
+    SpoofPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
+            : UPerfTest(argc, argv, nullptr, 0, "spoofperf", status),
+              fChecker(uspoof_open(&status)) {}
+    ~SpoofPerfTest() override { uspoof_close(fChecker); }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* TestSkeletonUTF16() { return new SkeletonUTF16PerfFunction(fChecker); }
+    UPerfFunction* TestSkeletonUTF8() { return new SkeletonUTF8PerfFunction(fChecker); }
+    UPerfFunction* TestSkeletonByteSink() { return new SkeletonByteSinkPerfFunction(fChecker); }
+    UPerfFunction* TestSkeletonBatch() { return new SkeletonBatchPerfFunction(fChecker); }
+    UPerfFunction* TestCheckUTF8() { return new CheckUTF8PerfFunction(fChecker); }
+    UPerfFunction* TestIndexIsConfusable() {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction* function = new IndexIsConfusablePerfFunction(fChecker, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Error building the skeleton index: %s\n", u_errorName(status));
+            delete function;
+            return nullptr;
+        }
+        return function;
+    }
+
+    USpoofChecker* fChecker;
+};
+
+UPerfFunction*
+SpoofPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestSkeletonUTF16);
+    TESTCASE_AUTO(TestSkeletonUTF8);
+    TESTCASE_AUTO(TestSkeletonByteSink);
+    TESTCASE_AUTO(TestSkeletonBatch);
+    TESTCASE_AUTO(TestCheckUTF8);
+    TESTCASE_AUTO(TestIndexIsConfusable);
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    SpoofPerfTest test(argc, argv, status);
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -14,13 +14,22 @@
  * ICU4C 
  */
 
+#include "unicode/ustring.h"
 #include "strsrchperf.h"
 
+/* Minimum length of the text for the *_Long tests, in UTF-16 code units */
+#define LONG_TEXT_LENGTH 1000000
+
 StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
 :UPerfTest(argc,argv,status){
     int32_t start, end;
     srch = nullptr;
     pttrn = nullptr;
+    longSrc = nullptr;
+    longSrcLen = 0;
+    longSrcUTF8 = nullptr;
+    longSrch = nullptr;
+    longSrchUTF8 = nullptr;
     if(status== U_ILLEGAL_ARGUMENT_ERROR || line_mode){
        fprintf(stderr,gUsageString, "strsrchperf");
        return;
@@ -71,7 +80,29 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
         fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n", u_errorName(status));
         return;
     }
-    
+
+    /* Repeat the text into a haystack of at least LONG_TEXT_LENGTH code units,
+       as in a "find in page" over a large document. */
+    int32_t copies = LONG_TEXT_LENGTH / srcLen + 1;
+    longSrcLen = copies * srcLen;
+    longSrc = static_cast<char16_t*>(malloc(sizeof(char16_t) * longSrcLen));
+    for (int i = 0; i < copies; i++) {
+        u_memcpy(longSrc + i * srcLen, src, srcLen);
+    }
+    longSrch = usearch_open(pttrn, pttrnLen, longSrc, longSrcLen, locale, nullptr, &status);
+
+    int32_t utf8Len = 0;
+    UErrorCode preflightStatus = U_ZERO_ERROR;
+    u_strToUTF8(nullptr, 0, &utf8Len, longSrc, longSrcLen, &preflightStatus);
+    longSrcUTF8 = static_cast<char*>(malloc(utf8Len + 1));
+    u_strToUTF8(longSrcUTF8, utf8Len + 1, &utf8Len, longSrc, longSrcLen, &status);
+    longSrchUTF8 = usearch_open(pttrn, pttrnLen, longSrc, longSrcLen, locale, nullptr, &status);
+    usearch_setUTF8Text(longSrchUTF8, longSrcUTF8, utf8Len, &status);
+
+    if(U_FAILURE(status)){
+        fprintf(stderr, "FAILED to create the long text searches. Error: %s\n", u_errorName(status));
+        return;
+    }
 }
 
 StringSearchPerformanceTest::~StringSearchPerformanceTest() {
@@ -81,12 +112,23 @@ StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (srch != nullptr) {
         usearch_close(srch);
     }
+    if (longSrch != nullptr) {
+        usearch_close(longSrch);
+    }
+    if (longSrchUTF8 != nullptr) {
+        usearch_close(longSrchUTF8);
+    }
+    free(longSrc);
+    free(longSrcUTF8);
 }
 
 UPerfFunction* StringSearchPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *par) {
     switch (index) {
         TESTCASE(0,Test_ICU_Forward_Search);
         TESTCASE(1,Test_ICU_Backward_Search);
+        TESTCASE(2,Test_ICU_Forward_Search_Long);
+        TESTCASE(3,Test_ICU_Backward_Search_Long);
+        TESTCASE(4,Test_ICU_Forward_Search_Long_UTF8);
 
         default: 
             name = ""; 
@@ -105,6 +147,21 @@ UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search(){
     return func;
 }
 
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Long(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, longSrch, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search_Long(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUBackwardSearch, longSrch, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Long_UTF8(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearchUTF8, longSrchUTF8, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
 int main (int argc, const char* argv[]) {
     UErrorCode status = U_ZERO_ERROR;
     StringSearchPerformanceTest test(argc, argv, status);
@@ -53,6 +53,12 @@ class StringSearchPerformanceTest : public UPerfTest {
     char16_t* pttrn;
     int32_t pttrnLen;
     UStringSearch* srch;
+    /* The text repeated into a long haystack, also in UTF-8 */
+    char16_t* longSrc;
+    int32_t longSrcLen;
+    char* longSrcUTF8;
+    UStringSearch* longSrch;
+    UStringSearch* longSrchUTF8;
     
 public:
     StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
@@ -60,6 +66,9 @@ class StringSearchPerformanceTest : public UPerfTest {
     UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
     UPerfFunction* Test_ICU_Forward_Search();
     UPerfFunction* Test_ICU_Backward_Search();
+    UPerfFunction* Test_ICU_Forward_Search_Long();
+    UPerfFunction* Test_ICU_Backward_Search_Long();
+    UPerfFunction* Test_ICU_Forward_Search_Long_UTF8();
 };
 
 
@@ -81,4 +90,14 @@ void ICUBackwardSearch(UStringSearch *srch, const char16_t* source, int32_t sour
     }
 }
 
+void ICUForwardSearchUTF8(UStringSearch *srch, const char16_t* source, int32_t sourceLen, const char16_t* pattern, int32_t patternLen, UErrorCode* status) {
+    int32_t match;
+    
+    match = usearch_first(srch, status);
+    while (match != USEARCH_DONE) {
+        usearch_getMatchedStartUTF8(srch);
+        match = usearch_next(srch, status);
+    }
+}
+
 #endif /* _STRSRCHPERF_H */
@@ -0,0 +1,171 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include <stdio.h>
+
+#include "unicode/localpointer.h"
+#include "unicode/translit.h"
+#include "unicode/uclean.h"
+#include "unicode/uperf.h"
+
+using icu::LocalPointer;
+using icu::Transliterator;
+using icu::UnicodeString;
+
+//
+// Measures Transliterator::createInstance() for a single ID.
+//
+// A "cold" call first runs u_cleanup(), so that every iteration has to
+// initialize the registry, load the rules for the ID (and for everything
+// it refers to) and build the rule data, which is the cost paid once per
+// process.  A "warm" call only measures a repeated createInstance().
+//
+class TransliteratorCreate : public UPerfFunction {
+public:
+    TransliteratorCreate(const char16_t* id, UBool cold) : fID(id), fCold(cold) {}
+    void call(UErrorCode* status) override
+    {
+        if (fCold) {
+            u_cleanup();
+        }
+        Transliterator* t = Transliterator::createInstance(fID, UTRANS_FORWARD, *status);
+        delete t;
+    }
+    long getOperationsPerIteration() override { return 1; }
+private:
+    UnicodeString fID;
+    UBool fCold;
+};
+
+//
+// Measures Transliterator::transliterate() on mostly-ASCII text, which most
+// rules cannot change.
+//
+class TransliteratorTransliterate : public UPerfFunction {
+public:
+    TransliteratorTransliterate(const char16_t* id, const UnicodeString& text, UErrorCode& status)
+            : fTrans(Transliterator::createInstance(id, UTRANS_FORWARD, status)), fText(text) {}
+    void call(UErrorCode* /*status*/) override
+    {
+        UnicodeString s(fText);
+        fTrans->transliterate(s);
+    }
+    long getOperationsPerIteration() override { return fText.length(); }
+private:
+    LocalPointer<Transliterator> fTrans;
+    UnicodeString fText;
+};
+
+class TransliteratorPerfTest : public UPerfTest
+{
+public:
+    TransliteratorPerfTest(
+        int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "translitperf", status)
+    {
+        // Mostly ASCII, with the occasional accented letter or symbol.
+        static const char16_t paragraph[] =
+            u"The quick brown fox jumps over the lazy dog; a na\u00EFve caf\u00E9 owner "
+            u"signed the r\u00E9sum\u00E9 with a flourish \u2014 \u201Cvoil\u00E0!\u201D. "
+            u"Numbers like 12,345.67 and e-mail addresses like test@example.com "
+            u"should pass through unchanged.\n";
+        for (int32_t i = 0; i < 100; ++i) {
+            fText.append(paragraph);
+        }
+    }
+
+    ~TransliteratorPerfTest()
+    {
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UnicodeString fText;
+
+    UPerfFunction* transliterate(const char16_t* id) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<UPerfFunction> f(new TransliteratorTransliterate(id, fText, status), status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Unable to create the transliterator - %s\n", u_errorName(status));
+            return nullptr;
+        }
+        return f.orphan();
+    }
+
+    UPerfFunction* TestCreateLatinASCII() {
+        return new TransliteratorCreate(u"Latin-ASCII", true);
+    }
+    UPerfFunction* TestCreateAnyLatin() {
+        return new TransliteratorCreate(u"Any-Latin", true);
+    }
+    UPerfFunction* TestCreateGreekLatin() {
+        return new TransliteratorCreate(u"Greek-Latin", true);
+    }
+    UPerfFunction* TestCreateHanLatin() {
+        return new TransliteratorCreate(u"Han-Latin", true);
+    }
+    UPerfFunction* TestCreateHiraganaKatakana() {
+        return new TransliteratorCreate(u"Hiragana-Katakana", true);
+    }
+    UPerfFunction* TestCreateLatinDevanagari() {
+        return new TransliteratorCreate(u"Latin-Devanagari", true);
+    }
+    UPerfFunction* TestCreateAnyLatinWarm() {
+        return new TransliteratorCreate(u"Any-Latin", false);
+    }
+    UPerfFunction* TestLatinASCII() {
+        return transliterate(u"Latin-ASCII");
+    }
+    UPerfFunction* TestAnyLatin() {
+        return transliterate(u"Any-Latin");
+    }
+    UPerfFunction* TestAnyLatinASCII() {
+        return transliterate(u"Any-Latin; Latin-ASCII");
+    }
+};
+
+UPerfFunction*
+TransliteratorPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestCreateLatinASCII);
+    TESTCASE_AUTO(TestCreateAnyLatin);
+    TESTCASE_AUTO(TestCreateGreekLatin);
+    TESTCASE_AUTO(TestCreateHanLatin);
+    TESTCASE_AUTO(TestCreateHiraganaKatakana);
+    TESTCASE_AUTO(TestCreateLatinDevanagari);
+    TESTCASE_AUTO(TestCreateAnyLatinWarm);
+    TESTCASE_AUTO(TestLatinASCII);
+    TESTCASE_AUTO(TestAnyLatin);
+    TESTCASE_AUTO(TestAnyLatinASCII);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    TransliteratorPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
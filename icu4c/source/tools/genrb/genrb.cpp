@@ -87,7 +87,8 @@ enum
     INCLUDE_UNIHAN_COLL,
     FILTERDIR,
     ICU4X_MODE,
-    UCADATA
+    UCADATA,
+    COMPILE_TRANSLITERATORS
 };
 
 UOption options[]={
@@ -116,6 +117,7 @@ UOption options[]={
                       UOPTION_DEF("filterDir", '\x01', UOPT_OPTIONAL_ARG), /* 22 */
                       UOPTION_DEF("icu4xMode", 'X', UOPT_NO_ARG),/* 23 */
                       UOPTION_DEF("ucadata", '\x01', UOPT_REQUIRES_ARG),/* 24 */
+                      UOPTION_DEF("compileTransliterators", '\x01', UOPT_NO_ARG),/* 25 */
                   };
 
 static     UBool       write_java = false;
@@ -250,6 +252,9 @@ main(int argc,
         fprintf(stderr,
                 "\t      --filterDir          Input directory where filter files are available.\n"
                 "\t                           For more on filter files, see ICU Data Build Tool.\n");
+        fprintf(stderr,
+                "\t      --compileTransliterators  also store transliterator rules in precompiled binary form;\n"
+                "\t                           makes .res file larger but transliterator instantiation faster\n");
 
         return illegalArg ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -674,7 +679,8 @@ processFile(const char *filename, const char *cp,
     }
     /* Parse the data into an SRBRoot */
     data.adoptInstead(parse(ucbuf.getAlias(), inputDir, outputDir, filename,
-            !omitBinaryCollation, options[NO_COLLATION_RULES].doesOccur, options[ICU4X_MODE].doesOccur, &status));
+            !omitBinaryCollation, options[NO_COLLATION_RULES].doesOccur, options[ICU4X_MODE].doesOccur,
+            options[COMPILE_TRANSLITERATORS].doesOccur, &status));
 
     if (data.isNull() || U_FAILURE(status)) {
         fprintf(stderr, "couldn't parse the file %s. Error:%s\n", filename, u_errorName(status));
@@ -42,6 +42,7 @@
 #include "read.h"
 #include "ustr.h"
 #include "reslist.h"
+#include "rbt_bin.h"
 #include "rbt_pars.h"
 #include "genrb.h"
 #include "unicode/normalizer2.h"
@@ -127,6 +128,7 @@ typedef struct {
     UBool           makeBinaryCollation;
     UBool           omitCollationRules;
     UBool           icu4xMode;
+    UBool           compileTransliterators;
 } ParseState;
 
 typedef struct SResource *
@@ -770,7 +772,7 @@ GenrbImporter::getRules(
 
     /* Parse the data into an SRBRoot */
     LocalPointer<SRBRoot> data(
-            parse(ucbuf.getAlias(), inputDir, outputDir, filename.data(), false, false, false, &errorCode));
+            parse(ucbuf.getAlias(), inputDir, outputDir, filename.data(), false, false, false, false, &errorCode));
     if (U_FAILURE(errorCode)) {
         return;
     }
@@ -1521,6 +1523,81 @@ parseCollationElements(ParseState* state, char *tag, uint32_t startline, UBool n
     }
 }
 
+/*
+ * Adds a "compiled" binary with the precompiled rules to a
+ * RuleBasedTransliteratorIDs/<ID>/file table, recognized by its
+ * "resource" (rules) and "direction" strings.  Rules that cannot be
+ * precompiled (for example, because they call a &Function() whose
+ * transliterator is not available to genrb) are left as they are:
+ * the runtime parses the rule text when there is no compiled form.
+ */
+static void
+addCompiledTransliterator(ParseState* state, TableResource *table, uint32_t line, UErrorCode *status)
+{
+#if UCONFIG_NO_TRANSLITERATION
+    (void)state;
+    (void)table;
+    (void)line;
+    (void)status;
+#else
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    const StringResource *rules = nullptr;
+    const StringResource *direction = nullptr;
+    for (SResource *member = table->fFirst; member != nullptr; member = member->fNext) {
+        const char *key = member->getKeyString(state->bundle);
+        if (key == nullptr) {
+            continue;
+        }
+        if (uprv_strcmp(key, "compiled") == 0) {
+            return;
+        } else if (uprv_strcmp(key, "resource") == 0 && member->isString()) {
+            rules = static_cast<const StringResource *>(member);
+        } else if (uprv_strcmp(key, "direction") == 0 && member->isString()) {
+            direction = static_cast<const StringResource *>(member);
+        }
+    }
+    if (rules == nullptr || direction == nullptr) {
+        return;
+    }
+    // Same test as in the Transliterator registry initialization.
+    UTransDirection dir = direction->fString.charAt(0) == 0x46 /*F*/ ? UTRANS_FORWARD : UTRANS_REVERSE;
+
+    UErrorCode intStatus = U_ZERO_ERROR;
+    UParseError parseError;
+    icu::LocalMemory<uint8_t> buffer;
+    int32_t capacity = 100000;
+    uint8_t *dest = buffer.allocateInsteadAndCopy(capacity);
+    if (dest == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t length = icu::TransliterationRuleBinary::compileRules(
+            rules->fString, dir, dest, capacity, parseError, intStatus);
+    if (intStatus == U_BUFFER_OVERFLOW_ERROR) {
+        capacity = length;
+        dest = buffer.allocateInsteadAndCopy(capacity);
+        if (dest == nullptr) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        intStatus = U_ZERO_ERROR;
+        length = icu::TransliterationRuleBinary::compileRules(
+                rules->fString, dir, dest, capacity, parseError, intStatus);
+    }
+    if (U_FAILURE(intStatus)) {
+        if (isVerbose()) {
+            printf("Not precompiling transliterator rules at line %i: %s\n",
+                   static_cast<int>(line), u_errorName(intStatus));
+        }
+        return;
+    }
+    table->add(bin_open(state->bundle, "compiled", length, dest, nullptr, nullptr, status),
+               line, *status);
+#endif
+}
+
 /* Necessary, because CollationElements requires the bundle->fRoot member to be present which,
    if this weren't special-cased, wouldn't be set until the entire file had been processed. */
 static struct SResource *
@@ -1549,6 +1626,9 @@ realParseTable(ParseState* state, TableResource *table, char *tag, uint32_t star
             if (!readToken && isVerbose()) {
                 warning(startline, "Encountered empty table");
             }
+            if (state->compileTransliterators) {
+                addCompiledTransliterator(state, table, line, status);
+            }
             return table;
         }
 
@@ -2322,7 +2402,8 @@ parseResource(ParseState* state, char *tag, const struct UString *comment, UErro
 /* parse the top-level resource */
 struct SRBRoot *
 parse(UCHARBUF *buf, const char *inputDir, const char *outputDir, const char *filename,
-      UBool makeBinaryCollation, UBool omitCollationRules, UBool icu4xMode, UErrorCode *status)
+      UBool makeBinaryCollation, UBool omitCollationRules, UBool icu4xMode,
+      UBool compileTransliterators, UErrorCode *status)
 {
     struct UString    *tokenValue;
     struct UString    comment;
@@ -2349,6 +2430,7 @@ parse(UCHARBUF *buf, const char *inputDir, const char *outputDir, const char *fi
     state.makeBinaryCollation = makeBinaryCollation;
     state.omitCollationRules = omitCollationRules;
     state.icu4xMode = icu4xMode;
+    state.compileTransliterators = compileTransliterators;
 
     ustr_init(&comment);
     expect(&state, TOK_STRING, &tokenValue, &comment, nullptr, status);
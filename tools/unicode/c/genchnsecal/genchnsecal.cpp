@@ -0,0 +1,246 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  genchnsecal.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+* Generates i18n/chnsecal_data.h and i18n/dangical_data.h, the precomputed
+* winter solstices and new moons used by ChineseCalendar and DangiCalendar
+* for Gregorian years 1900..2100.
+*
+* The values are computed exactly the way chnsecal.cpp computes them at runtime
+* (with CalendarAstronomer, in the zone of each calendar), and the table lookups
+* are then verified against the astronomer for every day of the range.
+*
+* Usage: genchnsecal path/to/icu4c/source/i18n
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "unicode/utypes.h"
+#include "unicode/errorcode.h"
+#include "unicode/locid.h"
+#include "astro.h"
+#include "chnsecal.h"
+#include "dangical.h"
+#include "gregoimp.h"
+#include "toolutil.h"
+
+using namespace icu;
+
+namespace {
+
+constexpr int32_t kFirstYear = 1900;
+constexpr int32_t kLastYear = 2100;
+constexpr int32_t kSynodicGap = 25;  // SYNODIC_GAP in chnsecal.cpp
+
+// Expose the astronomer zone of each calendar.
+class ChineseSetting : public ChineseCalendar {
+public:
+    ChineseSetting(UErrorCode &errorCode) : ChineseCalendar(Locale::getRoot(), errorCode) {}
+    const TimeZone *zone(UErrorCode &errorCode) const { return getSetting(errorCode).zoneAstroCalc; }
+};
+
+class DangiSetting : public DangiCalendar {
+public:
+    DangiSetting(UErrorCode &errorCode) : DangiCalendar(Locale::getRoot(), errorCode) {}
+    const TimeZone *zone(UErrorCode &errorCode) const { return getSetting(errorCode).zoneAstroCalc; }
+};
+
+// The following functions are copies of the ones in chnsecal.cpp
+// without the table lookups.
+
+double daysToMillis(const TimeZone *zone, double days, UErrorCode &errorCode) {
+    double millis = days * kOneDay;
+    int32_t rawOffset, dstOffset;
+    zone->getOffset(millis, false, rawOffset, dstOffset, errorCode);
+    return millis - static_cast<double>(rawOffset + dstOffset);
+}
+
+double millisToDays(const TimeZone *zone, double millis, UErrorCode &errorCode) {
+    int32_t rawOffset, dstOffset;
+    zone->getOffset(millis, false, rawOffset, dstOffset, errorCode);
+    return ClockMath::floorDivide(millis + static_cast<double>(rawOffset + dstOffset), kOneDay);
+}
+
+int32_t winterSolstice(const TimeZone *zone, int32_t gyear, UErrorCode &errorCode) {
+    double ms = daysToMillis(zone, Grego::fieldsToDay(gyear, UCAL_DECEMBER, 1), errorCode);
+    return static_cast<int32_t>(millisToDays(
+        zone,
+        CalendarAstronomer(ms).getSunTime(CalendarAstronomer::WINTER_SOLSTICE(), true),
+        errorCode));
+}
+
+int32_t newMoonNear(const TimeZone *zone, double days, UBool after, UErrorCode &errorCode) {
+    double ms = daysToMillis(zone, days, errorCode);
+    return static_cast<int32_t>(millisToDays(
+        zone,
+        CalendarAstronomer(ms).getMoonTime(CalendarAstronomer::NEW_MOON(), after),
+        errorCode));
+}
+
+int32_t majorSolarTerm(const TimeZone *zone, int32_t days, UErrorCode &errorCode) {
+    double ms = daysToMillis(zone, days, errorCode);
+    int32_t term = ((static_cast<int32_t>(6 * CalendarAstronomer(ms)
+                                .getSunLongitude() / CalendarAstronomer::PI)) + 2 ) % 12;
+    if (term < 1) {
+        term += 12;
+    }
+    return term;
+}
+
+bool hasNoMajorSolarTerm(const TimeZone *zone, int32_t newMoon, UErrorCode &errorCode) {
+    return majorSolarTerm(zone, newMoon, errorCode) ==
+        majorSolarTerm(zone, newMoonNear(zone, newMoon + kSynodicGap, true, errorCode), errorCode);
+}
+
+struct Table {
+    std::vector<uint8_t> solsticeDays;
+    std::vector<int32_t> newMoons;
+    std::vector<bool> noMajorSolarTerm;
+};
+
+// Same as the lookups in chnsecal.cpp.
+int32_t tableNewMoonNear(const Table &table, int32_t days, bool after) {
+    size_t i = 1;
+    while (table.newMoons[i] < days) {
+        ++i;
+    }
+    return after ? table.newMoons[i] : table.newMoons[i - 1];
+}
+
+Table compute(const TimeZone *zone, IcuToolErrorCode &errorCode) {
+    Table table;
+    for (int32_t gyear = kFirstYear - 1; gyear <= kLastYear + 1; ++gyear) {
+        int32_t days = winterSolstice(zone, gyear, errorCode);
+        int32_t december1 = static_cast<int32_t>(Grego::fieldsToDay(gyear, UCAL_DECEMBER, 1));
+        table.solsticeDays.push_back(static_cast<uint8_t>(days - december1 + 1));
+    }
+    // Cover the month 11 before the first winter solstice
+    // through the new year after the last one.
+    int32_t first = static_cast<int32_t>(Grego::fieldsToDay(kFirstYear - 1, UCAL_NOVEMBER, 1));
+    int32_t last = static_cast<int32_t>(Grego::fieldsToDay(kLastYear + 2, UCAL_MARCH, 1));
+    for (int32_t newMoon = newMoonNear(zone, first, true, errorCode);
+            newMoon <= last;
+            newMoon = newMoonNear(zone, newMoon + kSynodicGap, true, errorCode)) {
+        table.newMoons.push_back(newMoon);
+        table.noMajorSolarTerm.push_back(hasNoMajorSolarTerm(zone, newMoon, errorCode));
+    }
+    errorCode.assertSuccess();
+
+    // Verify the table against the astronomer for every day it covers.
+    for (int32_t days = table.newMoons.front() + 1; days <= table.newMoons.back(); ++days) {
+        for (bool after : {false, true}) {
+            int32_t expected = newMoonNear(zone, days, after, errorCode);
+            int32_t actual = tableNewMoonNear(table, days, after);
+            if (actual != expected) {
+                fprintf(stderr, "genchnsecal: newMoonNear(%d, %d) table %d astronomer %d\n",
+                        days, after, actual, expected);
+                exit(U_INTERNAL_PROGRAM_ERROR);
+            }
+        }
+    }
+    for (size_t i = 0; i + 1 < table.newMoons.size(); ++i) {
+        int32_t length = table.newMoons[i + 1] - table.newMoons[i];
+        if (length != 29 && length != 30) {
+            fprintf(stderr, "genchnsecal: month of %d days at %d\n",
+                    static_cast<int>(length), static_cast<int>(table.newMoons[i]));
+            exit(U_INTERNAL_PROGRAM_ERROR);
+        }
+    }
+    errorCode.assertSuccess();
+    return table;
+}
+
+void write(const char *dir, const char *filename, const char *calendar, const char *zoneName,
+           const char *guard, const Table &table) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, filename);
+    FILE *f = fopen(path, "w");
+    if (f == nullptr) {
+        fprintf(stderr, "genchnsecal: unable to create %s\n", path);
+        exit(U_FILE_ACCESS_ERROR);
+    }
+    fprintf(f,
+            "// © 2026 and later: Unicode, Inc. and others.\n"
+            "// License & terms of use: http://www.unicode.org/copyright.html\n"
+            "//\n"
+            "// %s\n"
+            "//\n"
+            "// machine-generated by: tools/unicode/c/genchnsecal\n"
+            "// DO NOT EDIT THIS FILE BY HAND.\n"
+            "//\n"
+            "// Winter solstices and new moons of the %s calendar for Gregorian years\n"
+            "// %d..%d, computed with CalendarAstronomer in %s.\n"
+            "\n"
+            "#ifdef %s\n"
+            "\n",
+            filename, calendar, static_cast<int>(kFirstYear), static_cast<int>(kLastYear),
+            zoneName, guard);
+
+    fprintf(f, "static const uint8_t gWinterSolsticeDay[%d]={\n",
+            static_cast<int>(table.solsticeDays.size()));
+    for (size_t i = 0; i < table.solsticeDays.size(); ++i) {
+        fprintf(f, "%d%s", table.solsticeDays[i],
+                i + 1 == table.solsticeDays.size() ? "\n" : (i % 20 == 19 ? ",\n" : ","));
+    }
+    fprintf(f, "};\n\n");
+
+    int32_t count = static_cast<int32_t>(table.newMoons.size());
+    int32_t blockCount = (count + 31) / 32;
+    fprintf(f, "static const icu::ChineseCalendar::NewMoonBlock gNewMoonBlocks[%d]={\n",
+            static_cast<int>(blockCount));
+    for (int32_t block = 0; block < blockCount; ++block) {
+        uint32_t longMonths = 0;
+        uint32_t noMajorSolarTerm = 0;
+        for (int32_t j = 0; j < 32 && block * 32 + j < count; ++j) {
+            int32_t i = block * 32 + j;
+            // The length of the last month is never used.
+            if (i + 1 < count && table.newMoons[i + 1] - table.newMoons[i] == 30) {
+                longMonths |= static_cast<uint32_t>(1) << j;
+            }
+            if (table.noMajorSolarTerm[i]) {
+                noMajorSolarTerm |= static_cast<uint32_t>(1) << j;
+            }
+        }
+        fprintf(f, "    {%d,0x%08x,0x%08x}%s\n",
+                static_cast<int>(table.newMoons[block * 32]), longMonths, noMajorSolarTerm,
+                block + 1 == blockCount ? "" : ",");
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f,
+            "static const icu::ChineseCalendar::PrecomputedTable gPrecomputedTable={\n"
+            "    %d,%d,gWinterSolsticeDay,%d,gNewMoonBlocks\n"
+            "};\n"
+            "\n"
+            "#endif  // %s\n",
+            static_cast<int>(kFirstYear - 1), static_cast<int>(kLastYear + 1),
+            static_cast<int>(count), guard);
+    fclose(f);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s path/to/icu4c/source/i18n\n", argv[0]);
+        return U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    IcuToolErrorCode errorCode("genchnsecal");
+    ChineseSetting chinese(errorCode);
+    DangiSetting dangi(errorCode);
+    errorCode.assertSuccess();
+
+    Table chineseTable = compute(chinese.zone(errorCode), errorCode);
+    write(argv[1], "chnsecal_data.h", "Chinese", "UTC+8",
+          "INCLUDED_FROM_CHNSECAL_CPP", chineseTable);
+    Table dangiTable = compute(dangi.zone(errorCode), errorCode);
+    write(argv[1], "dangical_data.h", "Dangi", "the Korean zone of dangical.cpp",
+          "INCLUDED_FROM_DANGICAL_CPP", dangiTable);
+    return 0;
+}